@@ -13,18 +13,22 @@ public function index(Request $request): JsonResponse
     {
         $validated = $request->validate([
             'top' => 'sometimes|integer|min:1|max:100',
+            'offset' => 'sometimes|integer|min:0',
+            'limit' => 'sometimes|integer|min:1|max:100',
             'class' => 'sometimes|nullable|string',
             'timeframe' => 'sometimes|in:daily,weekly,all-time',
         ]);
 
-        $top = $validated['top'] ?? 100;
+        $offset = $validated['offset'] ?? 0;
+        $limit = $validated['limit'] ?? $validated['top'] ?? 100;
         $class = $validated['class'] ?? null;
         $timeframe = $validated['timeframe'] ?? 'all-time';
 
         $query = LeaderboardEntry::with(['player', 'run.replay'])
             ->where('timeframe', $timeframe)
             ->whereNotIn('player_class', ['Scout', 'Collector']) // Exclude coming soon classes
-            ->orderBy('score', 'desc');
+            ->orderBy('score', 'desc')
+            ->orderBy('id'); // Stable order for equal scores, so offset pages don't overlap or skip
 
         if ($class) {
             $query->where('player_class', $class);
@@ -37,14 +41,20 @@ public function index(Request $request): JsonResponse
             $query->whereBetween('achieved_at', [now()->startOfWeek(), now()->endOfWeek()]);
         }
 
-        $entries = $query->limit($top)->get();
+        // Fetch one extra row to know whether another page follows without a count query
+        $entries = $query->skip($offset)->take($limit + 1)->get();
+        $hasMore = $entries->count() > $limit;
+        $entries = $entries->take($limit);
 
         return response()->json([
             'timeframe' => $timeframe,
             'class' => $class,
-            'entries' => $entries->map(function ($entry, $index) {
+            'offset' => $offset,
+            'limit' => $limit,
+            'has_more' => $hasMore,
+            'entries' => $entries->map(function ($entry, $index) use ($offset) {
                 return [
-                    'rank' => $index + 1,
+                    'rank' => $offset + $index + 1,
                     'player_id' => $entry->player_id,
                     'run_id' => $entry->run_id,
                     'player_name' => $entry->player->display_name,
@@ -54,6 +64,7 @@ public function index(Request $request): JsonResponse
                         'seed_id' => $entry->run?->seed_id,
                         'track_seed' => $entry->run?->track_seed ?? 0,
                         'has_replay' => $entry->run?->replay !== null,
+                        'rng_version' => $entry->run?->rng_version ?? 1,
                     ];
             }),
         ]);
@@ -112,7 +123,8 @@ public function playerRank(Request $request, int $id): JsonResponse
         $player = \App\Models\Player::findOrFail($id);
 
         $query = LeaderboardEntry::where('timeframe', $timeframe)
-            ->orderBy('score', 'desc');
+            ->orderBy('score', 'desc')
+            ->orderBy('id');
 
         if ($timeframe === 'daily') {
             $query->whereDate('achieved_at', today());
@@ -131,6 +143,7 @@ public function playerRank(Request $request, int $id): JsonResponse
         $bestEntry = LeaderboardEntry::where('player_id', $player->id)
             ->where('timeframe', $timeframe)
             ->orderBy('score', 'desc')
+            ->orderBy('id')
             ->first();
 
         return response()->json([
@@ -86,6 +86,7 @@ public function store(Request $request): JsonResponse
             'device_id' => 'string|nullable',
             'started_at' => 'string|nullable',
             'replay_data' => 'array|nullable',
+            'rng_version' => 'integer|min:1|nullable',
         ]);
 
         $validationResult = $this->validationService->validate($validated);
@@ -113,6 +114,7 @@ public function store(Request $request): JsonResponse
             'player_class' => $validated['player_class'] ?? 'Vanilla',
             'seed_id' => $validated['seed_id'],
             'track_seed' => $trackSeed,
+            'rng_version' => $validated['rng_version'] ?? 1,
             'score' => $validated['score'],
             'distance' => $validated['distance'],
             'duration_seconds' => $validated['duration_seconds'],
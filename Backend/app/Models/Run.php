@@ -17,6 +17,7 @@ class Run extends Model
         'player_class',
         'seed_id',
         'track_seed',
+        'rng_version',
         'score',
         'distance',
         'duration_seconds',
@@ -40,6 +41,7 @@ class Run extends Model
         'is_endless' => 'boolean',
         'is_suspicious' => 'boolean',
         'track_seed' => 'integer',
+        'rng_version' => 'integer',
         'score' => 'integer',
         'distance' => 'integer',
         'duration_seconds' => 'integer',
@@ -0,0 +1,30 @@
+<?php
+
+use Illuminate\Database\Migrations\Migration;
+use Illuminate\Database\Schema\Blueprint;
+use Illuminate\Support\Facades\Schema;
+
+return new class extends Migration
+{
+    /**
+     * Run the migrations.
+     *
+     * Existing runs were generated with the client's legacy shared random stream (version 1).
+     */
+    public function up(): void
+    {
+        Schema::table('runs', function (Blueprint $table) {
+            $table->unsignedTinyInteger('rng_version')->default(1)->after('track_seed');
+        });
+    }
+
+    /**
+     * Reverse the migrations.
+     */
+    public function down(): void
+    {
+        Schema::table('runs', function (Blueprint $table) {
+            $table->dropColumn('rng_version');
+        });
+    }
+};
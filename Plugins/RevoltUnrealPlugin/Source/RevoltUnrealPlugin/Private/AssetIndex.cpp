@@ -0,0 +1,313 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Engine/World.h"
+
+FAssetIndex* FAssetIndex::Instance = nullptr;
+
+FAssetIndex::FAssetIndex()
+	: bBuilt(false)
+{
+}
+
+FAssetIndex& FAssetIndex::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FAssetIndex();
+	}
+	return *Instance;
+}
+
+void FAssetIndex::Initialize()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FAssetIndex::OnAssetAdded);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FAssetIndex::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FAssetIndex::OnAssetRenamed);
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FAssetIndex::OnAssetUpdated);
+
+	// Building mid-scan would only be followed by thousands of add events, so wait for the initial scan
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FAssetIndex::OnFilesLoaded);
+	}
+	else
+	{
+		EnsureBuilt();
+	}
+}
+
+void FAssetIndex::Shutdown()
+{
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+	}
+
+	Entries.Empty();
+	IdsByPath.Empty();
+	IdsByName.Empty();
+	IdsByTrigram.Empty();
+	for (TSet<int32>& Ids : IdsByKind)
+	{
+		Ids.Empty();
+	}
+	bBuilt = false;
+}
+
+TArray<FAssetData> FAssetIndex::Search(const FString& Query)
+{
+	EnsureBuilt();
+
+	TArray<int32> Ids;
+	FindMatches(Query.ToLower(), Ids);
+
+	TArray<FAssetData> Result;
+	Result.Reserve(Ids.Num());
+	for (int32 Id : Ids)
+	{
+		Result.Add(Entries[Id].AssetData);
+	}
+	return Result;
+}
+
+TArray<FAssetData> FAssetIndex::GetAssetsOfKind(EIndexedAssetKind Kind)
+{
+	EnsureBuilt();
+
+	TArray<int32> Ids = IdsByKind[(int32)Kind].Array();
+	Ids.Sort();
+
+	TArray<FAssetData> Result;
+	Result.Reserve(Ids.Num());
+	for (int32 Id : Ids)
+	{
+		Result.Add(Entries[Id].AssetData);
+	}
+	return Result;
+}
+
+bool FAssetIndex::FindByName(const FString& Name, EIndexedAssetKind Kind, FAssetData& OutAssetData)
+{
+	EnsureBuilt();
+
+	// Exact match through the name map (FNAME_Find so lookups never add names)
+	const FName ExactName = Name.Len() < NAME_SIZE ? FName(*Name, FNAME_Find) : NAME_None;
+	if (!ExactName.IsNone())
+	{
+		TArray<int32> Ids;
+		IdsByName.MultiFind(ExactName, Ids);
+		Ids.Sort();
+		for (int32 Id : Ids)
+		{
+			if (Entries[Id].Kind == Kind)
+			{
+				OutAssetData = Entries[Id].AssetData;
+				return true;
+			}
+		}
+	}
+
+	// Partial match on the name only
+	TArray<int32> Ids;
+	FindMatches(Name.ToLower(), Ids);
+	for (int32 Id : Ids)
+	{
+		const FEntry& Entry = Entries[Id];
+		if (Entry.Kind == Kind && Entry.AssetData.AssetName.ToString().Contains(Name, ESearchCase::IgnoreCase))
+		{
+			OutAssetData = Entry.AssetData;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FAssetIndex::EnsureBuilt()
+{
+	if (bBuilt)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	BlueprintClasses.Reset();
+	WorldClasses.Reset();
+	AssetRegistry.GetDerivedClassNames({ UBlueprint::StaticClass()->GetClassPathName() }, {}, BlueprintClasses);
+	AssetRegistry.GetDerivedClassNames({ UWorld::StaticClass()->GetClassPathName() }, {}, WorldClasses);
+
+	TArray<FAssetData> AssetDataList;
+	AssetRegistry.GetAllAssets(AssetDataList, true);
+
+	Entries.Reserve(AssetDataList.Num());
+	IdsByPath.Reserve(AssetDataList.Num());
+	for (const FAssetData& AssetData : AssetDataList)
+	{
+		AddAsset(AssetData);
+	}
+	bBuilt = true;
+
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Asset index built with %d assets (%d trigrams)"), Entries.Num(), IdsByTrigram.Num());
+}
+
+void FAssetIndex::AddAsset(const FAssetData& AssetData)
+{
+	RemoveAsset(AssetData.GetSoftObjectPath());
+
+	FEntry Entry;
+	Entry.AssetData = AssetData;
+	Entry.SearchText = FString::Printf(TEXT("%s\n%s\n%s"), *AssetData.AssetName.ToString(), *AssetData.GetObjectPathString(), *AssetData.AssetClassPath.ToString()).ToLower();
+	if (BlueprintClasses.Contains(AssetData.AssetClassPath))
+	{
+		Entry.Kind = EIndexedAssetKind::Blueprint;
+	}
+	else if (WorldClasses.Contains(AssetData.AssetClassPath))
+	{
+		Entry.Kind = EIndexedAssetKind::World;
+	}
+
+	const int32 Id = Entries.Add(MoveTemp(Entry));
+	const FEntry& Added = Entries[Id];
+
+	IdsByPath.Add(AssetData.GetSoftObjectPath(), Id);
+	IdsByName.Add(AssetData.AssetName, Id);
+	IdsByKind[(int32)Added.Kind].Add(Id);
+
+	TSet<uint64> Trigrams;
+	GetTrigrams(Added.SearchText, Trigrams);
+	for (uint64 Trigram : Trigrams)
+	{
+		IdsByTrigram.FindOrAdd(Trigram).Add(Id);
+	}
+}
+
+void FAssetIndex::RemoveAsset(const FSoftObjectPath& ObjectPath)
+{
+	int32 Id = INDEX_NONE;
+	if (!IdsByPath.RemoveAndCopyValue(ObjectPath, Id))
+	{
+		return;
+	}
+
+	const FEntry& Entry = Entries[Id];
+	IdsByName.RemoveSingle(Entry.AssetData.AssetName, Id);
+	IdsByKind[(int32)Entry.Kind].Remove(Id);
+
+	TSet<uint64> Trigrams;
+	GetTrigrams(Entry.SearchText, Trigrams);
+	for (uint64 Trigram : Trigrams)
+	{
+		if (TArray<int32>* Ids = IdsByTrigram.Find(Trigram))
+		{
+			Ids->RemoveSingleSwap(Id, EAllowShrinking::No);
+			if (Ids->Num() == 0)
+			{
+				IdsByTrigram.Remove(Trigram);
+			}
+		}
+	}
+
+	Entries.RemoveAt(Id);
+}
+
+void FAssetIndex::FindMatches(const FString& LowerQuery, TArray<int32>& OutIds) const
+{
+	// Too short for a trigram: scan the cached search text
+	if (LowerQuery.Len() < 3)
+	{
+		for (auto It = Entries.CreateConstIterator(); It; ++It)
+		{
+			if (It->SearchText.Contains(LowerQuery, ESearchCase::CaseSensitive))
+			{
+				OutIds.Add(It.GetIndex());
+			}
+		}
+		return;
+	}
+
+	// Every trigram of the query must be present; verify only the candidates of the rarest one
+	TSet<uint64> Trigrams;
+	GetTrigrams(LowerQuery, Trigrams);
+
+	const TArray<int32>* Candidates = nullptr;
+	for (uint64 Trigram : Trigrams)
+	{
+		const TArray<int32>* Ids = IdsByTrigram.Find(Trigram);
+		if (!Ids)
+		{
+			return;
+		}
+		if (!Candidates || Ids->Num() < Candidates->Num())
+		{
+			Candidates = Ids;
+		}
+	}
+
+	for (int32 Id : *Candidates)
+	{
+		if (Entries[Id].SearchText.Contains(LowerQuery, ESearchCase::CaseSensitive))
+		{
+			OutIds.Add(Id);
+		}
+	}
+	OutIds.Sort();
+}
+
+void FAssetIndex::GetTrigrams(const FString& Text, TSet<uint64>& OutTrigrams)
+{
+	for (int32 Index = 0; Index + 2 < Text.Len(); ++Index)
+	{
+		OutTrigrams.Add((uint64)(uint16)Text[Index] << 32 | (uint64)(uint16)Text[Index + 1] << 16 | (uint64)(uint16)Text[Index + 2]);
+	}
+}
+
+void FAssetIndex::OnFilesLoaded()
+{
+	EnsureBuilt();
+}
+
+void FAssetIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+	// Before the first build the registry scan will pick the asset up anyway
+	if (bBuilt)
+	{
+		AddAsset(AssetData);
+	}
+}
+
+void FAssetIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (bBuilt)
+	{
+		RemoveAsset(AssetData.GetSoftObjectPath());
+	}
+}
+
+void FAssetIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (bBuilt)
+	{
+		RemoveAsset(FSoftObjectPath(OldObjectPath));
+		AddAsset(AssetData);
+	}
+}
+
+void FAssetIndex::OnAssetUpdated(const FAssetData& AssetData)
+{
+	if (bBuilt)
+	{
+		AddAsset(AssetData);
+	}
+}
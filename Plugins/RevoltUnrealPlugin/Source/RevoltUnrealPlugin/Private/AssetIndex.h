@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/SparseArray.h"
+
+/** Asset categories the query handlers look up by name */
+enum class EIndexedAssetKind : uint8
+{
+	Other,
+	Blueprint,
+	World,
+	Count
+};
+
+/**
+ * In-memory index of the project's assets, built from the asset registry once and kept
+ * current from its added/removed/renamed/updated events.
+ * Exact names resolve through a hash map; substring search goes through a trigram index
+ * over each asset's lower-cased name, object path and class path.
+ */
+class FAssetIndex
+{
+public:
+
+	/** Get singleton instance */
+	static FAssetIndex& Get();
+
+	/** Subscribe to asset registry events (the index itself is built once the registry has finished scanning) */
+	void Initialize();
+
+	/** Unsubscribe from asset registry events and drop the index */
+	void Shutdown();
+
+	/**
+	 * Find assets whose name, object path or class path contains the query (case-insensitive)
+	 * @param Query Text to search for
+	 * @return Matching assets
+	 */
+	TArray<FAssetData> Search(const FString& Query);
+
+	/**
+	 * Get every asset of a kind
+	 * @param Kind Asset category
+	 * @return Assets of that kind
+	 */
+	TArray<FAssetData> GetAssetsOfKind(EIndexedAssetKind Kind);
+
+	/**
+	 * Find an asset of a kind by name, preferring an exact (case-insensitive) match over a partial one
+	 * @param Name Asset name or part of it
+	 * @param Kind Asset category
+	 * @param OutAssetData Found asset
+	 * @return True if an asset was found
+	 */
+	bool FindByName(const FString& Name, EIndexedAssetKind Kind, FAssetData& OutAssetData);
+
+	/** Number of indexed assets */
+	int32 Num() const { return Entries.Num(); }
+
+private:
+
+	/** Private constructor for singleton */
+	FAssetIndex();
+
+	struct FEntry
+	{
+		FAssetData AssetData;
+		FString SearchText;
+		EIndexedAssetKind Kind = EIndexedAssetKind::Other;
+	};
+
+	/** Build the index from the registry if it has not been built yet */
+	void EnsureBuilt();
+
+	/** Add an asset, replacing any entry with the same object path */
+	void AddAsset(const FAssetData& AssetData);
+
+	/** Remove the entry for an object path */
+	void RemoveAsset(const FSoftObjectPath& ObjectPath);
+
+	/** Collect the entries whose search text contains a lower-cased query, in index order */
+	void FindMatches(const FString& LowerQuery, TArray<int32>& OutIds) const;
+
+	/** Distinct trigrams of a lower-cased string */
+	static void GetTrigrams(const FString& Text, TSet<uint64>& OutTrigrams);
+
+	/** Asset registry callbacks */
+	void OnFilesLoaded();
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnAssetUpdated(const FAssetData& AssetData);
+
+	/** Indexed assets (ids stay stable across removals) */
+	TSparseArray<FEntry> Entries;
+
+	/** Object path -> entry id */
+	TMap<FSoftObjectPath, int32> IdsByPath;
+
+	/** Asset name -> entry ids (FName comparison is case-insensitive) */
+	TMultiMap<FName, int32> IdsByName;
+
+	/** Trigram -> ids of entries whose search text contains it */
+	TMap<uint64, TArray<int32>> IdsByTrigram;
+
+	/** Entry ids per kind */
+	TSet<int32> IdsByKind[(int32)EIndexedAssetKind::Count];
+
+	/** Class paths counted as blueprints / worlds (subclasses included) */
+	TSet<FTopLevelAssetPath> BlueprintClasses;
+	TSet<FTopLevelAssetPath> WorldClasses;
+
+	/** Whether the full build from the registry has run */
+	bool bBuilt;
+
+	/** Registry event subscriptions */
+	FDelegateHandle FilesLoadedHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+
+	/** Singleton instance */
+	static FAssetIndex* Instance;
+};
@@ -1,16 +1,15 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AssetQueryHandler.h"
+#include "AssetIndex.h"
+#include "JsonPageWriter.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "UObject/Class.h"
 #include "UObject/UObjectGlobals.h"
 
-TSharedPtr<FJsonObject> FAssetQueryHandler::QueryAssets(const FString& AssetType)
+FString FAssetQueryHandler::QueryAssets(const FString& AssetType, const FPageOptions& Page)
 {
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	TArray<TSharedPtr<FJsonValue>> AssetsArray;
-
 	// Get asset registry
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
@@ -40,56 +39,23 @@ TSharedPtr<FJsonObject> FAssetQueryHandler::QueryAssets(const FString& AssetType
 
 	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Found %d assets of type '%s'"), AssetDataList.Num(), *AssetType);
 
-	for (const FAssetData& AssetData : AssetDataList)
-	{
-		TSharedPtr<FJsonObject> AssetJson = ExtractAssetInfo(AssetData);
-		AssetsArray.Add(MakeShared<FJsonValueObject>(AssetJson));
-	}
-
-	Result->SetArrayField(TEXT("assets"), AssetsArray);
-	Result->SetNumberField(TEXT("count"), AssetsArray.Num());
-	Result->SetStringField(TEXT("type_filter"), AssetType);
-	Result->SetBoolField(TEXT("success"), true);
-
-	return Result;
+	FJsonPageWriter Writer(TEXT("assets"));
+	Writer.GetWriter().WriteValue(TEXT("type_filter"), AssetType);
+	return Writer.WriteAssetPage(AssetDataList, Page, &FAssetQueryHandler::ExtractAssetInfo);
 }
 
-TSharedPtr<FJsonObject> FAssetQueryHandler::SearchAssets(const FString& SearchQuery)
+FString FAssetQueryHandler::SearchAssets(const FString& SearchQuery, const FPageOptions& Page)
 {
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	TArray<TSharedPtr<FJsonValue>> AssetsArray;
-
-	// Get asset registry
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	// Get all assets
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAllAssets(AssetDataList, true);
-
-	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Searching %d assets for '%s'"), AssetDataList.Num(), *SearchQuery);
-
-	// Filter assets by search query
-	for (const FAssetData& AssetData : AssetDataList)
-	{
-		// Check if asset name or path contains the search query
-		if (AssetData.AssetName.ToString().Contains(SearchQuery, ESearchCase::IgnoreCase) ||
-			AssetData.GetObjectPathString().Contains(SearchQuery, ESearchCase::IgnoreCase) ||
-			AssetData.AssetClassPath.ToString().Contains(SearchQuery, ESearchCase::IgnoreCase))
-		{
-			TSharedPtr<FJsonObject> AssetJson = ExtractAssetInfo(AssetData);
-			AssetsArray.Add(MakeShared<FJsonValueObject>(AssetJson));
-		}
-	}
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Searching %d assets for '%s'"), FAssetIndex::Get().Num(), *SearchQuery);
 
-	Result->SetArrayField(TEXT("assets"), AssetsArray);
-	Result->SetNumberField(TEXT("count"), AssetsArray.Num());
-	Result->SetStringField(TEXT("query"), SearchQuery);
-	Result->SetBoolField(TEXT("success"), true);
+	// Name, path or class contains the search query
+	const TArray<FAssetData> Matches = FAssetIndex::Get().Search(SearchQuery);
 
-	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Found %d matching assets"), AssetsArray.Num());
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Found %d matching assets"), Matches.Num());
 
-	return Result;
+	FJsonPageWriter Writer(TEXT("assets"));
+	Writer.GetWriter().WriteValue(TEXT("query"), SearchQuery);
+	return Writer.WriteAssetPage(Matches, Page, &FAssetQueryHandler::ExtractAssetInfo);
 }
 
 TSharedPtr<FJsonObject> FAssetQueryHandler::ExtractAssetInfo(const FAssetData& AssetData)
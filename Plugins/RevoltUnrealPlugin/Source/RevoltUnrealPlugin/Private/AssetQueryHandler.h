@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
+#include "QueryOptions.h"
 
 /**
  * Handles general asset querying using the asset registry
@@ -13,11 +14,11 @@ class FAssetQueryHandler
 {
 public:
 
-	/** Query assets by type */
-	static TSharedPtr<FJsonObject> QueryAssets(const FString& AssetType);
+	/** Query a page of assets by type (returns response JSON) */
+	static FString QueryAssets(const FString& AssetType, const FPageOptions& Page);
 
-	/** Search assets by query string */
-	static TSharedPtr<FJsonObject> SearchAssets(const FString& SearchQuery);
+	/** Search a page of assets by query string (returns response JSON) */
+	static FString SearchAssets(const FString& SearchQuery, const FPageOptions& Page);
 
 private:
 
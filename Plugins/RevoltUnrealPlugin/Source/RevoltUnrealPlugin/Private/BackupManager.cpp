@@ -1,14 +1,22 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "BackupManager.h"
+#include "BackupStore.h"
 #include "Engine/Blueprint.h"
 #include "Engine/DataAsset.h"
 #include "UObject/SavePackage.h"
+#include "UObject/LinkerLoad.h"
 #include "Misc/PackageName.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
+#include "Math/RandomStream.h"
 #include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
 #include "HAL/FileManager.h"
+#include "PackageTools.h"
+
+FBackupStore* FBackupManager::Store = nullptr;
+TSet<FString> FBackupManager::DirtyBackups;
 
 FString FBackupManager::CreateBackup(UPackage* Package)
 {
@@ -33,11 +41,14 @@ FString FBackupManager::CreateBackup(UPackage* Package)
 	// Get the original package file path
 	FString OriginalFilePath = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
 
-	// Copy the package file to backup location
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (PlatformFile.CopyFile(*BackupPath, *OriginalFilePath))
+	// Capture the package file in the chunk store (only chunks not already stored are written)
+	if (GetStore().Add(OriginalFilePath, PackageName, BackupPath))
 	{
 		UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Created backup at '%s'"), *BackupPath);
+		if (Package->IsDirty())
+		{
+			DirtyBackups.Add(BackupPath);
+		}
 		return BackupPath;
 	}
 
@@ -75,30 +86,65 @@ FString FBackupManager::CreateDataAssetBackup(UDataAsset* DataAsset)
 	return CreateBackup(DataAsset->GetOutermost());
 }
 
-bool FBackupManager::RestoreBackup(const FString& BackupPath)
+bool FBackupManager::RestoreBackup(const FString& BackupPath, bool bDiscardUnsavedChanges)
 {
-	if (BackupPath.IsEmpty() || !FPaths::FileExists(BackupPath))
+	// A manifest may still be being written, so the store decides whether it exists
+	if (BackupPath.IsEmpty() || !(FBackupStore::IsManifest(BackupPath) ? GetStore().Exists(BackupPath) : FPaths::FileExists(BackupPath)))
 	{
 		UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Backup file not found: '%s'"), *BackupPath);
 		return false;
 	}
 
-	// Extract original asset name from backup filename
-	FString BackupFilename = FPaths::GetCleanFilename(BackupPath);
-	// Backup format: AssetName_backup_YYYYMMDD_HHMMSS.uasset
-	// Need to extract the original name
-	
-	// For now, log that restore would happen
-	UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: Restore from backup '%s' - Feature requires manual implementation"), *BackupPath);
-	
-	// TODO: Implement actual restore logic
-	// This requires:
-	// 1. Parse backup filename to get original asset path
-	// 2. Load the backup package
-	// 3. Replace the current package with backup
-	// 4. Reload asset in editor
-
-	return false;
+	// Full copies made before backups had manifests don't record the file they came from
+	if (!FBackupStore::IsManifest(BackupPath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: Backup '%s' has no manifest and must be restored manually"), *BackupPath);
+		return false;
+	}
+
+	// The file predates the editor's unsaved changes; writing it back would silently drop them
+	if (!bDiscardUnsavedChanges && DirtyBackups.Contains(BackupPath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: Not restoring backup '%s', its package had unsaved changes when it was taken"), *BackupPath);
+		return false;
+	}
+
+	TArray64<uint8> Data;
+	FString OriginalFilePath;
+	FString PackageName;
+	if (!GetStore().Read(BackupPath, Data, OriginalFilePath, PackageName))
+	{
+		UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Failed to read backup '%s'"), *BackupPath);
+		return false;
+	}
+
+	// Detach the loaded package from its file before overwriting it
+	UPackage* Package = FindPackage(nullptr, *PackageName);
+	if (Package)
+	{
+		ResetLoaders(Package);
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Data, *OriginalFilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Failed to write '%s' from backup '%s'"), *OriginalFilePath, *BackupPath);
+		return false;
+	}
+
+	// Reload so the editor drops the in-memory edits
+	if (Package)
+	{
+		TArray<UPackage*> Packages = { Package };
+		FText ErrorMessage;
+		if (!UPackageTools::ReloadPackages(Packages, ErrorMessage, EReloadPackagesInteractionMode::AssumePositive))
+		{
+			UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Restored '%s' but failed to reload it: %s"), *PackageName, *ErrorMessage.ToString());
+			return false;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Restored '%s' from backup '%s'"), *PackageName, *BackupPath);
+	return true;
 }
 
 TArray<FString> FBackupManager::ListBackups(const FString& AssetPath)
@@ -126,7 +172,8 @@ int32 FBackupManager::CleanOldBackups(int32 DaysToKeep)
 	TArray<FString> BackupFiles;
 	FileManager.FindFilesRecursive(BackupFiles, *BackupDir, TEXT("*.uasset"), true, false);
 
-	FDateTime Cutoff = FDateTime::Now() - FTimespan::FromDays(DaysToKeep);
+	// File timestamps are UTC
+	FDateTime Cutoff = FDateTime::UtcNow() - FTimespan::FromDays(DaysToKeep);
 
 	for (const FString& BackupFile : BackupFiles)
 	{
@@ -141,10 +188,126 @@ int32 FBackupManager::CleanOldBackups(int32 DaysToKeep)
 		}
 	}
 
+	// Manifests, then the chunks only they used
+	int32 DeletedChunks = 0;
+	DeletedCount += GetStore().CollectGarbage(Cutoff, DeletedChunks);
+
 	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Cleaned %d old backups"), DeletedCount);
 	return DeletedCount;
 }
 
+void FBackupManager::Shutdown()
+{
+	if (Store)
+	{
+		Store->Flush();
+		delete Store;
+		Store = nullptr;
+	}
+}
+
+void FBackupManager::RunBenchmark(int32 NumEdits, const FString& PackageName)
+{
+	NumEdits = FMath::Max(NumEdits, 1);
+
+	IFileManager& FileManager = IFileManager::Get();
+	const FString BenchmarkDir = GetBackupDirectory() / TEXT("Benchmark");
+	FileManager.DeleteDirectory(*BenchmarkDir, false, true);
+	FileManager.MakeDirectory(*(BenchmarkDir / TEXT("Store")), true);
+
+	// The package's file, or generated data about as compressible as a typical package
+	TArray64<uint8> Original;
+	FString SourceName = PackageName;
+	FString SourceFilePath;
+	if (PackageName.IsEmpty() || !FPackageName::DoesPackageExist(PackageName, &SourceFilePath) || !FFileHelper::LoadFileToArray(Original, *SourceFilePath))
+	{
+		FRandomStream Random(1);
+		Original.SetNumUninitialized(4 * 1024 * 1024);
+		for (uint8& Byte : Original)
+		{
+			Byte = (uint8)Random.RandRange(0, 15);
+		}
+		SourceName = TEXT("generated");
+		SourceFilePath = BenchmarkDir / TEXT("Generated.uasset");
+	}
+
+	// Most edits change a value in place; every tenth inserts data (a new variable or node) and shifts the rest
+	auto ApplyEdit = [](TArray64<uint8>& Data, FRandomStream& Random, int32 EditIndex)
+	{
+		const int64 Offset = (int64)(Random.FRand() * (Data.Num() - 1));
+		if (EditIndex % 10 == 9)
+		{
+			uint8 Inserted[64];
+			for (uint8& Byte : Inserted)
+			{
+				Byte = (uint8)Random.RandRange(0, 255);
+			}
+			Data.Insert(Inserted, UE_ARRAY_COUNT(Inserted), Offset);
+		}
+		else
+		{
+			for (int64 Index = Offset; Index < FMath::Min<int64>(Offset + 16, Data.Num()); ++Index)
+			{
+				Data[Index] = (uint8)Random.RandRange(0, 255);
+			}
+		}
+	};
+
+	// Full copies: time a sample (writing every version would take gigabytes) and count the bytes of all of them
+	const int32 CopySamples = FMath::Min(NumEdits, 50);
+	int64 CopyBytes = 0;
+	double CopySeconds = 0.0;
+	{
+		TArray64<uint8> Data = Original;
+		FRandomStream Random(2);
+		for (int32 Edit = 0; Edit < NumEdits; ++Edit)
+		{
+			if (Edit < CopySamples)
+			{
+				const FString CopyPath = BenchmarkDir / FString::Printf(TEXT("Copy_%d.bin"), Edit);
+				const double Start = FPlatformTime::Seconds();
+				FFileHelper::SaveArrayToFile(Data, *CopyPath);
+				CopySeconds += FPlatformTime::Seconds() - Start;
+				FileManager.Delete(*CopyPath);
+			}
+			CopyBytes += Data.Num();
+			ApplyEdit(Data, Random, Edit);
+		}
+	}
+	const double CopyMsPerEdit = CopySeconds * 1000.0 / CopySamples;
+
+	// Chunk store: the same edits, timed on the calling thread and until the last write lands
+	double StoreCallerSeconds = 0.0;
+	double StoreTotalSeconds = 0.0;
+	int64 StoreBytes = 0;
+	{
+		FBackupStore BenchmarkStore(BenchmarkDir / TEXT("Store"));
+		TArray64<uint8> Data = Original;
+		FRandomStream Random(2);
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Edit = 0; Edit < NumEdits; ++Edit)
+		{
+			const double AddStart = FPlatformTime::Seconds();
+			TArray64<uint8> Version = Data;
+			BenchmarkStore.AddData(MoveTemp(Version), SourceFilePath, SourceName, BenchmarkDir / TEXT("Store") / FString::Printf(TEXT("Edit_%d.json"), Edit));
+			StoreCallerSeconds += FPlatformTime::Seconds() - AddStart;
+			ApplyEdit(Data, Random, Edit);
+		}
+		BenchmarkStore.Flush();
+		StoreTotalSeconds = FPlatformTime::Seconds() - Start;
+		StoreBytes = BenchmarkStore.GetDiskUsage();
+	}
+
+	const double MB = 1024.0 * 1024.0;
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Backup benchmark: %d edits of '%s' (%.1f MB)"), NumEdits, *SourceName, Original.Num() / MB);
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin:   Full copies: %.2f ms/edit (%d sampled), %.1f MB on disk"), CopyMsPerEdit, CopySamples, CopyBytes / MB);
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin:   Chunk store: %.2f ms/edit on the calling thread, %.2f ms/edit until written, %.1f MB on disk (%.1f%% of copies)"),
+		StoreCallerSeconds * 1000.0 / NumEdits, StoreTotalSeconds * 1000.0 / NumEdits, StoreBytes / MB, CopyBytes > 0 ? 100.0 * StoreBytes / CopyBytes : 0.0);
+
+	FileManager.DeleteDirectory(*BenchmarkDir, false, true);
+}
+
 bool FBackupManager::VerifyBackup(const FString& BackupPath)
 {
 	if (BackupPath.IsEmpty())
@@ -152,13 +315,16 @@ bool FBackupManager::VerifyBackup(const FString& BackupPath)
 		return false;
 	}
 
-	// Check if file exists
-	if (!FPaths::FileExists(BackupPath))
+	// Manifest backups are verified by reassembling the file and checking its hash (Read waits for pending writes)
+	if (FBackupStore::IsManifest(BackupPath))
 	{
-		return false;
+		TArray64<uint8> Data;
+		FString OriginalFilePath;
+		FString PackageName;
+		return GetStore().Read(BackupPath, Data, OriginalFilePath, PackageName);
 	}
 
-	// Check if file has content
+	// Check if file exists and has content
 	int64 FileSize = IFileManager::Get().FileSize(*BackupPath);
 	if (FileSize <= 0)
 	{
@@ -175,15 +341,32 @@ FString FBackupManager::GetBackupDirectory()
 	return ProjectDir / TEXT("RevoltBackups");
 }
 
+FBackupStore& FBackupManager::GetStore()
+{
+	if (!Store)
+	{
+		Store = new FBackupStore(GetBackupDirectory());
+	}
+	return *Store;
+}
+
 FString FBackupManager::GenerateBackupFilename(const FString& OriginalAssetName)
 {
-	// Format: AssetName_backup_YYYYMMDD_HHMMSS.uasset
+	// Format: AssetName_backup_YYYYMMDD_HHMMSS_mmm.json (milliseconds, as one batch can back up an asset several times a second)
 	FDateTime Now = FDateTime::Now();
-	FString Timestamp = FString::Printf(TEXT("%04d%02d%02d_%02d%02d%02d"),
+	FString Timestamp = FString::Printf(TEXT("%04d%02d%02d_%02d%02d%02d_%03d"),
 		Now.GetYear(), Now.GetMonth(), Now.GetDay(),
-		Now.GetHour(), Now.GetMinute(), Now.GetSecond());
+		Now.GetHour(), Now.GetMinute(), Now.GetSecond(), Now.GetMillisecond());
+
+	FString Filename = FString::Printf(TEXT("%s_backup_%s.json"), *OriginalAssetName, *Timestamp);
+
+	// Still taken within the same millisecond
+	for (int32 Suffix = 1; GetStore().Exists(GetBackupDirectory() / Filename); ++Suffix)
+	{
+		Filename = FString::Printf(TEXT("%s_backup_%s_%d.json"), *OriginalAssetName, *Timestamp, Suffix);
+	}
 
-	return FString::Printf(TEXT("%s_backup_%s.uasset"), *OriginalAssetName, *Timestamp);
+	return Filename;
 }
 
 bool FBackupManager::EnsureBackupDirectoryExists()
@@ -7,10 +7,12 @@
 class UPackage;
 class UBlueprint;
 class UDataAsset;
+class FBackupStore;
 
 /**
  * Manages automatic backups of assets before modification
  * Provides restore functionality for failed operations
+ * Backups go to a deduplicating chunk store (see FBackupStore); a backup path is the path of its manifest.
  */
 class FBackupManager
 {
@@ -45,11 +47,14 @@ public:
 	static FString CreateDataAssetBackup(UDataAsset* DataAsset);
 
 	/**
-	 * Restore a package from backup
+	 * Restore a package from backup (writes the package file back and reloads the package if it is loaded)
+	 * A backup only holds the saved file, so a package that had unsaved changes when it was backed up is left
+	 * alone unless the caller undoes a structural change that can't be rolled back any other way.
 	 * @param BackupPath Path to backup file
+	 * @param bDiscardUnsavedChanges Restore even if that drops changes that were unsaved at backup time
 	 * @return True if restore successful
 	 */
-	static bool RestoreBackup(const FString& BackupPath);
+	static bool RestoreBackup(const FString& BackupPath, bool bDiscardUnsavedChanges = false);
 
 	/**
 	 * List all backups for an asset
@@ -59,12 +64,23 @@ public:
 	static TArray<FString> ListBackups(const FString& AssetPath);
 
 	/**
-	 * Delete old backups
+	 * Delete old backups, then the stored chunks no remaining backup uses
 	 * @param DaysToKeep Number of days to keep backups
 	 * @return Number of backups deleted
 	 */
 	static int32 CleanOldBackups(int32 DaysToKeep = 7);
 
+	/** Wait for backups still being written and release the store */
+	static void Shutdown();
+
+	/**
+	 * Measure backup time and disk use over a series of small edits, with the store and with full file copies
+	 * (Revolt.BenchmarkBackups console command). Runs in a scratch directory that is deleted afterwards.
+	 * @param NumEdits Number of edits to back up
+	 * @param PackageName Package whose file is edited (a generated 4 MB file if empty or not found)
+	 */
+	static void RunBenchmark(int32 NumEdits, const FString& PackageName);
+
 	/**
 	 * Verify a backup file is valid
 	 * @param BackupPath Path to backup file
@@ -80,6 +96,9 @@ public:
 
 private:
 
+	/** Store backups are written to */
+	static FBackupStore& GetStore();
+
 	/**
 	 * Generate backup filename with timestamp
 	 * @param OriginalAssetName Original asset name
@@ -92,5 +111,11 @@ private:
 	 * @return True if directory exists or was created
 	 */
 	static bool EnsureBackupDirectoryExists();
+
+	/** Store instance (created on first backup) */
+	static FBackupStore* Store;
+
+	/** Backups taken while their package had unsaved changes (this session only; those changes don't outlive it) */
+	static TSet<FString> DirtyBackups;
 };
 
@@ -0,0 +1,482 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BackupStore.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Hash/Blake3.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace BackupStore
+{
+	/** Chunks are at least this large unless the file ends first */
+	constexpr int64 MinChunkSize = 16 * 1024;
+
+	/** Chunks are cut here if no boundary was found */
+	constexpr int64 MaxChunkSize = 256 * 1024;
+
+	/** A boundary is where the top 16 bits of the rolling hash are zero (64 KiB past the minimum on average) */
+	constexpr uint64 BoundaryMask = 0xFFFF000000000000ull;
+
+	/** Chunk file formats (first byte of the file) */
+	constexpr uint8 ChunkFormatRaw = 0;
+	constexpr uint8 ChunkFormatOodle = 1;
+
+	/** Random value per byte for the rolling (gear) hash; fixed so boundaries are stable across runs */
+	static const uint64* GetGearTable()
+	{
+		static uint64 Table[256];
+		static const bool bInitialized = []()
+		{
+			uint64 State = 0x9E3779B97F4A7C15ull;
+			for (uint64& Value : Table)
+			{
+				// SplitMix64
+				State += 0x9E3779B97F4A7C15ull;
+				uint64 Mixed = State;
+				Mixed = (Mixed ^ (Mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+				Mixed = (Mixed ^ (Mixed >> 27)) * 0x94D049BB133111EBull;
+				Value = Mixed ^ (Mixed >> 31);
+			}
+			return true;
+		}();
+		return Table;
+	}
+}
+
+FBackupStore::FBackupStore(const FString& InRootDirectory)
+	: RootDirectory(InRootDirectory)
+	, bChunkIndexLoaded(false)
+{
+}
+
+FBackupStore::~FBackupStore()
+{
+	Flush();
+}
+
+bool FBackupStore::Add(const FString& SourceFilePath, const FString& PackageName, const FString& ManifestPath)
+{
+	const FFileStatData Stat = IFileManager::Get().GetStatData(*SourceFilePath);
+	if (!Stat.bIsValid || Stat.bIsDirectory)
+	{
+		return false;
+	}
+
+	// Unchanged since its last backup: the new manifest can list the same chunks without reading the file
+	{
+		FScopeLock Lock(&StoreLock);
+		if (const FFileSnapshot* Snapshot = Snapshots.Find(SourceFilePath))
+		{
+			if (Snapshot->Size == Stat.FileSize && Snapshot->TimeStamp == Stat.ModificationTime)
+			{
+				WriteManifest(ManifestPath, SourceFilePath, PackageName, Snapshot->Size, Snapshot->FileHash, Snapshot->Chunks);
+				return true;
+			}
+		}
+	}
+
+	// The edit that follows may overwrite the file, so it has to be read now
+	TArray64<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *SourceFilePath))
+	{
+		return false;
+	}
+
+	{
+		FScopeLock Lock(&PendingLock);
+		PendingManifests.Add(ManifestPath);
+	}
+
+	PendingWrites.RemoveAll([](const TFuture<void>& Write) { return Write.IsReady(); });
+	PendingWrites.Add(Async(EAsyncExecution::ThreadPool, [this, Data = MoveTemp(Data), SourceFilePath, PackageName, ManifestPath, Stat]()
+	{
+		FFileSnapshot Snapshot;
+		Snapshot.Size = Stat.FileSize;
+		Snapshot.TimeStamp = Stat.ModificationTime;
+		WriteBackup(Data, SourceFilePath, PackageName, ManifestPath, Snapshot.FileHash, Snapshot.Chunks);
+
+		FScopeLock Lock(&StoreLock);
+		Snapshots.Add(SourceFilePath, MoveTemp(Snapshot));
+	}));
+
+	return true;
+}
+
+void FBackupStore::AddData(TArray64<uint8>&& Data, const FString& SourceFilePath, const FString& PackageName, const FString& ManifestPath)
+{
+	{
+		FScopeLock Lock(&PendingLock);
+		PendingManifests.Add(ManifestPath);
+	}
+
+	PendingWrites.RemoveAll([](const TFuture<void>& Write) { return Write.IsReady(); });
+	PendingWrites.Add(Async(EAsyncExecution::ThreadPool, [this, Data = MoveTemp(Data), SourceFilePath, PackageName, ManifestPath]()
+	{
+		FString FileHash;
+		TArray<FChunkRef> Chunks;
+		WriteBackup(Data, SourceFilePath, PackageName, ManifestPath, FileHash, Chunks);
+	}));
+}
+
+bool FBackupStore::Read(const FString& ManifestPath, TArray64<uint8>& OutData, FString& OutSourceFilePath, FString& OutPackageName)
+{
+	bool bPending = false;
+	{
+		FScopeLock Lock(&PendingLock);
+		bPending = PendingManifests.Contains(ManifestPath);
+	}
+	if (bPending)
+	{
+		Flush();
+	}
+
+	int64 Size = 0;
+	FString FileHash;
+	TArray<FChunkRef> Chunks;
+	if (!ReadManifest(ManifestPath, OutSourceFilePath, OutPackageName, Size, FileHash, Chunks))
+	{
+		UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Invalid backup manifest '%s'"), *ManifestPath);
+		return false;
+	}
+
+	OutData.Reset(Size);
+	TArray64<uint8> ChunkData;
+	for (const FChunkRef& Chunk : Chunks)
+	{
+		if (!LoadChunk(Chunk, ChunkData))
+		{
+			UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Backup '%s' references missing or corrupt chunk %s"), *ManifestPath, *Chunk.Hash);
+			return false;
+		}
+		OutData.Append(ChunkData);
+	}
+
+	return OutData.Num() == Size && HashBuffer(OutData.GetData(), OutData.Num()) == FileHash;
+}
+
+int32 FBackupStore::CollectGarbage(const FDateTime& Cutoff, int32& OutDeletedChunks)
+{
+	Flush();
+
+	IFileManager& FileManager = IFileManager::Get();
+	OutDeletedChunks = 0;
+
+	// Mark: drop expired manifests and collect the chunks the others use
+	TArray<FString> ManifestNames;
+	FileManager.FindFiles(ManifestNames, *(RootDirectory / TEXT("*.json")), true, false);
+
+	int32 DeletedManifests = 0;
+	TSet<FString> LiveChunks;
+	for (const FString& ManifestName : ManifestNames)
+	{
+		const FString ManifestPath = RootDirectory / ManifestName;
+		if (FileManager.GetTimeStamp(*ManifestPath) < Cutoff)
+		{
+			if (FileManager.Delete(*ManifestPath))
+			{
+				++DeletedManifests;
+			}
+			continue;
+		}
+
+		FString SourceFilePath, PackageName, FileHash;
+		int64 Size = 0;
+		TArray<FChunkRef> Chunks;
+		if (ReadManifest(ManifestPath, SourceFilePath, PackageName, Size, FileHash, Chunks))
+		{
+			for (const FChunkRef& Chunk : Chunks)
+			{
+				LiveChunks.Add(Chunk.Hash);
+			}
+		}
+	}
+
+	// Sweep: delete chunks no manifest uses
+	FScopeLock Lock(&StoreLock);
+	EnsureChunkIndex();
+
+	for (auto It = KnownChunks.CreateIterator(); It; ++It)
+	{
+		if (!LiveChunks.Contains(*It) && FileManager.Delete(*GetChunkPath(*It)))
+		{
+			++OutDeletedChunks;
+			It.RemoveCurrent();
+		}
+	}
+
+	// Snapshots may point at deleted chunks
+	Snapshots.Empty();
+
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Backup store deleted %d manifests and %d chunks"), DeletedManifests, OutDeletedChunks);
+	return DeletedManifests;
+}
+
+void FBackupStore::Flush()
+{
+	for (TFuture<void>& Write : PendingWrites)
+	{
+		Write.Wait();
+	}
+	PendingWrites.Empty();
+}
+
+int64 FBackupStore::GetDiskUsage() const
+{
+	int64 TotalSize = 0;
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.IterateDirectoryStatRecursively(*RootDirectory, [&TotalSize](const TCHAR* Path, const FFileStatData& Stat)
+	{
+		if (!Stat.bIsDirectory)
+		{
+			TotalSize += Stat.FileSize;
+		}
+		return true;
+	});
+	return TotalSize;
+}
+
+bool FBackupStore::Exists(const FString& ManifestPath)
+{
+	{
+		FScopeLock Lock(&PendingLock);
+		if (PendingManifests.Contains(ManifestPath))
+		{
+			return true;
+		}
+	}
+
+	// Checked after the pending set: a manifest leaves it only once it is on disk
+	return FPaths::FileExists(ManifestPath);
+}
+
+bool FBackupStore::IsManifest(const FString& Path)
+{
+	return FPaths::GetExtension(Path) == TEXT("json");
+}
+
+void FBackupStore::WriteBackup(const TArray64<uint8>& Data, const FString& SourceFilePath, const FString& PackageName, const FString& ManifestPath, FString& OutFileHash, TArray<FChunkRef>& OutChunks)
+{
+	int64 ChunkStart = 0;
+	for (int64 ChunkEnd : FindChunkBoundaries(Data.GetData(), Data.Num()))
+	{
+		FChunkRef& Chunk = OutChunks.AddDefaulted_GetRef();
+		Chunk.Size = ChunkEnd - ChunkStart;
+		Chunk.Hash = HashBuffer(Data.GetData() + ChunkStart, Chunk.Size);
+		StoreChunk(Chunk.Hash, Data.GetData() + ChunkStart, Chunk.Size);
+		ChunkStart = ChunkEnd;
+	}
+
+	// The manifest goes last, so a manifest on disk always has all of its chunks
+	OutFileHash = HashBuffer(Data.GetData(), Data.Num());
+	WriteManifest(ManifestPath, SourceFilePath, PackageName, Data.Num(), OutFileHash, OutChunks);
+
+	FScopeLock Lock(&PendingLock);
+	PendingManifests.Remove(ManifestPath);
+}
+
+void FBackupStore::WriteManifest(const FString& ManifestPath, const FString& SourceFilePath, const FString& PackageName, int64 Size, const FString& FileHash, const TArray<FChunkRef>& Chunks) const
+{
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("package"), PackageName);
+	Writer->WriteValue(TEXT("file"), SourceFilePath);
+	Writer->WriteValue(TEXT("size"), Size);
+	Writer->WriteValue(TEXT("hash"), FileHash);
+	Writer->WriteArrayStart(TEXT("chunks"));
+	for (const FChunkRef& Chunk : Chunks)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("hash"), Chunk.Hash);
+		Writer->WriteValue(TEXT("size"), Chunk.Size);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(Json, *ManifestPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Failed to write backup manifest '%s'"), *ManifestPath);
+	}
+}
+
+bool FBackupStore::ReadManifest(const FString& ManifestPath, FString& OutSourceFilePath, FString& OutPackageName, int64& OutSize, FString& OutFileHash, TArray<FChunkRef>& OutChunks)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *ManifestPath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Manifest;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	if (!FJsonSerializer::Deserialize(Reader, Manifest) || !Manifest.IsValid())
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* ChunksArray;
+	if (!Manifest->TryGetArrayField(TEXT("chunks"), ChunksArray)
+		|| !Manifest->TryGetStringField(TEXT("hash"), OutFileHash)
+		|| !Manifest->TryGetNumberField(TEXT("size"), OutSize))
+	{
+		return false;
+	}
+	Manifest->TryGetStringField(TEXT("file"), OutSourceFilePath);
+	Manifest->TryGetStringField(TEXT("package"), OutPackageName);
+
+	OutChunks.Reset(ChunksArray->Num());
+	for (const TSharedPtr<FJsonValue>& ChunkValue : *ChunksArray)
+	{
+		const TSharedPtr<FJsonObject>* ChunkObj;
+		if (!ChunkValue->TryGetObject(ChunkObj))
+		{
+			return false;
+		}
+
+		FChunkRef& Chunk = OutChunks.AddDefaulted_GetRef();
+		(*ChunkObj)->TryGetStringField(TEXT("hash"), Chunk.Hash);
+		(*ChunkObj)->TryGetNumberField(TEXT("size"), Chunk.Size);
+	}
+
+	return true;
+}
+
+TArray<int64> FBackupStore::FindChunkBoundaries(const uint8* Data, int64 Size)
+{
+	const uint64* Gear = BackupStore::GetGearTable();
+
+	TArray<int64> ChunkEnds;
+	int64 ChunkStart = 0;
+	while (ChunkStart < Size)
+	{
+		const int64 MaxEnd = FMath::Min(ChunkStart + BackupStore::MaxChunkSize, Size);
+		int64 ChunkEnd = MaxEnd;
+
+		// The hash only depends on the last 64 bytes, so boundaries realign right after an insertion or deletion
+		uint64 Hash = 0;
+		for (int64 Pos = ChunkStart + BackupStore::MinChunkSize; Pos < MaxEnd; ++Pos)
+		{
+			Hash = (Hash << 1) + Gear[Data[Pos]];
+			if ((Hash & BackupStore::BoundaryMask) == 0)
+			{
+				ChunkEnd = Pos + 1;
+				break;
+			}
+		}
+
+		ChunkEnds.Add(ChunkEnd);
+		ChunkStart = ChunkEnd;
+	}
+
+	return ChunkEnds;
+}
+
+void FBackupStore::StoreChunk(const FString& Hash, const uint8* Data, int64 Size)
+{
+	{
+		FScopeLock Lock(&StoreLock);
+		EnsureChunkIndex();
+		if (KnownChunks.Contains(Hash))
+		{
+			return;
+		}
+	}
+
+	// Compress outside the lock; two workers storing the same new chunk both write identical files
+	TArray<uint8> ChunkFile;
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, (int32)Size);
+	ChunkFile.SetNumUninitialized(1 + CompressedSize);
+	if (FCompression::CompressMemory(NAME_Oodle, ChunkFile.GetData() + 1, CompressedSize, Data, (int32)Size) && CompressedSize < Size)
+	{
+		ChunkFile[0] = BackupStore::ChunkFormatOodle;
+		ChunkFile.SetNum(1 + CompressedSize);
+	}
+	else
+	{
+		ChunkFile[0] = BackupStore::ChunkFormatRaw;
+		ChunkFile.SetNum(1);
+		ChunkFile.Append(Data, (int32)Size);
+	}
+
+	// Write under a temporary name so a chunk file is never seen half written
+	const FString ChunkPath = GetChunkPath(Hash);
+	const FString TempPath = ChunkPath + FString::Printf(TEXT(".%u.tmp"), FPlatformTLS::GetCurrentThreadId());
+	if (!FFileHelper::SaveArrayToFile(ChunkFile, *TempPath) || !IFileManager::Get().Move(*ChunkPath, *TempPath, true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Failed to write backup chunk '%s'"), *ChunkPath);
+		IFileManager::Get().Delete(*TempPath);
+		return;
+	}
+
+	FScopeLock Lock(&StoreLock);
+	KnownChunks.Add(Hash);
+}
+
+bool FBackupStore::LoadChunk(const FChunkRef& Chunk, TArray64<uint8>& OutData) const
+{
+	TArray<uint8> ChunkFile;
+	if (!FFileHelper::LoadFileToArray(ChunkFile, *GetChunkPath(Chunk.Hash), FILEREAD_Silent) || ChunkFile.Num() < 1)
+	{
+		return false;
+	}
+
+	OutData.SetNumUninitialized(Chunk.Size);
+	if (ChunkFile[0] == BackupStore::ChunkFormatOodle)
+	{
+		if (!FCompression::UncompressMemory(NAME_Oodle, OutData.GetData(), (int32)Chunk.Size, ChunkFile.GetData() + 1, ChunkFile.Num() - 1))
+		{
+			return false;
+		}
+	}
+	else if (ChunkFile.Num() - 1 == Chunk.Size)
+	{
+		FMemory::Memcpy(OutData.GetData(), ChunkFile.GetData() + 1, Chunk.Size);
+	}
+	else
+	{
+		return false;
+	}
+
+	return HashBuffer(OutData.GetData(), OutData.Num()) == Chunk.Hash;
+}
+
+FString FBackupStore::GetChunkPath(const FString& Hash) const
+{
+	// Fan out by the first byte so no directory holds every chunk
+	return RootDirectory / TEXT("chunks") / Hash.Left(2) / (Hash + TEXT(".chunk"));
+}
+
+void FBackupStore::EnsureChunkIndex()
+{
+	if (bChunkIndexLoaded)
+	{
+		return;
+	}
+
+	TArray<FString> ChunkFiles;
+	IFileManager::Get().FindFilesRecursive(ChunkFiles, *(RootDirectory / TEXT("chunks")), TEXT("*.chunk"), true, false);
+	for (const FString& ChunkFile : ChunkFiles)
+	{
+		KnownChunks.Add(FPaths::GetBaseFilename(ChunkFile));
+	}
+
+	bChunkIndexLoaded = true;
+}
+
+FString FBackupStore::HashBuffer(const uint8* Data, int64 Size)
+{
+	const FBlake3Hash Hash = FBlake3::HashBuffer(Data, Size);
+	return BytesToHex(Hash.GetBytes(), sizeof(FBlake3Hash::ByteArray));
+}
@@ -0,0 +1,140 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Content-addressed store for package backups.
+ * A backup is a small JSON manifest listing the chunks of the file it captured. Files are split into
+ * content-defined chunks (boundaries follow the bytes, so an edit only changes the chunks around it), and each
+ * chunk is stored once, compressed, under the hash of its contents. Backing up a package that barely changed
+ * only writes a manifest and the few chunks that differ.
+ * The file is read when the backup is created; chunking, compression and disk writes run on a worker thread.
+ */
+class FBackupStore
+{
+public:
+
+	/**
+	 * @param InRootDirectory Directory holding the manifests, with chunks under "chunks/"
+	 */
+	explicit FBackupStore(const FString& InRootDirectory);
+
+	/** Waits for pending writes */
+	~FBackupStore();
+
+	/**
+	 * Back up a file
+	 * @param SourceFilePath File to capture (read before returning)
+	 * @param PackageName Package the file belongs to
+	 * @param ManifestPath Where to write the manifest
+	 * @return False if the file could not be read
+	 */
+	bool Add(const FString& SourceFilePath, const FString& PackageName, const FString& ManifestPath);
+
+	/**
+	 * Back up file contents already in memory
+	 * @param Data File contents
+	 * @param SourceFilePath File the contents belong to (restore target)
+	 * @param PackageName Package the file belongs to
+	 * @param ManifestPath Where to write the manifest
+	 */
+	void AddData(TArray64<uint8>&& Data, const FString& SourceFilePath, const FString& PackageName, const FString& ManifestPath);
+
+	/**
+	 * Reassemble a backed up file (waits if the backup is still being written)
+	 * @param ManifestPath Manifest of the backup
+	 * @param OutData File contents
+	 * @param OutSourceFilePath File the backup was taken from
+	 * @param OutPackageName Package the file belongs to
+	 * @return False if the manifest or one of its chunks is missing or corrupt
+	 */
+	bool Read(const FString& ManifestPath, TArray64<uint8>& OutData, FString& OutSourceFilePath, FString& OutPackageName);
+
+	/**
+	 * Delete manifests created before a cutoff, then every chunk no remaining manifest uses
+	 * @param Cutoff Manifests older than this are deleted
+	 * @param OutDeletedChunks Number of chunk files deleted
+	 * @return Number of manifests deleted
+	 */
+	int32 CollectGarbage(const FDateTime& Cutoff, int32& OutDeletedChunks);
+
+	/** Wait for all pending writes */
+	void Flush();
+
+	/** Bytes used on disk by manifests and chunks */
+	int64 GetDiskUsage() const;
+
+	/** Check if a manifest exists, counting ones still being written */
+	bool Exists(const FString& ManifestPath);
+
+	/** Check if a path is a manifest of this store */
+	static bool IsManifest(const FString& Path);
+
+private:
+
+	struct FChunkRef
+	{
+		FString Hash;
+		int64 Size = 0;
+	};
+
+	/** Last backup of a file, reused while the file's size and timestamp stay the same */
+	struct FFileSnapshot
+	{
+		int64 Size = 0;
+		FDateTime TimeStamp;
+		FString FileHash;
+		TArray<FChunkRef> Chunks;
+	};
+
+	/** Chunk, compress and write a backup (worker thread) */
+	void WriteBackup(const TArray64<uint8>& Data, const FString& SourceFilePath, const FString& PackageName, const FString& ManifestPath, FString& OutFileHash, TArray<FChunkRef>& OutChunks);
+
+	/** Write a manifest file */
+	void WriteManifest(const FString& ManifestPath, const FString& SourceFilePath, const FString& PackageName, int64 Size, const FString& FileHash, const TArray<FChunkRef>& Chunks) const;
+
+	/** Parse a manifest file */
+	static bool ReadManifest(const FString& ManifestPath, FString& OutSourceFilePath, FString& OutPackageName, int64& OutSize, FString& OutFileHash, TArray<FChunkRef>& OutChunks);
+
+	/** Split data at content-defined boundaries (returns chunk end offsets) */
+	static TArray<int64> FindChunkBoundaries(const uint8* Data, int64 Size);
+
+	/** Compress and write a chunk unless it is already stored (worker thread) */
+	void StoreChunk(const FString& Hash, const uint8* Data, int64 Size);
+
+	/** Read and decompress a chunk */
+	bool LoadChunk(const FChunkRef& Chunk, TArray64<uint8>& OutData) const;
+
+	/** Path of a chunk file */
+	FString GetChunkPath(const FString& Hash) const;
+
+	/** Scan the chunk directory once (StoreLock held) */
+	void EnsureChunkIndex();
+
+	/** Hash of a buffer as a hex string */
+	static FString HashBuffer(const uint8* Data, int64 Size);
+
+	/** Root directory */
+	FString RootDirectory;
+
+	/** Guards the chunk index, snapshots and chunk writes and deletes */
+	mutable FCriticalSection StoreLock;
+
+	/** Hashes of the stored chunks */
+	TSet<FString> KnownChunks;
+	bool bChunkIndexLoaded;
+
+	/** Source file -> last backup */
+	TMap<FString, FFileSnapshot> Snapshots;
+
+	/** Manifests still being written */
+	FCriticalSection PendingLock;
+	TSet<FString> PendingManifests;
+
+	/** Writes in flight (game thread only) */
+	TArray<TFuture<void>> PendingWrites;
+};
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "BlueprintEditHandler.h"
+#include "AssetIndex.h"
+#include "TransactionManager.h"
 #include "Engine/Blueprint.h"
 #include "UObject/UnrealType.h"
 #include "UObject/PropertyPortFlags.h"
@@ -27,25 +29,11 @@
 
 UBlueprint* FBlueprintEditHandler::FindBlueprint(const FString& BlueprintName)
 {
-	// Get asset registry
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	// Search for blueprint by name
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetDataList, true);
-
-	for (const FAssetData& AssetData : AssetDataList)
+	// Search for blueprint by name (exact first, then partial)
+	FAssetData AssetData;
+	if (FAssetIndex::Get().FindByName(BlueprintName, EIndexedAssetKind::Blueprint, AssetData))
 	{
-		if (AssetData.AssetName.ToString().Equals(BlueprintName, ESearchCase::IgnoreCase) ||
-			AssetData.AssetName.ToString().Contains(BlueprintName, ESearchCase::IgnoreCase))
-		{
-			UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
-			if (Blueprint)
-			{
-				return Blueprint;
-			}
-		}
+		return Cast<UBlueprint>(AssetData.GetAsset());
 	}
 
 	return nullptr;
@@ -88,6 +76,9 @@ bool FBlueprintEditHandler::EditBlueprintProperty(UBlueprint* Blueprint, const F
 	// Mark the package dirty
 	Blueprint->MarkPackageDirty();
 
+	// Keep both values so an active transaction can undo and redo the edit without touching the file
+	FTransactionManager::Get().RecordPropertyChange(Blueprint, PropertyName, OutOldValue, GetPropertyValue(CDO, Property));
+
 	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Successfully edited property '%s' on '%s' (old: '%s', new: '%s')"),
 		*PropertyName.ToString(), *Blueprint->GetName(), *OutOldValue, *Value);
 
@@ -166,7 +157,7 @@ FString FBlueprintEditHandler::GetPropertyValue(const UObject* CDO, const FPrope
 	return ExportPropertyValue(Property, ValuePtr);
 }
 
-bool FBlueprintEditHandler::CompileBlueprint(UBlueprint* Blueprint)
+bool FBlueprintEditHandler::CompileBlueprint(UBlueprint* Blueprint, bool bCollectGarbage)
 {
 	if (!Blueprint)
 	{
@@ -174,7 +165,7 @@ bool FBlueprintEditHandler::CompileBlueprint(UBlueprint* Blueprint)
 	}
 
 	// Compile the blueprint
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None);
+	FKismetEditorUtilities::CompileBlueprint(Blueprint, bCollectGarbage ? EBlueprintCompileOptions::None : EBlueprintCompileOptions::SkipGarbageCollection);
 
 	// Check compilation status
 	if (Blueprint->Status == BS_Error)
@@ -187,6 +178,30 @@ bool FBlueprintEditHandler::CompileBlueprint(UBlueprint* Blueprint)
 	return true;
 }
 
+int32 FBlueprintEditHandler::CompileBlueprints(const TArray<UBlueprint*>& Blueprints, TArray<UBlueprint*>& OutFailed)
+{
+	int32 NumCompiled = 0;
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		if (CompileBlueprint(Blueprint, false))
+		{
+			++NumCompiled;
+		}
+		else
+		{
+			OutFailed.Add(Blueprint);
+		}
+	}
+
+	// Reinstancing leaves the old classes behind; one collection clears them for every compile
+	if (Blueprints.Num() > 0)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	return NumCompiled;
+}
+
 bool FBlueprintEditHandler::SaveBlueprint(UBlueprint* Blueprint)
 {
 	if (!Blueprint)
@@ -222,6 +237,49 @@ bool FBlueprintEditHandler::SaveBlueprint(UBlueprint* Blueprint)
 	return bSaved;
 }
 
+int32 FBlueprintEditHandler::SaveBlueprints(const TArray<UBlueprint*>& Blueprints, TArray<UBlueprint*>& OutFailed)
+{
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_NoError | SAVE_Async;
+
+	int32 NumSaved = 0;
+	TSet<UPackage*> SavedPackages;
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		UPackage* Package = Blueprint ? Blueprint->GetOutermost() : nullptr;
+		if (!Package)
+		{
+			OutFailed.Add(Blueprint);
+			continue;
+		}
+
+		bool bAlreadySaved = false;
+		SavedPackages.Add(Package, &bAlreadySaved);
+		if (bAlreadySaved || !Package->IsDirty())
+		{
+			continue;
+		}
+
+		// Serializes now, the file write is queued and overlaps with the next package
+		FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (UPackage::SavePackage(Package, nullptr, *PackageFileName, SaveArgs))
+		{
+			++NumSaved;
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Failed to save blueprint '%s'"), *Blueprint->GetName());
+			OutFailed.Add(Blueprint);
+		}
+	}
+
+	UPackage::WaitForAsyncFileWrites();
+
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Saved %d blueprint packages"), NumSaved);
+	return NumSaved;
+}
+
 void FBlueprintEditHandler::CleanupAfterEdit(UBlueprint* Blueprint)
 {
 	// Force garbage collection to free memory
@@ -491,7 +549,7 @@ bool FBlueprintEditHandler::RemoveGraphNode(UBlueprint* Blueprint, const FString
 // Component Editing Capabilities
 // ============================================================================
 
-FString FBlueprintEditHandler::AddComponent(UBlueprint* Blueprint, const FString& ComponentClassName, const FString& ComponentName, const FString& ParentName, FString& OutError)
+FString FBlueprintEditHandler::AddComponent(UBlueprint* Blueprint, const FString& ComponentClassName, const FString& ComponentName, const FString& ParentName, FString& OutError, bool bCompile)
 {
 	if (!Blueprint || !Blueprint->SimpleConstructionScript)
 	{
@@ -535,12 +593,19 @@ FString FBlueprintEditHandler::AddComponent(UBlueprint* Blueprint, const FString
 	}
 
 	// Recompile to update the blueprint
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	if (bCompile)
+	{
+		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	}
+	else
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	}
 
 	return NewNode->GetVariableName().ToString();
 }
 
-bool FBlueprintEditHandler::RemoveComponent(UBlueprint* Blueprint, const FString& ComponentName, FString& OutError)
+bool FBlueprintEditHandler::RemoveComponent(UBlueprint* Blueprint, const FString& ComponentName, FString& OutError, bool bCompile)
 {
 	if (!Blueprint || !Blueprint->SimpleConstructionScript)
 	{
@@ -558,7 +623,14 @@ bool FBlueprintEditHandler::RemoveComponent(UBlueprint* Blueprint, const FString
 	Blueprint->SimpleConstructionScript->RemoveNode(Node);
 	
 	// Recompile
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	if (bCompile)
+	{
+		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	}
+	else
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	}
 	
 	return true;
 }
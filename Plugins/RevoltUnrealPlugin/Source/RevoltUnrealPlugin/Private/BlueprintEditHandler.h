@@ -62,9 +62,18 @@ public:
 	/**
 	 * Compile a blueprint after modification
 	 * @param Blueprint Blueprint to compile
+	 * @param bCollectGarbage Collect garbage after compiling (skip when compiling several blueprints in a row)
 	 * @return True if compilation successful
 	 */
-	static bool CompileBlueprint(UBlueprint* Blueprint);
+	static bool CompileBlueprint(UBlueprint* Blueprint, bool bCollectGarbage = true);
+
+	/**
+	 * Compile several blueprints, collecting garbage once at the end instead of after every compile
+	 * @param Blueprints Blueprints to compile
+	 * @param OutFailed Blueprints that failed to compile
+	 * @return Number of blueprints compiled successfully
+	 */
+	static int32 CompileBlueprints(const TArray<UBlueprint*>& Blueprints, TArray<UBlueprint*>& OutFailed);
 
 	/**
 	 * Save a blueprint to disk
@@ -73,6 +82,15 @@ public:
 	 */
 	static bool SaveBlueprint(UBlueprint* Blueprint);
 
+	/**
+	 * Save the packages of several blueprints in one pass. Packages are serialized on the game thread and written
+	 * to disk asynchronously; returns once every write has finished. Packages that are not dirty are skipped.
+	 * @param Blueprints Blueprints to save
+	 * @param OutFailed Blueprints that failed to save
+	 * @return Number of packages saved
+	 */
+	static int32 SaveBlueprints(const TArray<UBlueprint*>& Blueprints, TArray<UBlueprint*>& OutFailed);
+
 	/**
 	 * Mark blueprint for garbage collection cleanup
 	 * @param Blueprint Blueprint to cleanup
@@ -154,18 +172,20 @@ public:
 	 * @param ComponentName Name for the new component
 	 * @param ParentName Name of parent component (optional)
 	 * @param OutError Error message
+	 * @param bCompile Recompile the blueprint (false when the caller compiles once after several edits)
 	 * @return Name of created component
 	 */
-	static FString AddComponent(UBlueprint* Blueprint, const FString& ComponentClassName, const FString& ComponentName, const FString& ParentName, FString& OutError);
+	static FString AddComponent(UBlueprint* Blueprint, const FString& ComponentClassName, const FString& ComponentName, const FString& ParentName, FString& OutError, bool bCompile = true);
 
 	/**
 	 * Remove a component from the blueprint
 	 * @param Blueprint Target blueprint
 	 * @param ComponentName Name of component variable to remove
 	 * @param OutError Error message
+	 * @param bCompile Recompile the blueprint (false when the caller compiles once after several edits)
 	 * @return True if successful
 	 */
-	static bool RemoveComponent(UBlueprint* Blueprint, const FString& ComponentName, FString& OutError);
+	static bool RemoveComponent(UBlueprint* Blueprint, const FString& ComponentName, FString& OutError, bool bCompile = true);
 
 private:
 
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "BlueprintQueryHandler.h"
+#include "AssetIndex.h"
+#include "JsonPageWriter.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Engine/Blueprint.h"
@@ -11,70 +13,69 @@
 #include "UObject/UnrealType.h"
 #include "UObject/Class.h"
 
-TSharedPtr<FJsonObject> FBlueprintQueryHandler::GetAllBlueprints(const FQueryOptions& Options)
+FString FBlueprintQueryHandler::GetAllBlueprints(const FQueryOptions& Options, const FPageOptions& Page)
 {
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	TArray<TSharedPtr<FJsonValue>> BlueprintArray;
-
-	// Get asset registry
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
 	// Query all blueprint assets
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetDataList, true);
+	TArray<FAssetData> AssetDataList = FAssetIndex::Get().GetAssetsOfKind(EIndexedAssetKind::Blueprint);
 
 	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Found %d blueprints"), AssetDataList.Num());
 
-	for (const FAssetData& AssetData : AssetDataList)
+	// Blueprints only need loading when the projection asks for something the registry does not have
+	static const TCHAR* LoadedFields[] = { TEXT("generated_class"), TEXT("parent_class"), TEXT("blueprint_type"), TEXT("graph_count"), TEXT("properties"), TEXT("functions"), TEXT("graphs") };
+	const FFieldSelection& Fields = Options.Fields;
+	bool bNeedsLoad = false;
+	for (const TCHAR* Field : LoadedFields)
+	{
+		bNeedsLoad |= !Fields.IsAll() && Fields.Select(Field) != nullptr;
+	}
+
+	// Only blueprints on the requested page are loaded
+	FJsonPageWriter Writer(TEXT("blueprints"));
+	return Writer.WriteAssetPage(AssetDataList, Page, [&Options, &Fields, bNeedsLoad](const FAssetData& AssetData)
 	{
 		TSharedPtr<FJsonObject> BlueprintJson = MakeShared<FJsonObject>();
 		
 		// Basic info without loading the asset
 		BlueprintJson->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
-		BlueprintJson->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
-		BlueprintJson->SetStringField(TEXT("class"), AssetData.AssetClassPath.ToString());
+		if (Fields.Select(TEXT("path")))
+		{
+			BlueprintJson->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
+		}
+		if (Fields.Select(TEXT("class")))
+		{
+			BlueprintJson->SetStringField(TEXT("class"), AssetData.AssetClassPath.ToString());
+		}
 
-		// If we need more detailed info, load the asset
-		if (Options.DepthLevel != EQueryDepth::Basic)
+		if (bNeedsLoad)
 		{
 			UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
-			if (Blueprint)
+			TSharedPtr<FJsonObject> BlueprintInfo = Blueprint ? ExtractBlueprintInfo(Blueprint, Options) : nullptr;
+			if (BlueprintInfo)
 			{
-				ExtractBlueprintInfo(Blueprint, Options);
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : BlueprintInfo->Values)
+				{
+					if (Field.Key != TEXT("success") && !BlueprintJson->HasField(Field.Key))
+					{
+						BlueprintJson->SetField(Field.Key, Field.Value);
+					}
+				}
 			}
 		}
 
-		BlueprintArray.Add(MakeShared<FJsonValueObject>(BlueprintJson));
-	}
-
-	Result->SetArrayField(TEXT("blueprints"), BlueprintArray);
-	Result->SetNumberField(TEXT("count"), BlueprintArray.Num());
-	Result->SetBoolField(TEXT("success"), true);
-
-	return Result;
+		return BlueprintJson;
+	});
 }
 
 TSharedPtr<FJsonObject> FBlueprintQueryHandler::GetBlueprint(const FString& BlueprintName, const FQueryOptions& Options)
 {
-	// Get asset registry
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	// Search for blueprint by name
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetDataList, true);
-
-	for (const FAssetData& AssetData : AssetDataList)
+	// Search for blueprint by name (exact first, then partial)
+	FAssetData AssetData;
+	if (FAssetIndex::Get().FindByName(BlueprintName, EIndexedAssetKind::Blueprint, AssetData))
 	{
-		if (AssetData.AssetName.ToString().Equals(BlueprintName, ESearchCase::IgnoreCase) ||
-			AssetData.AssetName.ToString().Contains(BlueprintName, ESearchCase::IgnoreCase))
+		UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+		if (Blueprint)
 		{
-			UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
-			if (Blueprint)
-			{
-				return ExtractBlueprintInfo(Blueprint, Options);
-			}
+			return ExtractBlueprintInfo(Blueprint, Options);
 		}
 	}
 
@@ -91,24 +92,24 @@ TSharedPtr<FJsonObject> FBlueprintQueryHandler::ExtractBlueprintInfo(UBlueprint*
 	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
 
 	// Always extract basic info
-	ExtractBasicInfo(Blueprint, JsonObject);
+	ExtractBasicInfo(Blueprint, JsonObject, Options.Fields);
 
 	// Extract properties if requested
-	if (Options.bIncludeProperties)
+	if (const FFieldSelection* PropertyFields = Options.Fields.Select(TEXT("properties"), Options.bIncludeProperties))
 	{
-		ExtractProperties(Blueprint, JsonObject, Options);
+		ExtractProperties(Blueprint, JsonObject, Options, *PropertyFields);
 	}
 
 	// Extract functions if requested
-	if (Options.bIncludeFunctions)
+	if (const FFieldSelection* FunctionFields = Options.Fields.Select(TEXT("functions"), Options.bIncludeFunctions))
 	{
-		ExtractFunctions(Blueprint, JsonObject, Options);
+		ExtractFunctions(Blueprint, JsonObject, Options, *FunctionFields);
 	}
 
 	// Extract graph nodes if requested
-	if (Options.bIncludeGraphNodes)
+	if (const FFieldSelection* GraphFields = Options.Fields.Select(TEXT("graphs"), Options.bIncludeGraphNodes))
 	{
-		ExtractGraphNodes(Blueprint, JsonObject, Options);
+		ExtractGraphNodes(Blueprint, JsonObject, Options, *GraphFields);
 	}
 
 	JsonObject->SetBoolField(TEXT("success"), true);
@@ -116,26 +117,38 @@ TSharedPtr<FJsonObject> FBlueprintQueryHandler::ExtractBlueprintInfo(UBlueprint*
 	return JsonObject;
 }
 
-void FBlueprintQueryHandler::ExtractBasicInfo(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject)
+void FBlueprintQueryHandler::ExtractBasicInfo(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FFieldSelection& Fields)
 {
 	JsonObject->SetStringField(TEXT("name"), Blueprint->GetName());
-	JsonObject->SetStringField(TEXT("path"), Blueprint->GetPathName());
+	if (Fields.Select(TEXT("path")))
+	{
+		JsonObject->SetStringField(TEXT("path"), Blueprint->GetPathName());
+	}
 	
 	if (Blueprint->GeneratedClass)
 	{
-		JsonObject->SetStringField(TEXT("generated_class"), Blueprint->GeneratedClass->GetName());
+		if (Fields.Select(TEXT("generated_class")))
+		{
+			JsonObject->SetStringField(TEXT("generated_class"), Blueprint->GeneratedClass->GetName());
+		}
 		
-		if (Blueprint->GeneratedClass->GetSuperClass())
+		if (Blueprint->GeneratedClass->GetSuperClass() && Fields.Select(TEXT("parent_class")))
 		{
 			JsonObject->SetStringField(TEXT("parent_class"), Blueprint->GeneratedClass->GetSuperClass()->GetName());
 		}
 	}
 
-	JsonObject->SetStringField(TEXT("blueprint_type"), *UEnum::GetValueAsString(Blueprint->BlueprintType));
-	JsonObject->SetNumberField(TEXT("graph_count"), Blueprint->UbergraphPages.Num());
+	if (Fields.Select(TEXT("blueprint_type")))
+	{
+		JsonObject->SetStringField(TEXT("blueprint_type"), *UEnum::GetValueAsString(Blueprint->BlueprintType));
+	}
+	if (Fields.Select(TEXT("graph_count")))
+	{
+		JsonObject->SetNumberField(TEXT("graph_count"), Blueprint->UbergraphPages.Num());
+	}
 }
 
-void FBlueprintQueryHandler::ExtractProperties(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options)
+void FBlueprintQueryHandler::ExtractProperties(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options, const FFieldSelection& Fields)
 {
 	TArray<TSharedPtr<FJsonValue>> PropertiesArray;
 
@@ -144,14 +157,27 @@ void FBlueprintQueryHandler::ExtractProperties(UBlueprint* Blueprint, TSharedPtr
 		for (TFieldIterator<FProperty> PropIt(Blueprint->GeneratedClass); PropIt; ++PropIt)
 		{
 			FProperty* Property = *PropIt;
+
+			// Skip properties outside the projection before reading anything else
+			const FFieldSelection* PropertyFields = Fields.SelectElement(Property->GetName());
+			if (!PropertyFields)
+			{
+				continue;
+			}
 			
 			TSharedPtr<FJsonObject> PropertyJson = MakeShared<FJsonObject>();
 			PropertyJson->SetStringField(TEXT("name"), Property->GetName());
-			PropertyJson->SetStringField(TEXT("type"), Property->GetCPPType());
-			PropertyJson->SetStringField(TEXT("category"), Property->GetMetaData(TEXT("Category")));
+			if (PropertyFields->Select(TEXT("type")))
+			{
+				PropertyJson->SetStringField(TEXT("type"), Property->GetCPPType());
+			}
+			if (PropertyFields->Select(TEXT("category")))
+			{
+				PropertyJson->SetStringField(TEXT("category"), Property->GetMetaData(TEXT("Category")));
+			}
 
 			// Extract default value if requested
-			if (Options.bIncludeDefaultValues && Blueprint->GeneratedClass->GetDefaultObject())
+			if (PropertyFields->Select(TEXT("default_value"), Options.bIncludeDefaultValues) && Blueprint->GeneratedClass->GetDefaultObject())
 			{
 				const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Blueprint->GeneratedClass->GetDefaultObject());
 				FString DefaultValue = GetPropertyValueAsString(Property, ValuePtr);
@@ -165,7 +191,7 @@ void FBlueprintQueryHandler::ExtractProperties(UBlueprint* Blueprint, TSharedPtr
 	JsonObject->SetArrayField(TEXT("properties"), PropertiesArray);
 }
 
-void FBlueprintQueryHandler::ExtractFunctions(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options)
+void FBlueprintQueryHandler::ExtractFunctions(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options, const FFieldSelection& Fields)
 {
 	TArray<TSharedPtr<FJsonValue>> FunctionsArray;
 
@@ -174,21 +200,39 @@ void FBlueprintQueryHandler::ExtractFunctions(UBlueprint* Blueprint, TSharedPtr<
 		for (TFieldIterator<UFunction> FuncIt(Blueprint->GeneratedClass, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
 		{
 			UFunction* Function = *FuncIt;
+
+			const FFieldSelection* FunctionFields = Fields.SelectElement(Function->GetName());
+			if (!FunctionFields)
+			{
+				continue;
+			}
 			
 			TSharedPtr<FJsonObject> FunctionJson = MakeShared<FJsonObject>();
 			FunctionJson->SetStringField(TEXT("name"), Function->GetName());
 			
 			// Extract parameters
-			TArray<TSharedPtr<FJsonValue>> ParamsArray;
-			for (TFieldIterator<FProperty> ParamIt(Function); ParamIt; ++ParamIt)
+			if (const FFieldSelection* ParamFields = FunctionFields->Select(TEXT("parameters")))
 			{
-				FProperty* Param = *ParamIt;
-				TSharedPtr<FJsonObject> ParamJson = MakeShared<FJsonObject>();
-				ParamJson->SetStringField(TEXT("name"), Param->GetName());
-				ParamJson->SetStringField(TEXT("type"), Param->GetCPPType());
-				ParamsArray.Add(MakeShared<FJsonValueObject>(ParamJson));
+				TArray<TSharedPtr<FJsonValue>> ParamsArray;
+				for (TFieldIterator<FProperty> ParamIt(Function); ParamIt; ++ParamIt)
+				{
+					FProperty* Param = *ParamIt;
+					const FFieldSelection* ParamSelection = ParamFields->SelectElement(Param->GetName());
+					if (!ParamSelection)
+					{
+						continue;
+					}
+
+					TSharedPtr<FJsonObject> ParamJson = MakeShared<FJsonObject>();
+					ParamJson->SetStringField(TEXT("name"), Param->GetName());
+					if (ParamSelection->Select(TEXT("type")))
+					{
+						ParamJson->SetStringField(TEXT("type"), Param->GetCPPType());
+					}
+					ParamsArray.Add(MakeShared<FJsonValueObject>(ParamJson));
+				}
+				FunctionJson->SetArrayField(TEXT("parameters"), ParamsArray);
 			}
-			FunctionJson->SetArrayField(TEXT("parameters"), ParamsArray);
 
 			FunctionsArray.Add(MakeShared<FJsonValueObject>(FunctionJson));
 		}
@@ -197,16 +241,17 @@ void FBlueprintQueryHandler::ExtractFunctions(UBlueprint* Blueprint, TSharedPtr<
 	JsonObject->SetArrayField(TEXT("functions"), FunctionsArray);
 }
 
-void FBlueprintQueryHandler::ExtractGraphNodes(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options)
+void FBlueprintQueryHandler::ExtractGraphNodes(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options, const FFieldSelection& Fields)
 {
 	TArray<TSharedPtr<FJsonValue>> GraphsArray;
 
 	// Extract all graphs
 	for (UEdGraph* Graph : Blueprint->UbergraphPages)
 	{
-		if (Graph)
+		const FFieldSelection* GraphFields = Graph ? Fields.SelectElement(Graph->GetName()) : nullptr;
+		if (GraphFields)
 		{
-			TSharedPtr<FJsonObject> GraphJson = ExtractGraph(Graph, Options);
+			TSharedPtr<FJsonObject> GraphJson = ExtractGraph(Graph, Options, *GraphFields);
 			if (GraphJson)
 			{
 				GraphsArray.Add(MakeShared<FJsonValueObject>(GraphJson));
@@ -217,9 +262,10 @@ void FBlueprintQueryHandler::ExtractGraphNodes(UBlueprint* Blueprint, TSharedPtr
 	// Extract function graphs
 	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
 	{
-		if (Graph)
+		const FFieldSelection* GraphFields = Graph ? Fields.SelectElement(Graph->GetName()) : nullptr;
+		if (GraphFields)
 		{
-			TSharedPtr<FJsonObject> GraphJson = ExtractGraph(Graph, Options);
+			TSharedPtr<FJsonObject> GraphJson = ExtractGraph(Graph, Options, *GraphFields);
 			if (GraphJson)
 			{
 				GraphsArray.Add(MakeShared<FJsonValueObject>(GraphJson));
@@ -230,7 +276,7 @@ void FBlueprintQueryHandler::ExtractGraphNodes(UBlueprint* Blueprint, TSharedPtr
 	JsonObject->SetArrayField(TEXT("graphs"), GraphsArray);
 }
 
-TSharedPtr<FJsonObject> FBlueprintQueryHandler::ExtractGraph(UEdGraph* Graph, const FQueryOptions& Options)
+TSharedPtr<FJsonObject> FBlueprintQueryHandler::ExtractGraph(UEdGraph* Graph, const FQueryOptions& Options, const FFieldSelection& Fields)
 {
 	if (!Graph)
 	{
@@ -239,28 +285,35 @@ TSharedPtr<FJsonObject> FBlueprintQueryHandler::ExtractGraph(UEdGraph* Graph, co
 
 	TSharedPtr<FJsonObject> GraphJson = MakeShared<FJsonObject>();
 	GraphJson->SetStringField(TEXT("name"), Graph->GetName());
-	GraphJson->SetNumberField(TEXT("node_count"), Graph->Nodes.Num());
+	if (Fields.Select(TEXT("node_count")))
+	{
+		GraphJson->SetNumberField(TEXT("node_count"), Graph->Nodes.Num());
+	}
 
-	// Extract nodes
-	TArray<TSharedPtr<FJsonValue>> NodesArray;
-	for (UEdGraphNode* Node : Graph->Nodes)
+	// Extract nodes (selected by class, since titles are not unique)
+	if (const FFieldSelection* NodeFields = Fields.Select(TEXT("nodes")))
 	{
-		if (Node)
+		TArray<TSharedPtr<FJsonValue>> NodesArray;
+		for (UEdGraphNode* Node : Graph->Nodes)
 		{
-			TSharedPtr<FJsonObject> NodeJson = ExtractNode(Node, Options);
-			if (NodeJson)
+			const FFieldSelection* NodeSelection = Node ? NodeFields->SelectElement(Node->GetClass()->GetName()) : nullptr;
+			if (NodeSelection)
 			{
-				NodesArray.Add(MakeShared<FJsonValueObject>(NodeJson));
+				TSharedPtr<FJsonObject> NodeJson = ExtractNode(Node, Options, *NodeSelection);
+				if (NodeJson)
+				{
+					NodesArray.Add(MakeShared<FJsonValueObject>(NodeJson));
+				}
 			}
 		}
-	}
 
-	GraphJson->SetArrayField(TEXT("nodes"), NodesArray);
+		GraphJson->SetArrayField(TEXT("nodes"), NodesArray);
+	}
 
 	return GraphJson;
 }
 
-TSharedPtr<FJsonObject> FBlueprintQueryHandler::ExtractNode(UEdGraphNode* Node, const FQueryOptions& Options)
+TSharedPtr<FJsonObject> FBlueprintQueryHandler::ExtractNode(UEdGraphNode* Node, const FQueryOptions& Options, const FFieldSelection& Fields)
 {
 	if (!Node)
 	{
@@ -272,32 +325,42 @@ TSharedPtr<FJsonObject> FBlueprintQueryHandler::ExtractNode(UEdGraphNode* Node,
 	NodeJson->SetStringField(TEXT("class"), Node->GetClass()->GetName());
 
 	// Extract pins and connections
-	if (Options.bIncludeConnections)
+	if (const FFieldSelection* PinFields = Fields.Select(TEXT("pins"), Options.bIncludeConnections))
 	{
 		TArray<TSharedPtr<FJsonValue>> PinsArray;
 		
 		for (UEdGraphPin* Pin : Node->Pins)
 		{
-			if (Pin)
+			const FFieldSelection* PinSelection = Pin ? PinFields->SelectElement(Pin->PinName.ToString()) : nullptr;
+			if (PinSelection)
 			{
 				TSharedPtr<FJsonObject> PinJson = MakeShared<FJsonObject>();
 				PinJson->SetStringField(TEXT("name"), Pin->PinName.ToString());
-				PinJson->SetStringField(TEXT("type"), Pin->PinType.PinCategory.ToString());
-				PinJson->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("input") : TEXT("output"));
+				if (PinSelection->Select(TEXT("type")))
+				{
+					PinJson->SetStringField(TEXT("type"), Pin->PinType.PinCategory.ToString());
+				}
+				if (PinSelection->Select(TEXT("direction")))
+				{
+					PinJson->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("input") : TEXT("output"));
+				}
 
 				// Extract connections
-				TArray<TSharedPtr<FJsonValue>> ConnectionsArray;
-				for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				if (PinSelection->Select(TEXT("connections")))
 				{
-					if (LinkedPin && LinkedPin->GetOwningNode())
+					TArray<TSharedPtr<FJsonValue>> ConnectionsArray;
+					for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
 					{
-						TSharedPtr<FJsonObject> ConnectionJson = MakeShared<FJsonObject>();
-						ConnectionJson->SetStringField(TEXT("node"), LinkedPin->GetOwningNode()->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
-						ConnectionJson->SetStringField(TEXT("pin"), LinkedPin->PinName.ToString());
-						ConnectionsArray.Add(MakeShared<FJsonValueObject>(ConnectionJson));
+						if (LinkedPin && LinkedPin->GetOwningNode())
+						{
+							TSharedPtr<FJsonObject> ConnectionJson = MakeShared<FJsonObject>();
+							ConnectionJson->SetStringField(TEXT("node"), LinkedPin->GetOwningNode()->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
+							ConnectionJson->SetStringField(TEXT("pin"), LinkedPin->PinName.ToString());
+							ConnectionsArray.Add(MakeShared<FJsonValueObject>(ConnectionJson));
+						}
 					}
+					PinJson->SetArrayField(TEXT("connections"), ConnectionsArray);
 				}
-				PinJson->SetArrayField(TEXT("connections"), ConnectionsArray);
 
 				PinsArray.Add(MakeShared<FJsonValueObject>(PinJson));
 			}
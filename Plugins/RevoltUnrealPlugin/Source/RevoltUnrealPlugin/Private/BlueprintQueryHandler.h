@@ -18,8 +18,8 @@ class FBlueprintQueryHandler
 {
 public:
 
-	/** Get all blueprints in the project */
-	static TSharedPtr<FJsonObject> GetAllBlueprints(const FQueryOptions& Options);
+	/** Get a page of the blueprints in the project (returns response JSON) */
+	static FString GetAllBlueprints(const FQueryOptions& Options, const FPageOptions& Page);
 
 	/** Get specific blueprint by name */
 	static TSharedPtr<FJsonObject> GetBlueprint(const FString& BlueprintName, const FQueryOptions& Options);
@@ -30,22 +30,22 @@ public:
 private:
 
 	/** Extract basic blueprint info */
-	static void ExtractBasicInfo(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject);
+	static void ExtractBasicInfo(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FFieldSelection& Fields);
 
-	/** Extract properties from blueprint */
-	static void ExtractProperties(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options);
+	/** Extract properties from blueprint (Fields is the selection below "properties") */
+	static void ExtractProperties(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options, const FFieldSelection& Fields);
 
-	/** Extract functions from blueprint */
-	static void ExtractFunctions(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options);
+	/** Extract functions from blueprint (Fields is the selection below "functions") */
+	static void ExtractFunctions(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options, const FFieldSelection& Fields);
 
-	/** Extract graph nodes from blueprint */
-	static void ExtractGraphNodes(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options);
+	/** Extract graph nodes from blueprint (Fields is the selection below "graphs") */
+	static void ExtractGraphNodes(UBlueprint* Blueprint, TSharedPtr<FJsonObject>& JsonObject, const FQueryOptions& Options, const FFieldSelection& Fields);
 
 	/** Extract single graph information */
-	static TSharedPtr<FJsonObject> ExtractGraph(UEdGraph* Graph, const FQueryOptions& Options);
+	static TSharedPtr<FJsonObject> ExtractGraph(UEdGraph* Graph, const FQueryOptions& Options, const FFieldSelection& Fields);
 
 	/** Extract node information */
-	static TSharedPtr<FJsonObject> ExtractNode(UEdGraphNode* Node, const FQueryOptions& Options);
+	static TSharedPtr<FJsonObject> ExtractNode(UEdGraphNode* Node, const FQueryOptions& Options, const FFieldSelection& Fields);
 
 	/** Get property value as string */
 	static FString GetPropertyValueAsString(FProperty* Property, const void* ValuePtr);
@@ -4,10 +4,51 @@
 #include "BlueprintEditHandler.h"
 #include "BackupManager.h"
 #include "Engine/Blueprint.h"
+#include "EdGraph/EdGraphNode.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Dom/JsonValue.h"
 
+FBulkPhaseTimer::FBulkPhaseTimer()
+	: StartTime(FPlatformTime::Seconds())
+	, PhaseStartTime(StartTime)
+	, CurrentPhase(nullptr)
+{
+}
+
+void FBulkPhaseTimer::StartPhase(const TCHAR* PhaseName)
+{
+	const double Now = FPlatformTime::Seconds();
+	if (CurrentPhase)
+	{
+		PhaseSeconds.Emplace(CurrentPhase, Now - PhaseStartTime);
+	}
+
+	CurrentPhase = PhaseName;
+	PhaseStartTime = Now;
+}
+
+TSharedPtr<FJsonObject> FBulkPhaseTimer::Finish()
+{
+	StartPhase(nullptr);
+
+	TSharedPtr<FJsonObject> TimingsJson = MakeShared<FJsonObject>();
+	for (const TPair<FString, double>& Phase : PhaseSeconds)
+	{
+		// A phase can be entered more than once (e.g. compiles flushed mid-batch)
+		double Total = Phase.Value * 1000.0;
+		const FString FieldName = Phase.Key + TEXT("_ms");
+		double Previous = 0.0;
+		if (TimingsJson->TryGetNumberField(FieldName, Previous))
+		{
+			Total += Previous;
+		}
+		TimingsJson->SetNumberField(FieldName, Total);
+	}
+	TimingsJson->SetNumberField(TEXT("total_ms"), (PhaseStartTime - StartTime) * 1000.0);
+	return TimingsJson;
+}
+
 TArray<UBlueprint*> FBulkEditHandler::FilterBlueprints(const FBulkFilter& Filter)
 {
 	TArray<UBlueprint*> MatchingBlueprints;
@@ -39,14 +80,22 @@ TArray<UBlueprint*> FBulkEditHandler::FilterBlueprints(const FBulkFilter& Filter
 	return MatchingBlueprints;
 }
 
-bool FBulkEditHandler::BulkEditProperties(const TArray<UBlueprint*>& Blueprints, const TMap<FString, FString>& Properties, TArray<TSharedPtr<FJsonObject>>& OutResults)
+bool FBulkEditHandler::BulkEditProperties(const TArray<UBlueprint*>& Blueprints, const TMap<FString, FString>& Properties, TArray<TSharedPtr<FJsonObject>>& OutResults, FBulkPhaseTimer& Timer)
 {
 	bool bAllSucceeded = true;
 
+	// Edit every blueprint first, then compile and save the edited ones together
+	Timer.StartPhase(TEXT("apply"));
+
+	TArray<UBlueprint*> EditedBlueprints;
+	TArray<FString> EditedBackupPaths;
+	TArray<TSharedPtr<FJsonObject>> EditedResults;
+
 	for (UBlueprint* Blueprint : Blueprints)
 	{
 		TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
 		ResultJson->SetStringField(TEXT("blueprint"), Blueprint->GetName());
+		OutResults.Add(ResultJson);
 
 		// Create backup
 		FString BackupPath = FBackupManager::CreateBlueprintBackup(Blueprint);
@@ -54,7 +103,6 @@ bool FBulkEditHandler::BulkEditProperties(const TArray<UBlueprint*>& Blueprints,
 		{
 			ResultJson->SetBoolField(TEXT("success"), false);
 			ResultJson->SetStringField(TEXT("error"), TEXT("Failed to create backup"));
-			OutResults.Add(ResultJson);
 			bAllSucceeded = false;
 			continue;
 		}
@@ -86,12 +134,12 @@ bool FBulkEditHandler::BulkEditProperties(const TArray<UBlueprint*>& Blueprints,
 
 		if (bEditSuccess)
 		{
-			// Compile and save
-			FBlueprintEditHandler::CompileBlueprint(Blueprint);
-			FBlueprintEditHandler::SaveBlueprint(Blueprint);
-
 			ResultJson->SetBoolField(TEXT("success"), true);
 			ResultJson->SetArrayField(TEXT("changes"), ConvertToJsonValueArray(Changes));
+
+			EditedBlueprints.Add(Blueprint);
+			EditedBackupPaths.Add(BackupPath);
+			EditedResults.Add(ResultJson);
 		}
 		else
 		{
@@ -101,13 +149,193 @@ bool FBulkEditHandler::BulkEditProperties(const TArray<UBlueprint*>& Blueprints,
 			ResultJson->SetStringField(TEXT("error"), TEXT("Failed to edit properties"));
 			bAllSucceeded = false;
 		}
+	}
+
+	// Compile all edited blueprints with a single garbage collection
+	Timer.StartPhase(TEXT("compile"));
+
+	TArray<UBlueprint*> FailedCompiles;
+	FBlueprintEditHandler::CompileBlueprints(EditedBlueprints, FailedCompiles);
+
+	TArray<UBlueprint*> BlueprintsToSave;
+	for (int32 Index = 0; Index < EditedBlueprints.Num(); ++Index)
+	{
+		if (FailedCompiles.Contains(EditedBlueprints[Index]))
+		{
+			// Compilation failed, restore backup and leave it unsaved
+			FBackupManager::RestoreBackup(EditedBackupPaths[Index]);
+			EditedResults[Index]->SetBoolField(TEXT("success"), false);
+			EditedResults[Index]->SetStringField(TEXT("error"), TEXT("Blueprint compilation failed"));
+			bAllSucceeded = false;
+		}
+		else
+		{
+			BlueprintsToSave.Add(EditedBlueprints[Index]);
+		}
+	}
 
-		OutResults.Add(ResultJson);
+	// Save in one pass
+	Timer.StartPhase(TEXT("save"));
+
+	TArray<UBlueprint*> FailedSaves;
+	FBlueprintEditHandler::SaveBlueprints(BlueprintsToSave, FailedSaves);
+
+	for (UBlueprint* Blueprint : FailedSaves)
+	{
+		const int32 Index = EditedBlueprints.IndexOfByKey(Blueprint);
+		EditedResults[Index]->SetBoolField(TEXT("success"), false);
+		EditedResults[Index]->SetStringField(TEXT("error"), TEXT("Failed to save blueprint"));
+		bAllSucceeded = false;
 	}
 
 	return bAllSucceeded;
 }
 
+bool FBulkEditHandler::IsBlueprintOperation(const FString& OpType)
+{
+	return OpType == TEXT("edit_property")
+		|| OpType == TEXT("add_variable")
+		|| OpType == TEXT("add_function")
+		|| OpType == TEXT("add_node")
+		|| OpType == TEXT("connect_pins")
+		|| OpType == TEXT("delete_node")
+		|| OpType == TEXT("add_component")
+		|| OpType == TEXT("remove_component");
+}
+
+bool FBulkEditHandler::ApplyBatchOperation(UBlueprint* Blueprint, const FString& OpType, const TSharedPtr<FJsonObject>& Operation, const TSharedPtr<FJsonObject>& OutResult, bool& bOutNeedsCompile)
+{
+	bool bSuccess = false;
+	FString Error;
+
+	if (OpType == TEXT("edit_property"))
+	{
+		FString PropertyName, Value, OldValue;
+		Operation->TryGetStringField(TEXT("property"), PropertyName);
+		Operation->TryGetStringField(TEXT("value"), Value);
+
+		bSuccess = FBlueprintEditHandler::EditBlueprintProperty(Blueprint, *PropertyName, Value, OldValue);
+		if (bSuccess)
+		{
+			OutResult->SetStringField(TEXT("old_value"), OldValue);
+		}
+		else
+		{
+			Error = FString::Printf(TEXT("Failed to set property '%s'"), *PropertyName);
+		}
+	}
+	else if (OpType == TEXT("add_variable"))
+	{
+		FString Name, Type;
+		Operation->TryGetStringField(TEXT("name"), Name);
+		Operation->TryGetStringField(TEXT("type"), Type);
+
+		FString ResultName = FBlueprintEditHandler::AddBlueprintVariable(Blueprint, Name, Type, Error);
+		bSuccess = !ResultName.IsEmpty();
+		if (bSuccess)
+		{
+			OutResult->SetStringField(TEXT("variable_name"), ResultName);
+		}
+	}
+	else if (OpType == TEXT("add_function"))
+	{
+		FString Name;
+		Operation->TryGetStringField(TEXT("name"), Name);
+
+		FString ResultName = FBlueprintEditHandler::AddBlueprintFunction(Blueprint, Name, Error);
+		bSuccess = !ResultName.IsEmpty();
+		if (bSuccess)
+		{
+			OutResult->SetStringField(TEXT("function_name"), ResultName);
+		}
+	}
+	else if (OpType == TEXT("add_node"))
+	{
+		FString GraphName, NodeClass;
+		int32 X = 0, Y = 0;
+		Operation->TryGetStringField(TEXT("graph"), GraphName);
+		Operation->TryGetStringField(TEXT("node_class"), NodeClass);
+		Operation->TryGetNumberField(TEXT("x"), X);
+		Operation->TryGetNumberField(TEXT("y"), Y);
+
+		TMap<FString, FString> Properties;
+		const TSharedPtr<FJsonObject>* PropsObj;
+		if (Operation->TryGetObjectField(TEXT("properties"), PropsObj))
+		{
+			for (const auto& Pair : (*PropsObj)->Values)
+			{
+				FString Val;
+				if (Pair.Value->TryGetString(Val)) Properties.Add(Pair.Key, Val);
+			}
+		}
+
+		UEdGraphNode* NewNode = FBlueprintEditHandler::AddGraphNode(Blueprint, GraphName, NodeClass, X, Y, Properties, Error);
+		bSuccess = NewNode != nullptr;
+		if (bSuccess)
+		{
+			OutResult->SetStringField(TEXT("node_name"), NewNode->GetName());
+			OutResult->SetStringField(TEXT("node_guid"), NewNode->NodeGuid.ToString());
+		}
+	}
+	else if (OpType == TEXT("connect_pins"))
+	{
+		FString GraphName, NodeA, PinA, NodeB, PinB;
+		Operation->TryGetStringField(TEXT("graph"), GraphName);
+		Operation->TryGetStringField(TEXT("node_a"), NodeA);
+		Operation->TryGetStringField(TEXT("pin_a"), PinA);
+		Operation->TryGetStringField(TEXT("node_b"), NodeB);
+		Operation->TryGetStringField(TEXT("pin_b"), PinB);
+
+		bSuccess = FBlueprintEditHandler::ConnectNodePins(Blueprint, GraphName, NodeA, PinA, NodeB, PinB, Error);
+	}
+	else if (OpType == TEXT("delete_node"))
+	{
+		FString GraphName, NodeName;
+		Operation->TryGetStringField(TEXT("graph"), GraphName);
+		Operation->TryGetStringField(TEXT("node"), NodeName);
+
+		bSuccess = FBlueprintEditHandler::RemoveGraphNode(Blueprint, GraphName, NodeName, Error);
+	}
+	else if (OpType == TEXT("add_component"))
+	{
+		FString ComponentClass, ComponentName, ParentName;
+		Operation->TryGetStringField(TEXT("class"), ComponentClass);
+		Operation->TryGetStringField(TEXT("name"), ComponentName);
+		Operation->TryGetStringField(TEXT("parent"), ParentName);
+
+		FString ResultName = FBlueprintEditHandler::AddComponent(Blueprint, ComponentClass, ComponentName, ParentName, Error, false);
+		bSuccess = !ResultName.IsEmpty();
+		if (bSuccess)
+		{
+			OutResult->SetStringField(TEXT("component_name"), ResultName);
+		}
+	}
+	else if (OpType == TEXT("remove_component"))
+	{
+		FString ComponentName;
+		Operation->TryGetStringField(TEXT("name"), ComponentName);
+
+		bSuccess = FBlueprintEditHandler::RemoveComponent(Blueprint, ComponentName, Error, false);
+	}
+	else
+	{
+		Error = FString::Printf(TEXT("Unknown operation type '%s'"), *OpType);
+	}
+
+	// Property edits only touch the class defaults; everything else changes what the compiler generates
+	if (bSuccess && OpType != TEXT("edit_property"))
+	{
+		bOutNeedsCompile = true;
+	}
+
+	OutResult->SetBoolField(TEXT("success"), bSuccess);
+	if (!bSuccess)
+	{
+		OutResult->SetStringField(TEXT("error"), Error);
+	}
+	return bSuccess;
+}
+
 FString FBulkEditHandler::ParseValueExpression(const FString& Expression, const FString& CurrentValue)
 {
 	// Check if expression contains an operator
@@ -20,6 +20,34 @@ struct FBulkFilter
 	FBulkFilter() = default;
 };
 
+/**
+ * Wall-clock time spent in each phase of a bulk or batch operation, reported as "timings" in responses
+ */
+class FBulkPhaseTimer
+{
+public:
+
+	FBulkPhaseTimer();
+
+	/** End the current phase (if any) and start timing the next one */
+	void StartPhase(const TCHAR* PhaseName);
+
+	/** End the current phase and get {"<phase>_ms": ..., "total_ms": ...} */
+	TSharedPtr<FJsonObject> Finish();
+
+private:
+
+	/** Start times */
+	double StartTime;
+	double PhaseStartTime;
+
+	/** Phase being timed (null if none) */
+	const TCHAR* CurrentPhase;
+
+	/** Finished phases in order */
+	TArray<TPair<FString, double>> PhaseSeconds;
+};
+
 /**
  * Handles bulk editing operations on multiple assets
  */
@@ -39,9 +67,25 @@ public:
 	 * @param Blueprints Array of blueprints to edit
 	 * @param Properties Map of property names to values (supports operators like *1.5, +10, -5)
 	 * @param OutResults Array of result objects for each blueprint
+	 * @param Timer Timer the apply, compile and save phases are recorded on
 	 * @return True if all edits successful
 	 */
-	static bool BulkEditProperties(const TArray<UBlueprint*>& Blueprints, const TMap<FString, FString>& Properties, TArray<TSharedPtr<FJsonObject>>& OutResults);
+	static bool BulkEditProperties(const TArray<UBlueprint*>& Blueprints, const TMap<FString, FString>& Properties, TArray<TSharedPtr<FJsonObject>>& OutResults, FBulkPhaseTimer& Timer);
+
+	/**
+	 * Apply one blueprint operation of a batch without compiling or saving (the batch compiles and saves each
+	 * blueprint once after all of its operations)
+	 * @param Blueprint Target blueprint
+	 * @param OpType Operation type (edit_property, add_variable, add_function, add_node, connect_pins, delete_node, add_component, remove_component)
+	 * @param Operation Operation JSON
+	 * @param OutResult Result object to fill (success, error and the operation's output fields)
+	 * @param bOutNeedsCompile Set if the operation changed the blueprint's structure or graphs
+	 * @return True if the operation succeeded
+	 */
+	static bool ApplyBatchOperation(UBlueprint* Blueprint, const FString& OpType, const TSharedPtr<FJsonObject>& Operation, const TSharedPtr<FJsonObject>& OutResult, bool& bOutNeedsCompile);
+
+	/** Check if a batch operation type targets a blueprint */
+	static bool IsBlueprintOperation(const FString& OpType);
 
 	/**
 	 * Parse a property value expression (supports operators like *1.5, +10, -5)
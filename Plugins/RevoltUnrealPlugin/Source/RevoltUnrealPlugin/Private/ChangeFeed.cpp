@@ -0,0 +1,373 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ChangeFeed.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonValue.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Guid.h"
+#include "UObject/Package.h"
+
+FChangeFeed* FChangeFeed::Instance = nullptr;
+
+namespace ChangeFeed
+{
+	static TArray<TSharedPtr<FJsonValue>> ToJsonArray(double X, double Y, double Z)
+	{
+		return { MakeShared<FJsonValueNumber>(X), MakeShared<FJsonValueNumber>(Y), MakeShared<FJsonValueNumber>(Z) };
+	}
+}
+
+FChangeFeed::FChangeFeed()
+	: LastSequence(0)
+	, Epoch(FGuid::NewGuid().ToString(EGuidFormats::DigitsLower))
+	, bWakePending(false)
+	, LastMoveFlushTime(0.0)
+{
+}
+
+FChangeFeed& FChangeFeed::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FChangeFeed();
+	}
+	return *Instance;
+}
+
+void FChangeFeed::Initialize()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FChangeFeed::OnAssetAdded);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FChangeFeed::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FChangeFeed::OnAssetRenamed);
+
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FChangeFeed::OnPackageSaved);
+
+	if (GEngine)
+	{
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FChangeFeed::OnActorAdded);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FChangeFeed::OnActorDeleted);
+		ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FChangeFeed::OnActorMoved);
+	}
+	MapOpenedHandle = FEditorDelegates::OnMapOpened.AddRaw(this, &FChangeFeed::OnMapOpened);
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FChangeFeed::Tick));
+}
+
+void FChangeFeed::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+	FEditorDelegates::OnMapOpened.Remove(MapOpenedHandle);
+
+	ReleaseWaiters();
+	Events.Empty();
+	PendingMoves.Empty();
+}
+
+void FChangeFeed::Publish(const FString& Type, const TSharedPtr<FJsonObject>& Event)
+{
+	FChangeEvent& Change = Events.AddDefaulted_GetRef();
+	Change.Sequence = ++LastSequence;
+	if (!Type.Split(TEXT("_"), &Change.Category, nullptr))
+	{
+		Change.Category = Type;
+	}
+
+	// seq and type first so the deltas read well on the wire
+	Change.Data = MakeShared<FJsonObject>();
+	Change.Data->SetNumberField(TEXT("seq"), (double)Change.Sequence);
+	Change.Data->SetStringField(TEXT("type"), Type);
+	Change.Data->SetStringField(TEXT("time"), FDateTime::UtcNow().ToIso8601());
+	if (Event.IsValid())
+	{
+		for (const auto& Field : Event->Values)
+		{
+			Change.Data->SetField(Field.Key, Field.Value);
+		}
+	}
+
+	// Drop the oldest quarter at once rather than shifting the log on every event
+	if (Events.Num() > MaxEvents)
+	{
+		Events.RemoveAt(0, MaxEvents / 4, EAllowShrinking::No);
+	}
+
+	bWakePending = true;
+}
+
+FChangeFeed::EPollResult FChangeFeed::Poll(uint64 Since, int32 Limit, double TimeoutSeconds, const TSet<FString>& Categories, const FString& ClientEpoch, int32 MaxWaiters, FRespondCallback Respond)
+{
+	FWaiter Waiter;
+	Waiter.Since = Since;
+	Waiter.Limit = FMath::Max(Limit, 1);
+	Waiter.Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+	Waiter.Categories = Categories;
+	Waiter.Epoch = ClientEpoch;
+
+	if (TSharedPtr<FJsonObject> Response = BuildResponse(Waiter, TimeoutSeconds <= 0.0))
+	{
+		Respond(Response);
+		return EPollResult::Answered;
+	}
+
+	if (Waiters.Num() >= MaxWaiters)
+	{
+		return EPollResult::TooManyWaiters;
+	}
+
+	Waiter.Respond = MoveTemp(Respond);
+	Waiters.Add(MoveTemp(Waiter));
+	return EPollResult::Waiting;
+}
+
+void FChangeFeed::ReleaseWaiters()
+{
+	TArray<FWaiter> Released = MoveTemp(Waiters);
+	Waiters.Reset();
+
+	for (FWaiter& Waiter : Released)
+	{
+		Waiter.Respond(BuildResponse(Waiter, true));
+	}
+}
+
+TSharedPtr<FJsonObject> FChangeFeed::BuildResponse(FWaiter& Waiter, bool bForce) const
+{
+	const uint64 FirstSequence = Events.Num() > 0 ? Events[0].Sequence : LastSequence + 1;
+
+	// Events the client has not seen were dropped, or its position is from another session: it must resync
+	const bool bReset = (!Waiter.Epoch.IsEmpty() && Waiter.Epoch != Epoch)
+		|| Waiter.Since > LastSequence
+		|| Waiter.Since + 1 < FirstSequence;
+
+	TArray<TSharedPtr<FJsonValue>> EventValues;
+	uint64 Next = LastSequence;
+	bool bMore = false;
+
+	if (!bReset)
+	{
+		for (int32 Index = (int32)(Waiter.Since + 1 - FirstSequence); Index < Events.Num(); ++Index)
+		{
+			const FChangeEvent& Event = Events[Index];
+			if (Waiter.Categories.Num() > 0 && !Waiter.Categories.Contains(Event.Category))
+			{
+				continue;
+			}
+
+			if (EventValues.Num() >= Waiter.Limit)
+			{
+				bMore = true;
+				break;
+			}
+
+			EventValues.Add(MakeShared<FJsonValueObject>(Event.Data));
+			Next = Event.Sequence;
+		}
+
+		// Nothing this poll wants yet: skip what was filtered out so the next check starts after it
+		if (EventValues.Num() == 0 && !bForce)
+		{
+			Waiter.Since = LastSequence;
+			return nullptr;
+		}
+
+		if (!bMore)
+		{
+			Next = LastSequence;
+		}
+	}
+
+	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("epoch"), Epoch);
+	Response->SetNumberField(TEXT("next"), (double)Next);
+	Response->SetBoolField(TEXT("reset"), bReset);
+	Response->SetBoolField(TEXT("more"), bMore);
+	Response->SetArrayField(TEXT("events"), EventValues);
+	return Response;
+}
+
+bool FChangeFeed::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	if (PendingMoves.Num() > 0 && Now - LastMoveFlushTime >= MoveFlushInterval)
+	{
+		PublishPendingMoves(Now);
+	}
+
+	const bool bCheckEvents = bWakePending;
+	bWakePending = false;
+
+	if (Waiters.Num() == 0)
+	{
+		return true;
+	}
+	for (int32 Index = Waiters.Num() - 1; Index >= 0; --Index)
+	{
+		FWaiter& Waiter = Waiters[Index];
+		const bool bExpired = Now >= Waiter.Deadline;
+		if (!bCheckEvents && !bExpired)
+		{
+			continue;
+		}
+
+		if (TSharedPtr<FJsonObject> Response = BuildResponse(Waiter, bExpired))
+		{
+			FRespondCallback Respond = MoveTemp(Waiter.Respond);
+			Waiters.RemoveAtSwap(Index);
+			Respond(Response);
+		}
+	}
+
+	return true;
+}
+
+void FChangeFeed::PublishPendingMoves(double Now)
+{
+	LastMoveFlushTime = Now;
+
+	TSet<TWeakObjectPtr<AActor>> Moved = MoveTemp(PendingMoves);
+	PendingMoves.Reset();
+	for (const TWeakObjectPtr<AActor>& Actor : Moved)
+	{
+		if (IsInEditorWorld(Actor.Get()))
+		{
+			Publish(TEXT("actor_moved"), MakeActorEvent(Actor.Get(), true));
+		}
+	}
+}
+
+void FChangeFeed::OnAssetAdded(const FAssetData& AssetData)
+{
+	// The initial scan reports every asset in the project; clients get those from the full queries
+	if (IAssetRegistry::GetChecked().IsLoadingAssets())
+	{
+		return;
+	}
+
+	Publish(TEXT("asset_added"), MakeAssetEvent(AssetData));
+}
+
+void FChangeFeed::OnAssetRemoved(const FAssetData& AssetData)
+{
+	Publish(TEXT("asset_removed"), MakeAssetEvent(AssetData));
+}
+
+void FChangeFeed::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	TSharedPtr<FJsonObject> Event = MakeAssetEvent(AssetData);
+	Event->SetStringField(TEXT("old_path"), OldObjectPath);
+	Publish(TEXT("asset_renamed"), Event);
+}
+
+void FChangeFeed::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (!Package || SaveContext.IsProceduralSave())
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Event = MakeShared<FJsonObject>();
+	Event->SetStringField(TEXT("package"), Package->GetName());
+	Publish(TEXT("asset_saved"), Event);
+}
+
+void FChangeFeed::OnActorAdded(AActor* Actor)
+{
+	if (IsInEditorWorld(Actor))
+	{
+		Publish(TEXT("actor_spawned"), MakeActorEvent(Actor, true));
+	}
+}
+
+void FChangeFeed::OnActorDeleted(AActor* Actor)
+{
+	if (IsInEditorWorld(Actor))
+	{
+		// A move still waiting to be published would otherwise follow the destroy
+		PendingMoves.Remove(Actor);
+		Publish(TEXT("actor_destroyed"), MakeActorEvent(Actor, false));
+	}
+}
+
+void FChangeFeed::OnActorMoved(AActor* Actor)
+{
+	// Published from Tick with the transform the actor has by then
+	if (IsInEditorWorld(Actor))
+	{
+		PendingMoves.Add(Actor);
+	}
+}
+
+void FChangeFeed::OnMapOpened(const FString& Filename, bool bAsTemplate)
+{
+	// Every actor event after this is about another level
+	PendingMoves.Empty();
+	TSharedPtr<FJsonObject> Event = MakeShared<FJsonObject>();
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	Event->SetStringField(TEXT("level"), World ? World->GetOutermost()->GetName() : FString());
+	Event->SetStringField(TEXT("file"), Filename);
+	Publish(TEXT("level_opened"), Event);
+}
+
+bool FChangeFeed::IsInEditorWorld(const AActor* Actor)
+{
+	return GEditor && Actor && Actor->GetWorld() && Actor->GetWorld() == GEditor->GetEditorWorldContext().World();
+}
+
+TSharedPtr<FJsonObject> FChangeFeed::MakeActorEvent(const AActor* Actor, bool bWithTransform)
+{
+	TSharedPtr<FJsonObject> Event = MakeShared<FJsonObject>();
+	Event->SetStringField(TEXT("actor"), Actor->GetPathName());
+	Event->SetStringField(TEXT("name"), Actor->GetName());
+	Event->SetStringField(TEXT("label"), Actor->GetActorLabel());
+	Event->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+	Event->SetStringField(TEXT("level"), Actor->GetLevel() ? Actor->GetLevel()->GetPackage()->GetName() : FString());
+
+	if (bWithTransform)
+	{
+		const FTransform Transform = Actor->GetActorTransform();
+		const FVector Location = Transform.GetLocation();
+		const FRotator Rotation = Transform.Rotator();
+		const FVector Scale = Transform.GetScale3D();
+		Event->SetArrayField(TEXT("location"), ChangeFeed::ToJsonArray(Location.X, Location.Y, Location.Z));
+		Event->SetArrayField(TEXT("rotation"), ChangeFeed::ToJsonArray(Rotation.Pitch, Rotation.Yaw, Rotation.Roll));
+		Event->SetArrayField(TEXT("scale"), ChangeFeed::ToJsonArray(Scale.X, Scale.Y, Scale.Z));
+	}
+
+	return Event;
+}
+
+TSharedPtr<FJsonObject> FChangeFeed::MakeAssetEvent(const FAssetData& AssetData)
+{
+	TSharedPtr<FJsonObject> Event = MakeShared<FJsonObject>();
+	Event->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
+	Event->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
+	Event->SetStringField(TEXT("class"), AssetData.AssetClassPath.GetAssetName().ToString());
+	Event->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
+	return Event;
+}
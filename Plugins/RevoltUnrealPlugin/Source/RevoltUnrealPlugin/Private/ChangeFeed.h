@@ -0,0 +1,186 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class UPackage;
+struct FAssetData;
+
+/**
+ * One change, numbered in the order it happened
+ */
+struct FChangeEvent
+{
+	uint64 Sequence = 0;
+
+	/** Event type prefix ("asset", "actor", "level", "transaction") used to filter polls */
+	FString Category;
+
+	/** Compact JSON delta sent to clients */
+	TSharedPtr<FJsonObject> Data;
+};
+
+/**
+ * Live feed of editor changes for clients keeping a local mirror, served by GET /api/changes as a long poll.
+ * Collects asset added/removed/renamed/saved events, actor spawned/destroyed/moved events in the open level and
+ * transaction events into a bounded log of numbered deltas. A poll returns the events after the sequence number it
+ * passes, or waits until there are some. Waiting polls are answered once per tick, so a burst of events goes out
+ * in one response. Actor moves are coalesced per actor and published with the latest transform at most every
+ * MoveFlushInterval, as a gizmo drag moves actors every frame.
+ */
+class FChangeFeed
+{
+public:
+
+	/** Sends a poll's response body (game thread) */
+	typedef TFunction<void(const TSharedPtr<FJsonObject>&)> FRespondCallback;
+
+	/** What became of a poll */
+	enum class EPollResult
+	{
+		/** Respond was called already */
+		Answered,
+		/** Waiting for events; Respond is called from a later tick */
+		Waiting,
+		/** Would have waited, but MaxWaiters polls already are; Respond is never called */
+		TooManyWaiters
+	};
+
+	/** Get singleton instance */
+	static FChangeFeed& Get();
+
+	/** Subscribe to asset registry, package, level and actor events */
+	void Initialize();
+
+	/** Unsubscribe from events, answer waiting polls and drop the log */
+	void Shutdown();
+
+	/**
+	 * Add an event to the log (game thread)
+	 * @param Type Event type ("<category>_<what>", e.g. "actor_moved")
+	 * @param Event Event fields (seq, type and time are added)
+	 */
+	void Publish(const FString& Type, const TSharedPtr<FJsonObject>& Event);
+
+	/**
+	 * Answer with the events after a sequence number, waiting for one if there are none yet
+	 * @param Since Last sequence number the client has seen
+	 * @param Limit Maximum number of events in the response
+	 * @param TimeoutSeconds How long to wait before answering with no events
+	 * @param Categories Event categories to return (all if empty)
+	 * @param ClientEpoch Epoch the client's position is from (not checked if empty)
+	 * @param MaxWaiters Polls allowed to wait at once
+	 * @param Respond Called once with the response body, unless the poll is rejected
+	 * @return Whether the poll was answered, is waiting or was rejected
+	 */
+	EPollResult Poll(uint64 Since, int32 Limit, double TimeoutSeconds, const TSet<FString>& Categories, const FString& ClientEpoch, int32 MaxWaiters, FRespondCallback Respond);
+
+	/** Answer every waiting poll now (server stopping) */
+	void ReleaseWaiters();
+
+	/** Sequence number of the newest event (0 if none) */
+	uint64 GetLastSequence() const { return LastSequence; }
+
+	/** Identifies this editor session; sequence numbers restart with a new one */
+	const FString& GetEpoch() const { return Epoch; }
+
+	/** Number of polls waiting for events */
+	int32 NumWaiters() const { return Waiters.Num(); }
+
+private:
+
+	/** Private constructor for singleton */
+	FChangeFeed();
+
+	/** Poll waiting for events */
+	struct FWaiter
+	{
+		uint64 Since = 0;
+		int32 Limit = 0;
+		double Deadline = 0.0;
+		TSet<FString> Categories;
+		FString Epoch;
+		FRespondCallback Respond;
+	};
+
+	/**
+	 * Build a poll response from the log
+	 * @param Waiter Poll to answer (Since is moved past events it filtered out)
+	 * @param bForce Build a response even without matching events
+	 * @return Response body, or null if there is nothing to send yet
+	 */
+	TSharedPtr<FJsonObject> BuildResponse(FWaiter& Waiter, bool bForce) const;
+
+	/** Ticker callback: answer polls with new events or past their deadline */
+	bool Tick(float DeltaTime);
+
+	/** Publish one actor_moved event per actor moved since the last call */
+	void PublishPendingMoves(double Now);
+
+	/** Event callbacks */
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+	void OnActorAdded(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnActorMoved(AActor* Actor);
+	void OnMapOpened(const FString& Filename, bool bAsTemplate);
+
+	/** Check if an actor belongs to the level open in the editor */
+	static bool IsInEditorWorld(const AActor* Actor);
+
+	/** Event fields identifying an actor */
+	static TSharedPtr<FJsonObject> MakeActorEvent(const AActor* Actor, bool bWithTransform);
+
+	/** Event fields identifying an asset */
+	static TSharedPtr<FJsonObject> MakeAssetEvent(const FAssetData& AssetData);
+
+	/** Newest events, oldest first, with consecutive sequence numbers */
+	TArray<FChangeEvent> Events;
+
+	/** Sequence number of the newest event */
+	uint64 LastSequence;
+
+	/** Session identifier */
+	FString Epoch;
+
+	/** Polls waiting for events */
+	TArray<FWaiter> Waiters;
+
+	/** Events were published since the last tick */
+	bool bWakePending;
+
+	/** Actors moved since moves were last published */
+	TSet<TWeakObjectPtr<AActor>> PendingMoves;
+
+	/** When pending moves were last published */
+	double LastMoveFlushTime;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	/** Event subscriptions */
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle MapOpenedHandle;
+
+	/** Events kept for polls that fall behind; older ones are dropped and such polls are told to resync */
+	static const int32 MaxEvents = 4096;
+
+	/** Seconds between publishing coalesced actor moves */
+	static constexpr double MoveFlushInterval = 0.25;
+
+	/** Singleton instance */
+	static FChangeFeed* Instance;
+};
@@ -13,6 +13,7 @@
 #include "BackupManager.h"
 #include "TransactionManager.h"
 #include "QueryOptions.h"
+#include "JsonPageWriter.h"
 #include "Misc/FileHelper.h"
 
 UDataAsset* FDataAssetFactoryHandler::CreateDataAsset(UClass* DataAssetClass, const FString& AssetName, const FString& PackagePath)
@@ -225,10 +226,8 @@ UDataAsset* FDataAssetFactoryHandler::FindDataAsset(const FString& DataAssetName
 	return nullptr;
 }
 
-TSharedPtr<FJsonObject> FDataAssetFactoryHandler::GetAllDataAssets(UClass* DataAssetClass, const FQueryOptions& Options)
+FString FDataAssetFactoryHandler::GetAllDataAssets(UClass* DataAssetClass, const FQueryOptions& Options, const FPageOptions& Page)
 {
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-
 	// Get asset registry
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
@@ -244,43 +243,45 @@ TSharedPtr<FJsonObject> FDataAssetFactoryHandler::GetAllDataAssets(UClass* DataA
 		AssetRegistry.GetAssetsByClass(UDataAsset::StaticClass()->GetClassPathName(), AssetDataList, true);
 	}
 
-	TArray<TSharedPtr<FJsonValue>> DataAssetArray;
-
-	for (const FAssetData& AssetData : AssetDataList)
+	// Pages are cut from registry data, so only assets on the requested page get loaded
+	FJsonPageWriter Writer(TEXT("data_assets"));
+	return Writer.WriteAssetPage(AssetDataList, Page, [&Options](const FAssetData& AssetData) -> TSharedPtr<FJsonObject>
 	{
 		UDataAsset* DataAsset = Cast<UDataAsset>(AssetData.GetAsset());
 		if (DataAsset)
 		{
+			const FFieldSelection& Fields = Options.Fields;
 			TSharedPtr<FJsonObject> AssetInfo = MakeShared<FJsonObject>();
 			AssetInfo->SetStringField(TEXT("name"), DataAsset->GetName());
-			AssetInfo->SetStringField(TEXT("path"), DataAsset->GetPathName());
-			AssetInfo->SetStringField(TEXT("class"), DataAsset->GetClass()->GetPathName());
+			if (Fields.Select(TEXT("path")))
+			{
+				AssetInfo->SetStringField(TEXT("path"), DataAsset->GetPathName());
+			}
+			if (Fields.Select(TEXT("class")))
+			{
+				AssetInfo->SetStringField(TEXT("class"), DataAsset->GetClass()->GetPathName());
+			}
 
 			// Add basic properties if requested
-			if (Options.bIncludeProperties || Options.DepthLevel >= EQueryDepth::Standard)
+			if (const FFieldSelection* PropertyFields = Fields.Select(TEXT("properties"), Options.bIncludeProperties || Options.DepthLevel >= EQueryDepth::Standard))
 			{
 				TArray<TSharedPtr<FJsonValue>> PropertiesArray;
-				ExtractDataAssetProperties(DataAsset->GetClass(), PropertiesArray, Options);
+				ExtractDataAssetProperties(DataAsset->GetClass(), PropertiesArray, Options, *PropertyFields);
 				AssetInfo->SetArrayField(TEXT("properties"), PropertiesArray);
 			}
 
 			// Add default values if requested
-			if (Options.bIncludeDefaultValues || Options.DepthLevel >= EQueryDepth::Deep)
+			if (const FFieldSelection* DefaultFields = Fields.Select(TEXT("defaults"), Options.bIncludeDefaultValues || Options.DepthLevel >= EQueryDepth::Deep))
 			{
 				TArray<TSharedPtr<FJsonValue>> DefaultsArray;
-				ExtractDataAssetDefaults(DataAsset->GetClass(), DefaultsArray, Options);
+				ExtractDataAssetDefaults(DataAsset->GetClass(), DefaultsArray, Options, *DefaultFields);
 				AssetInfo->SetArrayField(TEXT("defaults"), DefaultsArray);
 			}
 
-			DataAssetArray.Add(MakeShared<FJsonValueObject>(AssetInfo));
+			return AssetInfo;
 		}
-	}
-
-	Result->SetArrayField(TEXT("data_assets"), DataAssetArray);
-	Result->SetNumberField(TEXT("count"), DataAssetArray.Num());
-	Result->SetBoolField(TEXT("success"), true);
-
-	return Result;
+		return nullptr;
+	});
 }
 
 TSharedPtr<FJsonObject> FDataAssetFactoryHandler::GetDataAssetInfo(const FString& DataAssetName, const FQueryOptions& Options)
@@ -291,40 +292,50 @@ TSharedPtr<FJsonObject> FDataAssetFactoryHandler::GetDataAssetInfo(const FString
 		return nullptr;
 	}
 
+	const FFieldSelection& Fields = Options.Fields;
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	Result->SetStringField(TEXT("name"), DataAsset->GetName());
-	Result->SetStringField(TEXT("path"), DataAsset->GetPathName());
-	Result->SetStringField(TEXT("class"), DataAsset->GetClass()->GetPathName());
+	if (Fields.Select(TEXT("path")))
+	{
+		Result->SetStringField(TEXT("path"), DataAsset->GetPathName());
+	}
+	if (Fields.Select(TEXT("class")))
+	{
+		Result->SetStringField(TEXT("class"), DataAsset->GetClass()->GetPathName());
+	}
 	Result->SetBoolField(TEXT("success"), true);
 
 	// Add properties if requested
-	if (Options.bIncludeProperties || Options.DepthLevel >= EQueryDepth::Standard)
+	if (const FFieldSelection* PropertyFields = Fields.Select(TEXT("properties"), Options.bIncludeProperties || Options.DepthLevel >= EQueryDepth::Standard))
 	{
 		TArray<TSharedPtr<FJsonValue>> PropertiesArray;
-		ExtractDataAssetProperties(DataAsset->GetClass(), PropertiesArray, Options);
+		ExtractDataAssetProperties(DataAsset->GetClass(), PropertiesArray, Options, *PropertyFields);
 		Result->SetArrayField(TEXT("properties"), PropertiesArray);
 	}
 
 	// Add default/current values if requested
-	if (Options.bIncludeDefaultValues || Options.DepthLevel >= EQueryDepth::Deep)
+	const bool bIncludeValues = Options.bIncludeDefaultValues || Options.DepthLevel >= EQueryDepth::Deep;
+	if (const FFieldSelection* DefaultFields = Fields.Select(TEXT("defaults"), bIncludeValues))
 	{
 		TArray<TSharedPtr<FJsonValue>> DefaultsArray;
-		ExtractDataAssetDefaults(DataAsset->GetClass(), DefaultsArray, Options);
+		ExtractDataAssetDefaults(DataAsset->GetClass(), DefaultsArray, Options, *DefaultFields);
+		Result->SetArrayField(TEXT("defaults"), DefaultsArray);
+	}
 
-		// Also extract current values
+	// Also extract current values
+	if (const FFieldSelection* CurrentValueFields = Fields.Select(TEXT("current_values"), bIncludeValues))
+	{
 		TArray<TSharedPtr<FJsonValue>> CurrentValuesArray;
-		ExtractDataAssetCurrentValues(DataAsset, CurrentValuesArray, Options);
-
-		Result->SetArrayField(TEXT("defaults"), DefaultsArray);
+		ExtractDataAssetCurrentValues(DataAsset, CurrentValuesArray, Options, *CurrentValueFields);
 		Result->SetArrayField(TEXT("current_values"), CurrentValuesArray);
 	}
 
 	// Add full details if requested
-	if (Options.DepthLevel >= EQueryDepth::Full)
+	if (const FFieldSelection* FunctionFields = Fields.Select(TEXT("functions"), Options.DepthLevel >= EQueryDepth::Full))
 	{
 		// For full depth, include everything plus functions if they exist
 		TArray<TSharedPtr<FJsonValue>> FunctionsArray;
-		ExtractDataAssetFunctions(DataAsset->GetClass(), FunctionsArray, Options);
+		ExtractDataAssetFunctions(DataAsset->GetClass(), FunctionsArray, Options, *FunctionFields);
 		Result->SetArrayField(TEXT("functions"), FunctionsArray);
 	}
 
@@ -379,6 +390,7 @@ bool FDataAssetFactoryHandler::EditDataAssetProperties(const FString& DataAssetN
 				if (FBlueprintEditHandler::SetPropertyValue(DataAsset, Property, PropertyPair.Value))
 				{
 					ChangeJson->SetBoolField(TEXT("success"), true);
+					FTransactionManager::Get().RecordPropertyChange(DataAsset, PropertyName, OldValue, FBlueprintEditHandler::GetPropertyValue(DataAsset, Property));
 				}
 				else
 				{
@@ -414,7 +426,7 @@ bool FDataAssetFactoryHandler::EditDataAssetProperties(const FString& DataAssetN
 // Helper Functions for Data Asset Extraction
 // ============================================================================
 
-void FDataAssetFactoryHandler::ExtractDataAssetProperties(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& PropertiesArray, const FQueryOptions& Options)
+void FDataAssetFactoryHandler::ExtractDataAssetProperties(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& PropertiesArray, const FQueryOptions& Options, const FFieldSelection& Fields)
 {
 	if (!DataAssetClass) return;
 
@@ -428,38 +440,50 @@ void FDataAssetFactoryHandler::ExtractDataAssetProperties(UClass* DataAssetClass
 			continue;
 		}
 
+		const FFieldSelection* PropertyFields = Fields.SelectElement(Property->GetName());
+		if (!PropertyFields)
+		{
+			continue;
+		}
+
 		TSharedPtr<FJsonObject> PropertyJson = MakeShared<FJsonObject>();
 		PropertyJson->SetStringField(TEXT("name"), Property->GetName());
-		PropertyJson->SetStringField(TEXT("type"), Property->GetCPPType());
+		if (PropertyFields->Select(TEXT("type")))
+		{
+			PropertyJson->SetStringField(TEXT("type"), Property->GetCPPType());
+		}
 
 		// Add category if available
-		FString Category = Property->GetMetaData(TEXT("Category"));
+		FString Category = PropertyFields->Select(TEXT("category")) ? Property->GetMetaData(TEXT("Category")) : FString();
 		if (!Category.IsEmpty())
 		{
 			PropertyJson->SetStringField(TEXT("category"), Category);
 		}
 
 		// Add flags
-		TArray<TSharedPtr<FJsonValue>> FlagsArray;
-		if (Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
-		{
-			FlagsArray.Add(MakeShared<FJsonValueString>(TEXT("BlueprintVisible")));
-		}
-		if (Property->HasAnyPropertyFlags(CPF_Edit))
-		{
-			FlagsArray.Add(MakeShared<FJsonValueString>(TEXT("Edit")));
-		}
-		if (Property->HasAnyPropertyFlags(CPF_BlueprintReadOnly))
+		if (PropertyFields->Select(TEXT("flags")))
 		{
-			FlagsArray.Add(MakeShared<FJsonValueString>(TEXT("BlueprintReadOnly")));
+			TArray<TSharedPtr<FJsonValue>> FlagsArray;
+			if (Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+			{
+				FlagsArray.Add(MakeShared<FJsonValueString>(TEXT("BlueprintVisible")));
+			}
+			if (Property->HasAnyPropertyFlags(CPF_Edit))
+			{
+				FlagsArray.Add(MakeShared<FJsonValueString>(TEXT("Edit")));
+			}
+			if (Property->HasAnyPropertyFlags(CPF_BlueprintReadOnly))
+			{
+				FlagsArray.Add(MakeShared<FJsonValueString>(TEXT("BlueprintReadOnly")));
+			}
+			PropertyJson->SetArrayField(TEXT("flags"), FlagsArray);
 		}
-		PropertyJson->SetArrayField(TEXT("flags"), FlagsArray);
 
 		PropertiesArray.Add(MakeShared<FJsonValueObject>(PropertyJson));
 	}
 }
 
-void FDataAssetFactoryHandler::ExtractDataAssetDefaults(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& DefaultsArray, const FQueryOptions& Options)
+void FDataAssetFactoryHandler::ExtractDataAssetDefaults(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& DefaultsArray, const FQueryOptions& Options, const FFieldSelection& Fields)
 {
 	if (!DataAssetClass) return;
 
@@ -476,6 +500,12 @@ void FDataAssetFactoryHandler::ExtractDataAssetDefaults(UClass* DataAssetClass,
 			continue;
 		}
 
+		const FFieldSelection* PropertyFields = Fields.SelectElement(Property->GetName());
+		if (!PropertyFields || !PropertyFields->Select(TEXT("default_value")))
+		{
+			continue;
+		}
+
 		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(CDO);
 		if (ValuePtr)
 		{
@@ -490,7 +520,7 @@ void FDataAssetFactoryHandler::ExtractDataAssetDefaults(UClass* DataAssetClass,
 	}
 }
 
-void FDataAssetFactoryHandler::ExtractDataAssetCurrentValues(UDataAsset* DataAsset, TArray<TSharedPtr<FJsonValue>>& CurrentValuesArray, const FQueryOptions& Options)
+void FDataAssetFactoryHandler::ExtractDataAssetCurrentValues(UDataAsset* DataAsset, TArray<TSharedPtr<FJsonValue>>& CurrentValuesArray, const FQueryOptions& Options, const FFieldSelection& Fields)
 {
 	if (!DataAsset) return;
 
@@ -504,6 +534,12 @@ void FDataAssetFactoryHandler::ExtractDataAssetCurrentValues(UDataAsset* DataAss
 			continue;
 		}
 
+		const FFieldSelection* PropertyFields = Fields.SelectElement(Property->GetName());
+		if (!PropertyFields || !PropertyFields->Select(TEXT("current_value")))
+		{
+			continue;
+		}
+
 		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(DataAsset);
 		if (ValuePtr)
 		{
@@ -518,7 +554,7 @@ void FDataAssetFactoryHandler::ExtractDataAssetCurrentValues(UDataAsset* DataAss
 	}
 }
 
-void FDataAssetFactoryHandler::ExtractDataAssetFunctions(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& FunctionsArray, const FQueryOptions& Options)
+void FDataAssetFactoryHandler::ExtractDataAssetFunctions(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& FunctionsArray, const FQueryOptions& Options, const FFieldSelection& Fields)
 {
 	if (!DataAssetClass) return;
 
@@ -532,29 +568,50 @@ void FDataAssetFactoryHandler::ExtractDataAssetFunctions(UClass* DataAssetClass,
 			continue;
 		}
 
+		const FFieldSelection* FunctionFields = Fields.SelectElement(Function->GetName());
+		if (!FunctionFields)
+		{
+			continue;
+		}
+
 		TSharedPtr<FJsonObject> FunctionJson = MakeShared<FJsonObject>();
 		FunctionJson->SetStringField(TEXT("name"), Function->GetName());
-		FunctionJson->SetStringField(TEXT("return_type"), Function->GetReturnProperty() ? Function->GetReturnProperty()->GetCPPType() : TEXT("void"));
+		if (FunctionFields->Select(TEXT("return_type")))
+		{
+			FunctionJson->SetStringField(TEXT("return_type"), Function->GetReturnProperty() ? Function->GetReturnProperty()->GetCPPType() : TEXT("void"));
+		}
 
 		// Extract parameters
-		TArray<TSharedPtr<FJsonValue>> ParametersArray;
-		for (TFieldIterator<FProperty> ParamIt(Function); ParamIt; ++ParamIt)
+		if (const FFieldSelection* ParamFields = FunctionFields->Select(TEXT("parameters")))
 		{
-			FProperty* Param = *ParamIt;
-
-			// Skip return property
-			if (Param == Function->GetReturnProperty())
+			TArray<TSharedPtr<FJsonValue>> ParametersArray;
+			for (TFieldIterator<FProperty> ParamIt(Function); ParamIt; ++ParamIt)
 			{
-				continue;
+				FProperty* Param = *ParamIt;
+
+				// Skip return property
+				if (Param == Function->GetReturnProperty())
+				{
+					continue;
+				}
+
+				const FFieldSelection* ParamSelection = ParamFields->SelectElement(Param->GetName());
+				if (!ParamSelection)
+				{
+					continue;
+				}
+
+				TSharedPtr<FJsonObject> ParamJson = MakeShared<FJsonObject>();
+				ParamJson->SetStringField(TEXT("name"), Param->GetName());
+				if (ParamSelection->Select(TEXT("type")))
+				{
+					ParamJson->SetStringField(TEXT("type"), Param->GetCPPType());
+				}
+				ParametersArray.Add(MakeShared<FJsonValueObject>(ParamJson));
 			}
 
-			TSharedPtr<FJsonObject> ParamJson = MakeShared<FJsonObject>();
-			ParamJson->SetStringField(TEXT("name"), Param->GetName());
-			ParamJson->SetStringField(TEXT("type"), Param->GetCPPType());
-			ParametersArray.Add(MakeShared<FJsonValueObject>(ParamJson));
+			FunctionJson->SetArrayField(TEXT("parameters"), ParametersArray);
 		}
-
-		FunctionJson->SetArrayField(TEXT("parameters"), ParametersArray);
 		FunctionsArray.Add(MakeShared<FJsonValueObject>(FunctionJson));
 	}
 }
@@ -7,6 +7,7 @@
 class UClass;
 class UDataAsset;
 struct FQueryOptions;
+struct FFieldSelection;
 class FJsonObject;
 
 /**
@@ -47,12 +48,13 @@ public:
 	static UDataAsset* FindDataAsset(const FString& DataAssetName);
 
 	/**
-	 * Get all Data Assets of a specific class
+	 * Get a page of the Data Assets of a specific class
 	 * @param DataAssetClass Class to filter by (nullptr for all Data Assets)
 	 * @param Options Query options for depth control
-	 * @return JSON object containing results
+	 * @param Page Requested page (only assets on it are loaded)
+	 * @return Response JSON
 	 */
-	static TSharedPtr<FJsonObject> GetAllDataAssets(UClass* DataAssetClass, const FQueryOptions& Options);
+	static FString GetAllDataAssets(UClass* DataAssetClass, const FQueryOptions& Options, const FPageOptions& Page);
 
 	/**
 	 * Get detailed information about a specific Data Asset
@@ -85,22 +87,26 @@ private:
 
 	/**
 	 * Extract property information from Data Asset class
+	 * @param Fields Selection below "properties"
 	 */
-	static void ExtractDataAssetProperties(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& PropertiesArray, const struct FQueryOptions& Options);
+	static void ExtractDataAssetProperties(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& PropertiesArray, const struct FQueryOptions& Options, const FFieldSelection& Fields);
 
 	/**
 	 * Extract default values from Data Asset class
+	 * @param Fields Selection below "defaults"
 	 */
-	static void ExtractDataAssetDefaults(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& DefaultsArray, const struct FQueryOptions& Options);
+	static void ExtractDataAssetDefaults(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& DefaultsArray, const struct FQueryOptions& Options, const FFieldSelection& Fields);
 
 	/**
 	 * Extract current values from Data Asset instance
+	 * @param Fields Selection below "current_values"
 	 */
-	static void ExtractDataAssetCurrentValues(UDataAsset* DataAsset, TArray<TSharedPtr<FJsonValue>>& CurrentValuesArray, const struct FQueryOptions& Options);
+	static void ExtractDataAssetCurrentValues(UDataAsset* DataAsset, TArray<TSharedPtr<FJsonValue>>& CurrentValuesArray, const struct FQueryOptions& Options, const FFieldSelection& Fields);
 
 	/**
 	 * Extract function information from Data Asset class
+	 * @param Fields Selection below "functions"
 	 */
-	static void ExtractDataAssetFunctions(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& FunctionsArray, const struct FQueryOptions& Options);
+	static void ExtractDataAssetFunctions(UClass* DataAssetClass, TArray<TSharedPtr<FJsonValue>>& FunctionsArray, const struct FQueryOptions& Options, const FFieldSelection& Fields);
 };
 
@@ -16,9 +16,14 @@
 #include "LevelFactoryHandler.h"
 #include "LevelEditHandler.h"
 #include "BulkEditHandler.h"
+#include "AssetIndex.h"
+#include "ResponseCache.h"
+#include "ChangeFeed.h"
 #include "HttpServerModule.h"
 #include "HttpServerResponse.h"
 #include "IHttpRouter.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
 #include "Engine/DirectionalLight.h"
 #include "Engine/SkyLight.h"
 #include "HttpPath.h"
@@ -94,6 +99,7 @@ bool FHttpServerManager::StartServer()
 
 	// Register routes
 	RegisterRoutes();
+	Pipeline.Start();
 
 	// Start listening
 	HttpServerModule.StartAllListeners();
@@ -114,6 +120,8 @@ void FHttpServerManager::StopServer()
 
 	// Unregister routes
 	UnregisterRoutes();
+	FChangeFeed::Get().ReleaseWaiters();
+	Pipeline.Stop();
 
 	// Stop server
 	if (FModuleManager::Get().IsModuleLoaded("HTTPServer"))
@@ -139,66 +147,66 @@ void FHttpServerManager::RegisterRoutes()
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/status")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleStatus)
+		Pipelined(&FHttpServerManager::HandleStatus)
 	));
 
 	// Blueprint endpoints
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/blueprints")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetBlueprints)
+		Pipelined(&FHttpServerManager::HandleGetBlueprints)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/blueprints/:name")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetBlueprint)
+		Pipelined(&FHttpServerManager::HandleGetBlueprint)
 	));
 
 	// Level endpoints
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/levels")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetLevels)
+		Pipelined(&FHttpServerManager::HandleGetLevels)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/levels/:name/actors")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetLevelActors)
+		Pipelined(&FHttpServerManager::HandleGetLevelActors)
 	));
 
 	// Asset endpoints
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/assets")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetAssets)
+		Pipelined(&FHttpServerManager::HandleGetAssets)
 	));
 
 	// Gameplay endpoints
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/characters")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetCharacters)
+		Pipelined(&FHttpServerManager::HandleGetCharacters)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/weapons")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetWeapons)
+		Pipelined(&FHttpServerManager::HandleGetWeapons)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/ai")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetAI)
+		Pipelined(&FHttpServerManager::HandleGetAI)
 	));
 
 	// Search endpoint
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/search")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleSearch)
+		Pipelined(&FHttpServerManager::HandleSearch)
 	));
 
 	// ========================================================================
@@ -209,94 +217,101 @@ void FHttpServerManager::RegisterRoutes()
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/blueprints/:name/properties")),
 		EHttpServerRequestVerbs::VERB_PATCH,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleEditBlueprintProperties)
+		Pipelined(&FHttpServerManager::HandleEditBlueprintProperties)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/blueprints/:name/properties/validate")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleValidateProperties)
+		Pipelined(&FHttpServerManager::HandleValidateProperties)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/blueprints/:name/duplicate")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleDuplicateBlueprint)
+		Pipelined(&FHttpServerManager::HandleDuplicateBlueprint)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/blueprints")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleCreateBlueprint)
+		Pipelined(&FHttpServerManager::HandleCreateBlueprint)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/data-assets")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetDataAssets)
+		Pipelined(&FHttpServerManager::HandleGetDataAssets)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/data-assets")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleCreateDataAsset)
+		Pipelined(&FHttpServerManager::HandleCreateDataAsset)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/data-assets/:name")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleGetDataAsset)
+		Pipelined(&FHttpServerManager::HandleGetDataAsset)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/data-assets/:name/properties")),
 		EHttpServerRequestVerbs::VERB_PATCH,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleEditDataAssetProperties)
+		Pipelined(&FHttpServerManager::HandleEditDataAssetProperties)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/data-assets/:name/properties/validate")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleValidateDataAssetProperties)
+		Pipelined(&FHttpServerManager::HandleValidateDataAssetProperties)
 	));
 
 	// Level edit endpoints
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/levels/:name/actors")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleSpawnActor)
+		Pipelined(&FHttpServerManager::HandleSpawnActor)
 	));
 
 	// Level creation/duplication endpoints
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/levels")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleCreateLevel)
+		Pipelined(&FHttpServerManager::HandleCreateLevel)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/levels/:name/duplicate")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleDuplicateLevel)
+		Pipelined(&FHttpServerManager::HandleDuplicateLevel)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/levels/:name/environment")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleAddEnvironment)
+		Pipelined(&FHttpServerManager::HandleAddEnvironment)
 	));
 
 	// Bulk edit endpoints
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/blueprints/bulk")),
 		EHttpServerRequestVerbs::VERB_PATCH,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleBulkEdit)
+		Pipelined(&FHttpServerManager::HandleBulkEdit)
 	));
 
 	RouteHandles.Add(HttpRouter->BindRoute(
 		FHttpPath(TEXT("/api/batch")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FHttpServerManager::HandleBatch)
+		Pipelined(&FHttpServerManager::HandleBatch)
+	));
+
+	// Change feed
+	RouteHandles.Add(HttpRouter->BindRoute(
+		FHttpPath(TEXT("/api/changes")),
+		EHttpServerRequestVerbs::VERB_GET,
+		Pipelined(&FHttpServerManager::HandleGetChanges)
 	));
 
 	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Registered %d API routes"), RouteHandles.Num());
@@ -314,6 +329,14 @@ void FHttpServerManager::UnregisterRoutes()
 	RouteHandles.Empty();
 }
 
+FHttpRequestHandler FHttpServerManager::Pipelined(bool (FHttpServerManager::*Handler)(const FHttpServerRequest&, const FHttpResultCallback&))
+{
+	return Pipeline.Wrap([this, Handler](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		return (this->*Handler)(Request, OnComplete);
+	});
+}
+
 // ============================================================================
 // Route Handlers
 // ============================================================================
@@ -328,6 +351,21 @@ bool FHttpServerManager::HandleStatus(const FHttpServerRequest& Request, const F
 	JsonObject->SetStringField(TEXT("version"), TEXT("2.3.7"));
 	JsonObject->SetStringField(TEXT("plugin"), TEXT("RevoltUnrealPlugin"));
 
+	const FResponseCache& Cache = FResponseCache::Get();
+	TSharedPtr<FJsonObject> CacheJson = MakeShared<FJsonObject>();
+	CacheJson->SetNumberField(TEXT("entries"), Cache.Num());
+	CacheJson->SetNumberField(TEXT("hits"), (double)Cache.GetHits());
+	CacheJson->SetNumberField(TEXT("misses"), (double)Cache.GetMisses());
+	JsonObject->SetObjectField(TEXT("response_cache"), CacheJson);
+	JsonObject->SetObjectField(TEXT("pipeline"), Pipeline.GetStats());
+
+	const FChangeFeed& Feed = FChangeFeed::Get();
+	TSharedPtr<FJsonObject> FeedJson = MakeShared<FJsonObject>();
+	FeedJson->SetStringField(TEXT("epoch"), Feed.GetEpoch());
+	FeedJson->SetNumberField(TEXT("last_sequence"), (double)Feed.GetLastSequence());
+	FeedJson->SetNumberField(TEXT("waiting_polls"), Feed.NumWaiters());
+	JsonObject->SetObjectField(TEXT("change_feed"), FeedJson);
+
 	OnComplete(CreateJsonResponse(JsonObject));
 	return true;
 }
@@ -336,14 +374,17 @@ bool FHttpServerManager::HandleGetBlueprints(const FHttpServerRequest& Request,
 {
 	LogRequest(Request);
 
-	// Parse query options
-	FString QueryString = Request.QueryParams.Contains(TEXT("query")) ? Request.QueryParams[TEXT("query")] : TEXT("");
-	FQueryOptions Options = FQueryOptions::ParseFromQueryString(Request.QueryParams.Contains(TEXT("")) ? Request.QueryParams[TEXT("")] : TEXT(""));
+	// Parse query options (depth flags and fields projection)
+	FQueryOptions Options = FQueryOptions::ParseFromQueryParams(Request.QueryParams);
 
-	// Get blueprints
-	TSharedPtr<FJsonObject> Result = FBlueprintQueryHandler::GetAllBlueprints(Options);
+	FPageOptions Page;
+	if (!ParsePageOptions(Request, GetDefault<URevoltSettings>()->MaxPageSize, Page, OnComplete))
+	{
+		return true;
+	}
 
-	OnComplete(CreateJsonResponse(Result));
+	// Get blueprints
+	OnComplete(CreateJsonTextResponse(FBlueprintQueryHandler::GetAllBlueprints(Options, Page)));
 	return true;
 }
 
@@ -359,27 +400,34 @@ bool FHttpServerManager::HandleGetBlueprint(const FHttpServerRequest& Request, c
 	}
 
 	// Parse query options from query string
-	FString QueryString;
-	for (const auto& Param : Request.QueryParams)
+	FQueryOptions Options = FQueryOptions::ParseFromQueryParams(Request.QueryParams);
+
+	// Resolve the name without loading, so a cached response can be served for the asset
+	FAssetData AssetData;
+	if (FAssetIndex::Get().FindByName(BlueprintName, EIndexedAssetKind::Blueprint, AssetData))
 	{
-		if (!QueryString.IsEmpty())
+		const FString CacheKey = AssetData.GetObjectPathString() + TEXT("?") + Options.GetCacheKey();
+		FResponseCache& Cache = FResponseCache::Get();
+
+		FString Json;
+		FString ETag;
+		if (Cache.Find(AssetData.PackageName, CacheKey, Json, ETag))
 		{
-			QueryString += TEXT("&");
+			OnComplete(CreateETagResponse(Request, Json, ETag));
+			return true;
 		}
-		QueryString += Param.Key + TEXT("=") + Param.Value;
-	}
-	FQueryOptions Options = FQueryOptions::ParseFromQueryString(QueryString);
 
-	// Get specific blueprint
-	TSharedPtr<FJsonObject> Result = FBlueprintQueryHandler::GetBlueprint(BlueprintName, Options);
-
-	if (!Result)
-	{
-		OnComplete(CreateErrorResponse(FString::Printf(TEXT("Blueprint '%s' not found"), *BlueprintName), EHttpServerResponseCodes::NotFound));
-		return true;
+		const uint32 Generation = Cache.GetGeneration(AssetData.PackageName);
+		if (UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+		{
+			Json = FRequestPipeline::SerializeJson(FBlueprintQueryHandler::ExtractBlueprintInfo(Blueprint, Options));
+			ETag = Cache.Add(AssetData.PackageName, CacheKey, Json, Generation);
+			OnComplete(CreateETagResponse(Request, Json, ETag));
+			return true;
+		}
 	}
 
-	OnComplete(CreateJsonResponse(Result));
+	OnComplete(CreateErrorResponse(FString::Printf(TEXT("Blueprint '%s' not found"), *BlueprintName), EHttpServerResponseCodes::NotFound));
 	return true;
 }
 
@@ -387,8 +435,13 @@ bool FHttpServerManager::HandleGetLevels(const FHttpServerRequest& Request, cons
 {
 	LogRequest(Request);
 
-	TSharedPtr<FJsonObject> Result = FLevelQueryHandler::GetAllLevels();
-	OnComplete(CreateJsonResponse(Result));
+	FPageOptions Page;
+	if (!ParsePageOptions(Request, GetDefault<URevoltSettings>()->MaxPageSize, Page, OnComplete))
+	{
+		return true;
+	}
+
+	OnComplete(CreateJsonTextResponse(FLevelQueryHandler::GetAllLevels(Page)));
 	return true;
 }
 
@@ -403,28 +456,29 @@ bool FHttpServerManager::HandleGetLevelActors(const FHttpServerRequest& Request,
 		return true;
 	}
 
-	// Parse query options
-	FString QueryString;
-	for (const auto& Param : Request.QueryParams)
+	// Actor listings default to the summary that can be served without loading the level
+	FQueryOptions Defaults;
+	Defaults.bIncludeComponents = false;
+	Defaults.bIncludeProperties = false;
+	FQueryOptions Options = FQueryOptions::ParseFromQueryParams(Request.QueryParams, Defaults);
+
+	// Actor pages are capped by the per-query actor limit
+	FPageOptions Page;
+	if (!ParsePageOptions(Request, GetDefault<URevoltSettings>()->MaxActorsPerQuery, Page, OnComplete))
 	{
-		if (!QueryString.IsEmpty())
-		{
-			QueryString += TEXT("&");
-		}
-		QueryString += Param.Key + TEXT("=") + Param.Value;
+		return true;
 	}
-	FQueryOptions Options = FQueryOptions::ParseFromQueryString(QueryString);
 
 	// Get level actors
-	TSharedPtr<FJsonObject> Result = FLevelQueryHandler::GetLevelActors(LevelName, Options);
+	FString Result = FLevelQueryHandler::GetLevelActors(LevelName, Options, Page);
 
-	if (!Result)
+	if (Result.IsEmpty())
 	{
 		OnComplete(CreateErrorResponse(FString::Printf(TEXT("Level '%s' not found or could not be loaded"), *LevelName), EHttpServerResponseCodes::NotFound));
 		return true;
 	}
 
-	OnComplete(CreateJsonResponse(Result));
+	OnComplete(CreateJsonTextResponse(Result));
 	return true;
 }
 
@@ -433,9 +487,14 @@ bool FHttpServerManager::HandleGetAssets(const FHttpServerRequest& Request, cons
 	LogRequest(Request);
 
 	FString AssetType = Request.QueryParams.Contains(TEXT("type")) ? Request.QueryParams[TEXT("type")] : TEXT("");
-	
-	TSharedPtr<FJsonObject> Result = FAssetQueryHandler::QueryAssets(AssetType);
-	OnComplete(CreateJsonResponse(Result));
+
+	FPageOptions Page;
+	if (!ParsePageOptions(Request, GetDefault<URevoltSettings>()->MaxPageSize, Page, OnComplete))
+	{
+		return true;
+	}
+
+	OnComplete(CreateJsonTextResponse(FAssetQueryHandler::QueryAssets(AssetType, Page)));
 	return true;
 }
 
@@ -444,16 +503,7 @@ bool FHttpServerManager::HandleGetCharacters(const FHttpServerRequest& Request,
 	LogRequest(Request);
 
 	// Parse query options
-	FString QueryString;
-	for (const auto& Param : Request.QueryParams)
-	{
-		if (!QueryString.IsEmpty())
-		{
-			QueryString += TEXT("&");
-		}
-		QueryString += Param.Key + TEXT("=") + Param.Value;
-	}
-	FQueryOptions Options = FQueryOptions::ParseFromQueryString(QueryString);
+	FQueryOptions Options = FQueryOptions::ParseFromQueryParams(Request.QueryParams);
 
 	TSharedPtr<FJsonObject> Result = FGameplayQueryHandler::GetCharacters(Options);
 	OnComplete(CreateJsonResponse(Result));
@@ -465,16 +515,7 @@ bool FHttpServerManager::HandleGetWeapons(const FHttpServerRequest& Request, con
 	LogRequest(Request);
 
 	// Parse query options
-	FString QueryString;
-	for (const auto& Param : Request.QueryParams)
-	{
-		if (!QueryString.IsEmpty())
-		{
-			QueryString += TEXT("&");
-		}
-		QueryString += Param.Key + TEXT("=") + Param.Value;
-	}
-	FQueryOptions Options = FQueryOptions::ParseFromQueryString(QueryString);
+	FQueryOptions Options = FQueryOptions::ParseFromQueryParams(Request.QueryParams);
 
 	TSharedPtr<FJsonObject> Result = FGameplayQueryHandler::GetWeapons(Options);
 	OnComplete(CreateJsonResponse(Result));
@@ -486,16 +527,7 @@ bool FHttpServerManager::HandleGetAI(const FHttpServerRequest& Request, const FH
 	LogRequest(Request);
 
 	// Parse query options
-	FString QueryString;
-	for (const auto& Param : Request.QueryParams)
-	{
-		if (!QueryString.IsEmpty())
-		{
-			QueryString += TEXT("&");
-		}
-		QueryString += Param.Key + TEXT("=") + Param.Value;
-	}
-	FQueryOptions Options = FQueryOptions::ParseFromQueryString(QueryString);
+	FQueryOptions Options = FQueryOptions::ParseFromQueryParams(Request.QueryParams);
 
 	TSharedPtr<FJsonObject> Result = FGameplayQueryHandler::GetAIConfigurations(Options);
 	OnComplete(CreateJsonResponse(Result));
@@ -514,8 +546,13 @@ bool FHttpServerManager::HandleSearch(const FHttpServerRequest& Request, const F
 		return true;
 	}
 
-	TSharedPtr<FJsonObject> Result = FAssetQueryHandler::SearchAssets(SearchQuery);
-	OnComplete(CreateJsonResponse(Result));
+	FPageOptions Page;
+	if (!ParsePageOptions(Request, GetDefault<URevoltSettings>()->MaxPageSize, Page, OnComplete))
+	{
+		return true;
+	}
+
+	OnComplete(CreateJsonTextResponse(FAssetQueryHandler::SearchAssets(SearchQuery, Page)));
 	return true;
 }
 
@@ -1610,6 +1647,8 @@ bool FHttpServerManager::HandleBulkEdit(const FHttpServerRequest& Request, const
 	RequestJson->TryGetBoolField(TEXT("preview"), bPreview);
 
 	// Filter blueprints
+	FBulkPhaseTimer Timer;
+	Timer.StartPhase(TEXT("resolve"));
 	TArray<UBlueprint*> MatchingBlueprints = FBulkEditHandler::FilterBlueprints(Filter);
 
 	if (bPreview)
@@ -1636,7 +1675,7 @@ bool FHttpServerManager::HandleBulkEdit(const FHttpServerRequest& Request, const
 
 	// Execute bulk edit
 	TArray<TSharedPtr<FJsonObject>> Results;
-	bool bSuccess = FBulkEditHandler::BulkEditProperties(MatchingBlueprints, Properties, Results);
+	bool bSuccess = FBulkEditHandler::BulkEditProperties(MatchingBlueprints, Properties, Results, Timer);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
@@ -1644,6 +1683,7 @@ bool FHttpServerManager::HandleBulkEdit(const FHttpServerRequest& Request, const
 	Response->SetNumberField(TEXT("total_count"), MatchingBlueprints.Num());
 	Response->SetNumberField(TEXT("success_count"), Results.Num());
 	Response->SetArrayField(TEXT("results"), ConvertToJsonValueArray(Results));
+	Response->SetObjectField(TEXT("timings"), Timer.Finish());
 
 	OnComplete(CreateJsonResponse(Response));
 	return true;
@@ -1673,326 +1713,253 @@ bool FHttpServerManager::HandleBatch(const FHttpServerRequest& Request, const FH
 	bool bAtomic = false;
 	RequestJson->TryGetBoolField(TEXT("atomic"), bAtomic);
 
-	// Start transaction if atomic
-	if (bAtomic)
+	// Compile and save once per blueprint after all of its operations
+	const URevoltSettings* Settings = GetDefault<URevoltSettings>();
+	bool bCompile = Settings ? Settings->bAutoCompile : true;
+	bool bSave = true;
+	RequestJson->TryGetBoolField(TEXT("compile"), bCompile);
+	RequestJson->TryGetBoolField(TEXT("save"), bSave);
+
+	FBulkPhaseTimer Timer;
+
+	// Resolve: look up each target once and group blueprint operations by target, keeping their order
+	Timer.StartPhase(TEXT("resolve"));
+
+	struct FBatchGroup
 	{
-		FTransactionManager::Get().BeginTransaction(TEXT("Batch Operations"));
-	}
+		UBlueprint* Blueprint = nullptr;
+		TArray<int32> Operations;
+		bool bNeedsCompile = false;
+		bool bModified = false;
 
-	TArray<TSharedPtr<FJsonValue>> Results;
+		/** Compiled ahead of a property edit; the compile phase then only runs for later structural changes */
+		bool bCompiledInApply = false;
+	};
+
+	const int32 NumOperations = OperationsArray->Num();
+	TArray<TSharedPtr<FJsonObject>> Operations;
+	TArray<TSharedPtr<FJsonObject>> OpResults;
+	Operations.SetNum(NumOperations);
+	OpResults.SetNum(NumOperations);
+
+	TArray<FBatchGroup> Groups;
+	TMap<UBlueprint*, int32> GroupByBlueprint;
+	TMap<FString, UBlueprint*> BlueprintByTarget;
+	TArray<int32> LevelOperations;
 	bool bAllSucceeded = true;
 
-	for (const auto& OpValue : *OperationsArray)
+	for (int32 Index = 0; Index < NumOperations; ++Index)
 	{
 		const TSharedPtr<FJsonObject>* OpObj;
-		if (!OpValue->TryGetObject(OpObj))
+		if (!(*OperationsArray)[Index]->TryGetObject(OpObj))
 		{
 			continue;
 		}
+		Operations[Index] = *OpObj;
 
 		FString OpType;
 		(*OpObj)->TryGetStringField(TEXT("type"), OpType);
 
 		TSharedPtr<FJsonObject> OpResult = MakeShared<FJsonObject>();
+		OpResult->SetNumberField(TEXT("operation"), Index);
 		OpResult->SetStringField(TEXT("type"), OpType);
+		OpResults[Index] = OpResult;
 
-		// Execute based on operation type
-		if (OpType == TEXT("edit_property"))
+		if (OpType == TEXT("spawn_actor"))
 		{
-			// Individual property edit
-			FString Target;
-			(*OpObj)->TryGetStringField(TEXT("target"), Target);
-			
-			UBlueprint* BP = FBlueprintEditHandler::FindBlueprint(Target);
-			if (BP)
-			{
-				FString PropertyName, Value, OldValue;
-				(*OpObj)->TryGetStringField(TEXT("property"), PropertyName);
-				(*OpObj)->TryGetStringField(TEXT("value"), Value);
-
-				bool bSuccess = FBlueprintEditHandler::EditBlueprintProperty(BP, *PropertyName, Value, OldValue);
-				OpResult->SetBoolField(TEXT("success"), bSuccess);
-				
-				if (!bSuccess && bAtomic)
-				{
-					bAllSucceeded = false;
-					break;
-				}
-			}
-			else
-			{
-				OpResult->SetBoolField(TEXT("success"), false);
-				OpResult->SetStringField(TEXT("error"), TEXT("Blueprint not found"));
-				if (bAtomic) { bAllSucceeded = false; break; }
-			}
+			LevelOperations.Add(Index);
+			continue;
 		}
-		else if (OpType == TEXT("add_variable"))
-		{
-			FString Target, Name, Type;
-			(*OpObj)->TryGetStringField(TEXT("blueprint"), Target);
-			(*OpObj)->TryGetStringField(TEXT("name"), Name);
-			(*OpObj)->TryGetStringField(TEXT("type"), Type);
 
-			UBlueprint* BP = FBlueprintEditHandler::FindBlueprint(Target);
-			if (BP)
-			{
-				FString Error;
-				FString ResultName = FBlueprintEditHandler::AddBlueprintVariable(BP, Name, Type, Error);
-				if (!ResultName.IsEmpty())
-				{
-					OpResult->SetBoolField(TEXT("success"), true);
-					OpResult->SetStringField(TEXT("variable_name"), ResultName);
-				}
-				else
-				{
-					OpResult->SetBoolField(TEXT("success"), false);
-					OpResult->SetStringField(TEXT("error"), Error);
-					if (bAtomic) { bAllSucceeded = false; break; }
-				}
-			}
-			else
-			{
-				OpResult->SetBoolField(TEXT("success"), false);
-				OpResult->SetStringField(TEXT("error"), TEXT("Blueprint not found"));
-				if (bAtomic) { bAllSucceeded = false; break; }
-			}
-		}
-		else if (OpType == TEXT("add_function"))
+		if (!FBulkEditHandler::IsBlueprintOperation(OpType))
 		{
-			FString Target, Name;
-			(*OpObj)->TryGetStringField(TEXT("blueprint"), Target);
-			(*OpObj)->TryGetStringField(TEXT("name"), Name);
+			OpResult->SetBoolField(TEXT("success"), false);
+			OpResult->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown operation type '%s'"), *OpType));
+			if (bAtomic) { bAllSucceeded = false; break; }
+			continue;
+		}
 
-			UBlueprint* BP = FBlueprintEditHandler::FindBlueprint(Target);
-			if (BP)
-			{
-				FString Error;
-				FString ResultName = FBlueprintEditHandler::AddBlueprintFunction(BP, Name, Error);
-				if (!ResultName.IsEmpty())
-				{
-					OpResult->SetBoolField(TEXT("success"), true);
-					OpResult->SetStringField(TEXT("function_name"), ResultName);
-				}
-				else
-				{
-					OpResult->SetBoolField(TEXT("success"), false);
-					OpResult->SetStringField(TEXT("error"), Error);
-					if (bAtomic) { bAllSucceeded = false; break; }
-				}
-			}
-			else
-			{
-				OpResult->SetBoolField(TEXT("success"), false);
-				OpResult->SetStringField(TEXT("error"), TEXT("Blueprint not found"));
-				if (bAtomic) { bAllSucceeded = false; break; }
-			}
+		// Property edits name their blueprint "target", the graph and component operations "blueprint"
+		FString Target;
+		(*OpObj)->TryGetStringField(OpType == TEXT("edit_property") ? TEXT("target") : TEXT("blueprint"), Target);
+
+		UBlueprint** FoundBlueprint = BlueprintByTarget.Find(Target);
+		UBlueprint* BP = FoundBlueprint ? *FoundBlueprint : BlueprintByTarget.Add(Target, FBlueprintEditHandler::FindBlueprint(Target));
+		if (!BP)
+		{
+			OpResult->SetBoolField(TEXT("success"), false);
+			OpResult->SetStringField(TEXT("error"), TEXT("Blueprint not found"));
+			if (bAtomic) { bAllSucceeded = false; break; }
+			continue;
 		}
-		else if (OpType == TEXT("add_node"))
+
+		int32* GroupIndex = GroupByBlueprint.Find(BP);
+		if (!GroupIndex)
 		{
-			FString Target, GraphName, NodeClass;
-			int32 X = 0, Y = 0;
-			(*OpObj)->TryGetStringField(TEXT("blueprint"), Target);
-			(*OpObj)->TryGetStringField(TEXT("graph"), GraphName);
-			(*OpObj)->TryGetStringField(TEXT("node_class"), NodeClass);
-			(*OpObj)->TryGetNumberField(TEXT("x"), X);
-			(*OpObj)->TryGetNumberField(TEXT("y"), Y);
-
-			TMap<FString, FString> Properties;
-			const TSharedPtr<FJsonObject>* PropsObj;
-			if ((*OpObj)->TryGetObjectField(TEXT("properties"), PropsObj))
-			{
-				for (const auto& Pair : (*PropsObj)->Values)
-				{
-					FString Val;
-					if (Pair.Value->TryGetString(Val)) Properties.Add(Pair.Key, Val);
-				}
-			}
+			GroupIndex = &GroupByBlueprint.Add(BP, Groups.AddDefaulted());
+			Groups[*GroupIndex].Blueprint = BP;
+		}
+		Groups[*GroupIndex].Operations.Add(Index);
+	}
 
-			UBlueprint* BP = FBlueprintEditHandler::FindBlueprint(Target);
-			if (BP)
-			{
-				FString Error;
-				UEdGraphNode* NewNode = FBlueprintEditHandler::AddGraphNode(BP, GraphName, NodeClass, X, Y, Properties, Error);
-				if (NewNode)
-				{
-					OpResult->SetBoolField(TEXT("success"), true);
-					OpResult->SetStringField(TEXT("node_name"), NewNode->GetName());
-					OpResult->SetStringField(TEXT("node_guid"), NewNode->NodeGuid.ToString());
-				}
-				else
-				{
-					OpResult->SetBoolField(TEXT("success"), false);
-					OpResult->SetStringField(TEXT("error"), Error);
-					if (bAtomic) { bAllSucceeded = false; break; }
-				}
-			}
-			else
-			{
-				OpResult->SetBoolField(TEXT("success"), false);
-				OpResult->SetStringField(TEXT("error"), TEXT("Blueprint not found"));
-				if (bAtomic) { bAllSucceeded = false; break; }
-			}
+	// Start transaction if atomic
+	if (bAtomic && bAllSucceeded)
+	{
+		FTransactionManager::Get().BeginTransaction(TEXT("Batch Operations"));
+	}
+
+	// Apply: all operations of a blueprint back to back, without compiling in between
+	Timer.StartPhase(TEXT("apply"));
+
+	int32 NumCompiles = 0;
+	TArray<UBlueprint*> FailedCompiles;
+	for (FBatchGroup& Group : Groups)
+	{
+		if (!bAllSucceeded)
+		{
+			break;
 		}
-		else if (OpType == TEXT("connect_pins"))
+
+		Group.Blueprint->Modify();
+
+		// Property edits roll back in memory; structural changes need the file from before the batch
+		if (bAtomic && Settings && Settings->bAutoBackup)
 		{
-			FString Target, GraphName;
-			FString NodeA, PinA, NodeB, PinB;
-			(*OpObj)->TryGetStringField(TEXT("blueprint"), Target);
-			(*OpObj)->TryGetStringField(TEXT("graph"), GraphName);
-			(*OpObj)->TryGetStringField(TEXT("node_a"), NodeA);
-			(*OpObj)->TryGetStringField(TEXT("pin_a"), PinA);
-			(*OpObj)->TryGetStringField(TEXT("node_b"), NodeB);
-			(*OpObj)->TryGetStringField(TEXT("pin_b"), PinB);
-
-			UBlueprint* BP = FBlueprintEditHandler::FindBlueprint(Target);
-			if (BP)
+			const bool bStructural = Group.Operations.ContainsByPredicate([&Operations](int32 Index)
 			{
-				FString Error;
-				bool bConnected = FBlueprintEditHandler::ConnectNodePins(BP, GraphName, NodeA, PinA, NodeB, PinB, Error);
-				OpResult->SetBoolField(TEXT("success"), bConnected);
-				if (!bConnected)
-				{
-					OpResult->SetStringField(TEXT("error"), Error);
-					if (bAtomic) { bAllSucceeded = false; break; }
-				}
-			}
-			else
+				return Operations[Index]->GetStringField(TEXT("type")) != TEXT("edit_property");
+			});
+			if (bStructural)
 			{
-				OpResult->SetBoolField(TEXT("success"), false);
-				OpResult->SetStringField(TEXT("error"), TEXT("Blueprint not found"));
-				if (bAtomic) { bAllSucceeded = false; break; }
+				TSharedPtr<FJsonObject> Change = MakeShared<FJsonObject>();
+				Change->SetStringField(TEXT("type"), TEXT("structural"));
+				FTransactionManager::Get().RecordChange(Group.Blueprint->GetOutermost()->GetName(), FBackupManager::CreateBlueprintBackup(Group.Blueprint), Change);
 			}
 		}
-		else if (OpType == TEXT("delete_node"))
+
+		for (int32 Index : Group.Operations)
 		{
-			FString Target, GraphName, NodeName;
-			(*OpObj)->TryGetStringField(TEXT("blueprint"), Target);
-			(*OpObj)->TryGetStringField(TEXT("graph"), GraphName);
-			(*OpObj)->TryGetStringField(TEXT("node"), NodeName);
+			FString OpType;
+			Operations[Index]->TryGetStringField(TEXT("type"), OpType);
 
-			UBlueprint* BP = FBlueprintEditHandler::FindBlueprint(Target);
-			if (BP)
+			// A property edit after a structural change needs the new class, so compile what is pending first
+			if (OpType == TEXT("edit_property") && Group.bNeedsCompile)
 			{
-				FString Error;
-				bool bDeleted = FBlueprintEditHandler::RemoveGraphNode(BP, GraphName, NodeName, Error);
-				OpResult->SetBoolField(TEXT("success"), bDeleted);
-				if (!bDeleted)
+				Timer.StartPhase(TEXT("compile"));
+				const bool bCompiled = FBlueprintEditHandler::CompileBlueprint(Group.Blueprint, false);
+				++NumCompiles;
+				Group.bNeedsCompile = false;
+				Group.bCompiledInApply = true;
+				Timer.StartPhase(TEXT("apply"));
+
+				// The class is broken, so neither this edit nor the rest of the blueprint's operations can run
+				if (!bCompiled)
 				{
-					OpResult->SetStringField(TEXT("error"), Error);
-					if (bAtomic) { bAllSucceeded = false; break; }
+					FailedCompiles.Add(Group.Blueprint);
+					OpResults[Index]->SetBoolField(TEXT("success"), false);
+					OpResults[Index]->SetStringField(TEXT("error"), TEXT("Blueprint compilation failed"));
+					if (bAtomic)
+					{
+						bAllSucceeded = false;
+					}
+					break;
 				}
 			}
-			else
+
+			const bool bSuccess = FBulkEditHandler::ApplyBatchOperation(Group.Blueprint, OpType, Operations[Index], OpResults[Index], Group.bNeedsCompile);
+			Group.bModified |= bSuccess;
+			if (!bSuccess && bAtomic)
 			{
-				OpResult->SetBoolField(TEXT("success"), false);
-				OpResult->SetStringField(TEXT("error"), TEXT("Blueprint not found"));
-				if (bAtomic) { bAllSucceeded = false; break; }
+				bAllSucceeded = false;
+				break;
 			}
 		}
-		else if (OpType == TEXT("add_component"))
+
+		// Mark dirty once for the whole group
+		if (Group.bModified)
 		{
-			FString Target, ComponentClass, ComponentName, ParentName;
-			(*OpObj)->TryGetStringField(TEXT("blueprint"), Target);
-			(*OpObj)->TryGetStringField(TEXT("class"), ComponentClass);
-			(*OpObj)->TryGetStringField(TEXT("name"), ComponentName);
-			(*OpObj)->TryGetStringField(TEXT("parent"), ParentName);
-
-			UBlueprint* BP = FBlueprintEditHandler::FindBlueprint(Target);
-			if (BP)
-			{
-				FString Error;
-				FString ResultName = FBlueprintEditHandler::AddComponent(BP, ComponentClass, ComponentName, ParentName, Error);
-				if (!ResultName.IsEmpty())
-				{
-					OpResult->SetBoolField(TEXT("success"), true);
-					OpResult->SetStringField(TEXT("component_name"), ResultName);
-				}
-				else
-				{
-					OpResult->SetBoolField(TEXT("success"), false);
-					OpResult->SetStringField(TEXT("error"), Error);
-					if (bAtomic) { bAllSucceeded = false; break; }
-				}
-			}
-			else
-			{
-				OpResult->SetBoolField(TEXT("success"), false);
-				OpResult->SetStringField(TEXT("error"), TEXT("Blueprint not found"));
-				if (bAtomic) { bAllSucceeded = false; break; }
-			}
+			FBlueprintEditorUtils::MarkBlueprintAsModified(Group.Blueprint);
 		}
-		else if (OpType == TEXT("remove_component"))
+	}
+
+	// Compile: every modified blueprint once, with a single garbage collection at the end
+	Timer.StartPhase(TEXT("compile"));
+
+	TArray<UBlueprint*> ModifiedBlueprints;
+	TArray<UBlueprint*> BlueprintsToCompile;
+	for (const FBatchGroup& Group : Groups)
+	{
+		if (Group.bModified)
 		{
-			FString Target, ComponentName;
-			(*OpObj)->TryGetStringField(TEXT("blueprint"), Target);
-			(*OpObj)->TryGetStringField(TEXT("name"), ComponentName);
+			ModifiedBlueprints.Add(Group.Blueprint);
 
-			UBlueprint* BP = FBlueprintEditHandler::FindBlueprint(Target);
-			if (BP)
-			{
-				FString Error;
-				bool bRemoved = FBlueprintEditHandler::RemoveComponent(BP, ComponentName, Error);
-				OpResult->SetBoolField(TEXT("success"), bRemoved);
-				if (!bRemoved)
-				{
-					OpResult->SetStringField(TEXT("error"), Error);
-					if (bAtomic) { bAllSucceeded = false; break; }
-				}
-			}
-			else
+			// Already compiled ahead of a property edit, and nothing structural changed since
+			if (!FailedCompiles.Contains(Group.Blueprint) && (!Group.bCompiledInApply || Group.bNeedsCompile))
 			{
-				OpResult->SetBoolField(TEXT("success"), false);
-				OpResult->SetStringField(TEXT("error"), TEXT("Blueprint not found"));
-				if (bAtomic) { bAllSucceeded = false; break; }
+				BlueprintsToCompile.Add(Group.Blueprint);
 			}
 		}
-		else if (OpType == TEXT("spawn_actor"))
+	}
+
+	if (bAllSucceeded && bCompile && BlueprintsToCompile.Num() > 0)
+	{
+		NumCompiles += FBlueprintEditHandler::CompileBlueprints(BlueprintsToCompile, FailedCompiles);
+	}
+	else if (NumCompiles > 0)
+	{
+		// Compiles ahead of property edits skip garbage collection, leaving it to this phase
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	// Includes compiles that failed ahead of a property edit
+	if (FailedCompiles.Num() > 0)
+	{
+		bAllSucceeded = false;
+	}
+
+	// Level operations run after the compile so spawned actors use the updated classes
+	Timer.StartPhase(TEXT("level"));
+
+	TMap<FString, UWorld*> WorldByLevel;
+	for (int32 Index : LevelOperations)
+	{
+		if (bAtomic && !bAllSucceeded)
 		{
-			// Actor spawning
-			FString LevelName, ActorClass;
-			(*OpObj)->TryGetStringField(TEXT("level"), LevelName);
-			(*OpObj)->TryGetStringField(TEXT("actor"), ActorClass);
-
-			// Get location
-			FVector Location = FVector::ZeroVector;
-			const TSharedPtr<FJsonObject>* LocationObj;
-			if ((*OpObj)->TryGetObjectField(TEXT("location"), LocationObj))
-			{
-				(*LocationObj)->TryGetNumberField(TEXT("x"), Location.X);
-				(*LocationObj)->TryGetNumberField(TEXT("y"), Location.Y);
-				(*LocationObj)->TryGetNumberField(TEXT("z"), Location.Z);
-			}
+			break;
+		}
 
-			UWorld* World = FLevelEditHandler::LoadLevelForEditing(LevelName);
-			UClass* Class = FBlueprintFactoryHandler::FindClass(ActorClass);
+		const TSharedPtr<FJsonObject>& OpObj = Operations[Index];
+		TSharedPtr<FJsonObject>& OpResult = OpResults[Index];
 
-			if (World && Class)
-			{
-				AActor* Actor = FLevelEditHandler::SpawnActorInLevel(World, Class, Location, FRotator::ZeroRotator, FVector::OneVector);
-				OpResult->SetBoolField(TEXT("success"), Actor != nullptr);
-				
-				if (!Actor && bAtomic)
-				{
-					bAllSucceeded = false;
-					break;
-				}
-			}
-			else
-			{
-				OpResult->SetBoolField(TEXT("success"), false);
-				if (bAtomic)
-				{
-					bAllSucceeded = false;
-					break;
-				}
-			}
+		// Actor spawning
+		FString LevelName, ActorClass;
+		OpObj->TryGetStringField(TEXT("level"), LevelName);
+		OpObj->TryGetStringField(TEXT("actor"), ActorClass);
+
+		// Get location
+		FVector Location = FVector::ZeroVector;
+		const TSharedPtr<FJsonObject>* LocationObj;
+		if (OpObj->TryGetObjectField(TEXT("location"), LocationObj))
+		{
+			(*LocationObj)->TryGetNumberField(TEXT("x"), Location.X);
+			(*LocationObj)->TryGetNumberField(TEXT("y"), Location.Y);
+			(*LocationObj)->TryGetNumberField(TEXT("z"), Location.Z);
 		}
 
-		Results.Add(MakeShared<FJsonValueObject>(OpResult));
+		UWorld** FoundWorld = WorldByLevel.Find(LevelName);
+		UWorld* World = FoundWorld ? *FoundWorld : WorldByLevel.Add(LevelName, FLevelEditHandler::LoadLevelForEditing(LevelName));
+		UClass* Class = FBlueprintFactoryHandler::FindClass(ActorClass);
+
+		AActor* Actor = (World && Class) ? FLevelEditHandler::SpawnActorInLevel(World, Class, Location, FRotator::ZeroRotator, FVector::OneVector) : nullptr;
+		OpResult->SetBoolField(TEXT("success"), Actor != nullptr);
+		if (!Actor && bAtomic)
+		{
+			bAllSucceeded = false;
+		}
 	}
 
 	// Handle transaction result
-	if (bAtomic)
+	if (bAtomic && FTransactionManager::Get().IsTransactionActive())
 	{
 		if (bAllSucceeded)
 		{
@@ -2004,23 +1971,160 @@ bool FHttpServerManager::HandleBatch(const FHttpServerRequest& Request, const FH
 		}
 	}
 
-	// Build response
+	// Save: dirty packages in one pass, written to disk asynchronously
+	Timer.StartPhase(TEXT("save"));
+
+	TArray<UBlueprint*> FailedSaves;
+	int32 NumSaved = 0;
+	if (bSave && (bAllSucceeded || !bAtomic))
+	{
+		TArray<UBlueprint*> BlueprintsToSave;
+		for (UBlueprint* BP : ModifiedBlueprints)
+		{
+			if (!FailedCompiles.Contains(BP))
+			{
+				BlueprintsToSave.Add(BP);
+			}
+		}
+
+		NumSaved = FBlueprintEditHandler::SaveBlueprints(BlueprintsToSave, FailedSaves);
+		if (FailedSaves.Num() > 0)
+		{
+			bAllSucceeded = false;
+		}
+	}
+
+	// Build response (operations that never ran are left out)
+	TArray<TSharedPtr<FJsonValue>> Results;
+	for (const TSharedPtr<FJsonObject>& OpResult : OpResults)
+	{
+		if (OpResult.IsValid() && OpResult->HasField(TEXT("success")))
+		{
+			Results.Add(MakeShared<FJsonValueObject>(OpResult));
+		}
+	}
+
+	TArray<TSharedPtr<FJsonValue>> BlueprintResults;
+	for (const FBatchGroup& Group : Groups)
+	{
+		TSharedPtr<FJsonObject> BlueprintJson = MakeShared<FJsonObject>();
+		BlueprintJson->SetStringField(TEXT("blueprint"), Group.Blueprint->GetName());
+		BlueprintJson->SetNumberField(TEXT("operations"), Group.Operations.Num());
+		BlueprintJson->SetBoolField(TEXT("modified"), Group.bModified);
+		if (FailedCompiles.Contains(Group.Blueprint))
+		{
+			BlueprintJson->SetStringField(TEXT("error"), TEXT("Blueprint compilation failed"));
+		}
+		else if (FailedSaves.Contains(Group.Blueprint))
+		{
+			BlueprintJson->SetStringField(TEXT("error"), TEXT("Failed to save blueprint"));
+		}
+		BlueprintResults.Add(MakeShared<FJsonValueObject>(BlueprintJson));
+	}
+
 	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
 	Response->SetBoolField(TEXT("success"), bAllSucceeded);
-	Response->SetNumberField(TEXT("total"), OperationsArray->Num());
+	Response->SetNumberField(TEXT("total"), NumOperations);
 	Response->SetNumberField(TEXT("completed"), Results.Num());
+	Response->SetNumberField(TEXT("compiled"), NumCompiles);
+	Response->SetNumberField(TEXT("saved"), NumSaved);
 	Response->SetArrayField(TEXT("results"), Results);
+	Response->SetArrayField(TEXT("blueprints"), BlueprintResults);
+	Response->SetObjectField(TEXT("timings"), Timer.Finish());
 
 	OnComplete(CreateJsonResponse(Response));
 	return true;
 }
 
+bool FHttpServerManager::HandleGetChanges(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	LogRequest(Request);
+
+	FChangeFeed& Feed = FChangeFeed::Get();
+
+	// No position yet: answer with the current one, so the client can load a full snapshot and poll from there
+	const FString* SinceParam = Request.QueryParams.Find(TEXT("since"));
+	if (!SinceParam)
+	{
+		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetBoolField(TEXT("success"), true);
+		JsonObject->SetStringField(TEXT("epoch"), Feed.GetEpoch());
+		JsonObject->SetNumberField(TEXT("next"), (double)Feed.GetLastSequence());
+		JsonObject->SetBoolField(TEXT("reset"), false);
+		JsonObject->SetBoolField(TEXT("more"), false);
+		JsonObject->SetArrayField(TEXT("events"), TArray<TSharedPtr<FJsonValue>>());
+		OnComplete(CreateJsonResponse(JsonObject));
+		return true;
+	}
+
+	if (SinceParam->IsEmpty() || !SinceParam->IsNumeric() || SinceParam->Contains(TEXT("-")) || SinceParam->Contains(TEXT(".")))
+	{
+		OnComplete(CreateErrorResponse(TEXT("'since' must be a sequence number"), EHttpServerResponseCodes::BadRequest));
+		return true;
+	}
+	const uint64 Since = FCString::Strtoui64(**SinceParam, nullptr, 10);
+
+	const URevoltSettings* Settings = GetDefault<URevoltSettings>();
+	const int32 MaxLimit = Settings ? Settings->MaxPageSize : 1000;
+	int32 Limit = MaxLimit;
+	if (const FString* LimitParam = Request.QueryParams.Find(TEXT("limit")))
+	{
+		Limit = FMath::Clamp(FCString::Atoi(**LimitParam), 1, MaxLimit);
+	}
+
+	// Seconds to wait for an event (0 answers right away)
+	double Timeout = 25.0;
+	if (const FString* TimeoutParam = Request.QueryParams.Find(TEXT("timeout")))
+	{
+		Timeout = FMath::Clamp(FCString::Atod(**TimeoutParam), 0.0, 60.0);
+	}
+
+	TSet<FString> Categories;
+	if (const FString* TypesParam = Request.QueryParams.Find(TEXT("types")))
+	{
+		TArray<FString> Types;
+		TypesParam->ParseIntoArray(Types, TEXT(","), true);
+		for (const FString& Type : Types)
+		{
+			Categories.Add(Type.TrimStartAndEnd().ToLower());
+		}
+	}
+
+	const FString* EpochParam = Request.QueryParams.Find(TEXT("epoch"));
+
+	// Answered now if there are events, otherwise from the feed's tick (the pipeline keeps the request open)
+	const int32 MaxWaiters = Settings ? Settings->MaxWaitingPolls : 64;
+	const FChangeFeed::EPollResult Result = Feed.Poll(Since, Limit, Timeout, Categories, EpochParam ? *EpochParam : FString(), MaxWaiters, [this, OnComplete](const TSharedPtr<FJsonObject>& Body)
+	{
+		OnComplete(CreateJsonResponse(Body));
+	});
+
+	if (Result == FChangeFeed::EPollResult::TooManyWaiters)
+	{
+		TUniquePtr<FHttpServerResponse> Response = CreateErrorResponse(TEXT("Too many polls waiting, retry shortly"), EHttpServerResponseCodes::ServiceUnavail);
+		Response->Headers.Add(TEXT("Retry-After"), { TEXT("1") });
+		OnComplete(MoveTemp(Response));
+	}
+	else if (Result == FChangeFeed::EPollResult::Waiting)
+	{
+		// Idle polls must not take the slots other endpoints need
+		Pipeline.DetachCurrentRequest();
+	}
+	return true;
+}
+
 // ============================================================================
 // Utility Functions
 // ============================================================================
 
 bool FHttpServerManager::ParseRequestBody(const FHttpServerRequest& Request, TSharedPtr<FJsonObject>& OutJson)
 {
+	// Pipelined requests had their body parsed on a worker already
+	if (Pipeline.GetParsedBody(Request, OutJson))
+	{
+		return OutJson.IsValid();
+	}
+
 	if (Request.Body.Num() == 0)
 	{
 		return false;
@@ -2051,18 +2155,83 @@ TArray<TSharedPtr<FJsonValue>> FHttpServerManager::ConvertToJsonValueArray(const
 
 TUniquePtr<FHttpServerResponse> FHttpServerManager::CreateJsonResponse(const TSharedPtr<FJsonObject>& JsonObject, EHttpServerResponseCodes ResponseCode)
 {
-	// Serialize JSON
-	FString JsonString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	// Inside a pipelined handler the body is serialized on a worker once the handler completes
+	TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+	Response->Code = ResponseCode;
+	if (Pipeline.DeferJsonBody(*Response, JsonObject))
+	{
+		return Response;
+	}
+
+	return CreateJsonTextResponse(FRequestPipeline::SerializeJson(JsonObject), ResponseCode);
+}
 
-	// Create response
-	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(JsonString, TEXT("application/json"));
+TUniquePtr<FHttpServerResponse> FHttpServerManager::CreateJsonTextResponse(const FString& JsonText, EHttpServerResponseCodes ResponseCode)
+{
+	TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
 	Response->Code = ResponseCode;
-	
+	if (Pipeline.DeferTextBody(*Response, JsonText))
+	{
+		return Response;
+	}
+
+	Response = FHttpServerResponse::Create(JsonText, TEXT("application/json"));
+	Response->Code = ResponseCode;
+
+	return Response;
+}
+
+TUniquePtr<FHttpServerResponse> FHttpServerManager::CreateETagResponse(const FHttpServerRequest& Request, const FString& JsonText, const FString& ETag)
+{
+	// If-None-Match holds a comma separated list of (possibly weak) tags, or "*"
+	bool bNotModified = false;
+	if (const TArray<FString>* IfNoneMatch = Request.Headers.Find(TEXT("If-None-Match")))
+	{
+		for (const FString& HeaderValue : *IfNoneMatch)
+		{
+			TArray<FString> Tags;
+			HeaderValue.ParseIntoArray(Tags, TEXT(","));
+			for (FString& Tag : Tags)
+			{
+				Tag.TrimStartAndEndInline();
+				Tag.RemoveFromStart(TEXT("W/"));
+				if (Tag == TEXT("*") || Tag == ETag)
+				{
+					bNotModified = true;
+				}
+			}
+		}
+	}
+
+	TUniquePtr<FHttpServerResponse> Response;
+	if (bNotModified)
+	{
+		Response = MakeUnique<FHttpServerResponse>();
+		Response->Code = EHttpServerResponseCodes::NotModified;
+	}
+	else
+	{
+		Response = CreateJsonTextResponse(JsonText);
+	}
+
+	// Clients must revalidate, since an edit in the editor can change the response at any time
+	Response->Headers.Add(TEXT("ETag"), { ETag });
+	Response->Headers.Add(TEXT("Cache-Control"), { TEXT("no-cache") });
+
 	return Response;
 }
 
+bool FHttpServerManager::ParsePageOptions(const FHttpServerRequest& Request, int32 MaxLimit, FPageOptions& OutPage, const FHttpResultCallback& OnComplete)
+{
+	FString Error;
+	if (!FPageOptions::ParseFromQueryParams(Request.QueryParams, MaxLimit, OutPage, Error))
+	{
+		OnComplete(CreateErrorResponse(Error, EHttpServerResponseCodes::BadRequest));
+		return false;
+	}
+	return true;
+}
+
 TUniquePtr<FHttpServerResponse> FHttpServerManager::CreateErrorResponse(const FString& ErrorMessage, EHttpServerResponseCodes ResponseCode)
 {
 	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
@@ -2098,9 +2267,8 @@ bool FHttpServerManager::HandleGetDataAssets(const FHttpServerRequest& Request,
 {
 	LogRequest(Request);
 
-	// Parse query options
-	FString QueryString = Request.QueryParams.Contains(TEXT("query")) ? Request.QueryParams[TEXT("query")] : TEXT("");
-	FQueryOptions Options = FQueryOptions::ParseFromQueryString(QueryString);
+	// Parse query options (depth flags and fields projection)
+	FQueryOptions Options = FQueryOptions::ParseFromQueryParams(Request.QueryParams);
 
 	// Get class filter if specified
 	UClass* DataAssetClass = nullptr;
@@ -2115,10 +2283,14 @@ bool FHttpServerManager::HandleGetDataAssets(const FHttpServerRequest& Request,
 		}
 	}
 
-	// Get all data assets
-	TSharedPtr<FJsonObject> Result = FDataAssetFactoryHandler::GetAllDataAssets(DataAssetClass, Options);
+	FPageOptions Page;
+	if (!ParsePageOptions(Request, GetDefault<URevoltSettings>()->MaxPageSize, Page, OnComplete))
+	{
+		return true;
+	}
 
-	OnComplete(CreateJsonResponse(Result));
+	// Get all data assets
+	OnComplete(CreateJsonTextResponse(FDataAssetFactoryHandler::GetAllDataAssets(DataAssetClass, Options, Page)));
 	return true;
 }
 
@@ -2134,16 +2306,7 @@ bool FHttpServerManager::HandleGetDataAsset(const FHttpServerRequest& Request, c
 	}
 
 	// Parse query options from query string
-	FString QueryString;
-	for (const auto& Param : Request.QueryParams)
-	{
-		if (!QueryString.IsEmpty())
-		{
-			QueryString += TEXT("&");
-		}
-		QueryString += Param.Key + TEXT("=") + Param.Value;
-	}
-	FQueryOptions Options = FQueryOptions::ParseFromQueryString(QueryString);
+	FQueryOptions Options = FQueryOptions::ParseFromQueryParams(Request.QueryParams);
 
 	// Get specific data asset
 	TSharedPtr<FJsonObject> Result = FDataAssetFactoryHandler::GetDataAssetInfo(DataAssetName, Options);
@@ -8,9 +8,11 @@
 #include "HttpServerResponse.h"
 #include "HttpResultCallback.h"
 #include "HttpRouteHandle.h"
+#include "RequestPipeline.h"
 
 class IHttpRouter;
 class FHttpServerModule;
+struct FPageOptions;
 
 /**
  * Manages the HTTP server for the Revolt plugin
@@ -49,6 +51,9 @@ private:
 	/** Unregister all API routes */
 	void UnregisterRoutes();
 
+	/** Route handler that runs a member handler through the request pipeline */
+	FHttpRequestHandler Pipelined(bool (FHttpServerManager::*Handler)(const FHttpServerRequest&, const FHttpResultCallback&));
+
 	// ========================================================================
 	// Route Handlers
 	// ========================================================================
@@ -117,6 +122,9 @@ private:
 	/** PATCH /api/blueprints/bulk - Bulk edit blueprints */
 	bool HandleBulkEdit(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/** GET /api/changes - Long poll for asset, actor and transaction events after a sequence number */
+	bool HandleGetChanges(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
 	/** POST /api/batch - Execute batch operations */
 	bool HandleBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
@@ -149,6 +157,15 @@ private:
 	/** Create JSON success response */
 	TUniquePtr<FHttpServerResponse> CreateJsonResponse(const TSharedPtr<FJsonObject>& JsonObject, EHttpServerResponseCodes ResponseCode = EHttpServerResponseCodes::Ok);
 
+	/** Create JSON success response from already serialized JSON */
+	TUniquePtr<FHttpServerResponse> CreateJsonTextResponse(const FString& JsonText, EHttpServerResponseCodes ResponseCode = EHttpServerResponseCodes::Ok);
+
+	/** Create JSON success response with an ETag (304 with no body if the request's If-None-Match matches it) */
+	TUniquePtr<FHttpServerResponse> CreateETagResponse(const FHttpServerRequest& Request, const FString& JsonText, const FString& ETag);
+
+	/** Parse limit/cursor query params (sends a bad request response and returns false if they are invalid) */
+	bool ParsePageOptions(const FHttpServerRequest& Request, int32 MaxLimit, FPageOptions& OutPage, const FHttpResultCallback& OnComplete);
+
 	/** Create JSON error response */
 	TUniquePtr<FHttpServerResponse> CreateErrorResponse(const FString& ErrorMessage, EHttpServerResponseCodes ResponseCode = EHttpServerResponseCodes::ServerError);
 
@@ -169,6 +186,9 @@ private:
 	/** Route handles for cleanup */
 	TArray<FHttpRouteHandle> RouteHandles;
 
+	/** Runs route handlers with body parsing and response serialization on worker threads */
+	FRequestPipeline Pipeline;
+
 	/** Server running state */
 	bool bIsRunning;
 
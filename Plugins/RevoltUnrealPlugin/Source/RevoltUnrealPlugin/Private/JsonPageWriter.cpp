@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JsonPageWriter.h"
+#include "AssetRegistry/AssetData.h"
+#include "Serialization/JsonSerializer.h"
+
+FJsonPageWriter::FJsonPageWriter(const FString& InItemsField)
+	: Writer(TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json))
+	, ItemsField(InItemsField)
+	, Count(0)
+	, bItemsStarted(false)
+{
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("success"), true);
+}
+
+void FJsonPageWriter::WriteItem(const TSharedPtr<FJsonObject>& Item)
+{
+	if (!Item)
+	{
+		return;
+	}
+
+	BeginItems();
+	FJsonSerializer::Serialize(Item.ToSharedRef(), Writer, false);
+	++Count;
+}
+
+FString FJsonPageWriter::WritePage(const TArray<FString>& Keys, const FPageOptions& Page, TFunctionRef<TSharedPtr<FJsonObject>(int32)> MakeItem)
+{
+	bool bHasMore = false;
+	const TArray<int32> PageIndices = Page.SelectPage(Keys, bHasMore);
+	for (int32 Index : PageIndices)
+	{
+		WriteItem(MakeItem(Index));
+	}
+	return Finish(bHasMore ? Keys[PageIndices.Last()] : FString(), Keys.Num());
+}
+
+FString FJsonPageWriter::WriteAssetPage(const TArray<FAssetData>& Assets, const FPageOptions& Page, TFunctionRef<TSharedPtr<FJsonObject>(const FAssetData&)> MakeItem)
+{
+	TArray<FString> Keys;
+	Keys.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		Keys.Add(AssetData.GetObjectPathString());
+	}
+	return WritePage(Keys, Page, [&Assets, &MakeItem](int32 Index) { return MakeItem(Assets[Index]); });
+}
+
+FString FJsonPageWriter::Finish(const FString& NextKey, int32 Total)
+{
+	BeginItems();
+	Writer->WriteArrayEnd();
+
+	Writer->WriteValue(TEXT("count"), Count);
+	Writer->WriteValue(TEXT("total"), Total);
+	Writer->WriteValue(TEXT("has_more"), !NextKey.IsEmpty());
+	if (!NextKey.IsEmpty())
+	{
+		Writer->WriteValue(TEXT("next_cursor"), FPageOptions::EncodeCursor(NextKey));
+	}
+	else
+	{
+		Writer->WriteNull(TEXT("next_cursor"));
+	}
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return MoveTemp(Json);
+}
+
+void FJsonPageWriter::BeginItems()
+{
+	if (!bItemsStarted)
+	{
+		Writer->WriteArrayStart(ItemsField);
+		bItemsStarted = true;
+	}
+}
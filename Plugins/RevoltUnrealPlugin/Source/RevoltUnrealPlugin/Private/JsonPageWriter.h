@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "QueryOptions.h"
+
+struct FAssetData;
+
+/**
+ * Writes one page of a list response straight to JSON text
+ * Each item is serialized as soon as it is produced instead of collecting the whole list in a
+ * JSON DOM first, so a request only ever holds one item's DOM plus the page text.
+ */
+class FJsonPageWriter
+{
+public:
+
+	typedef TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> FWriter;
+
+	/**
+	 * Start the response object
+	 * @param InItemsField Name of the array field the items go in
+	 */
+	explicit FJsonPageWriter(const FString& InItemsField);
+
+	/** Writer for top-level fields (only valid before the first item) */
+	FWriter& GetWriter() { return *Writer; }
+
+	/** Append an item to the page */
+	void WriteItem(const TSharedPtr<FJsonObject>& Item);
+
+	/**
+	 * Write the requested page of a list and close the response
+	 * @param Keys Stable key of every item in the list
+	 * @param Page Requested page
+	 * @param MakeItem Builds the JSON of the item at an index (only called for items on the page)
+	 * @return Response JSON
+	 */
+	FString WritePage(const TArray<FString>& Keys, const FPageOptions& Page, TFunctionRef<TSharedPtr<FJsonObject>(int32)> MakeItem);
+
+	/** Write the requested page of a list of assets keyed by object path, and close the response */
+	FString WriteAssetPage(const TArray<FAssetData>& Assets, const FPageOptions& Page, TFunctionRef<TSharedPtr<FJsonObject>(const FAssetData&)> MakeItem);
+
+	/**
+	 * Close the response
+	 * @param NextKey Key of the last item if more items follow (empty on the last page)
+	 * @param Total Number of items across all pages
+	 * @return Response JSON
+	 */
+	FString Finish(const FString& NextKey, int32 Total);
+
+private:
+
+	/** Open the items array if it is not open yet */
+	void BeginItems();
+
+	FString Json;
+	TSharedRef<FWriter> Writer;
+	FString ItemsField;
+	int32 Count;
+	bool bItemsStarted;
+};
@@ -0,0 +1,86 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LevelActorCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Package.h"
+
+FLevelActorCache* FLevelActorCache::Instance = nullptr;
+
+FLevelActorSummary FLevelActorSummary::FromActor(const AActor* Actor)
+{
+	FLevelActorSummary Summary;
+	Summary.Path = Actor->GetPathName();
+	Summary.Name = Actor->GetName();
+	Summary.Label = Actor->GetActorLabel();
+	Summary.ClassName = Actor->GetClass()->GetName();
+	Summary.Transform = Actor->GetActorTransform();
+	Summary.Tags = Actor->Tags;
+	return Summary;
+}
+
+FLevelActorCache::FLevelActorCache()
+{
+}
+
+FLevelActorCache& FLevelActorCache::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FLevelActorCache();
+	}
+	return *Instance;
+}
+
+void FLevelActorCache::Initialize()
+{
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FLevelActorCache::OnPackageSaved);
+
+	// Covers maps changed outside the editor (source control sync, external tools)
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FLevelActorCache::OnAssetUpdated);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FLevelActorCache::OnAssetUpdated);
+}
+
+void FLevelActorCache::Shutdown()
+{
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+	}
+
+	SummariesByPackage.Empty();
+}
+
+const TArray<FLevelActorSummary>* FLevelActorCache::Find(FName PackageName) const
+{
+	return SummariesByPackage.Find(PackageName);
+}
+
+void FLevelActorCache::Add(FName PackageName, TArray<FLevelActorSummary>&& Summaries)
+{
+	SummariesByPackage.Add(PackageName, MoveTemp(Summaries));
+}
+
+void FLevelActorCache::Invalidate(FName PackageName)
+{
+	SummariesByPackage.Remove(PackageName);
+}
+
+void FLevelActorCache::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (Package)
+	{
+		Invalidate(Package->GetFName());
+	}
+}
+
+void FLevelActorCache::OnAssetUpdated(const FAssetData& AssetData)
+{
+	Invalidate(AssetData.PackageName);
+}
@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectSaveContext.h"
+
+class UPackage;
+class AActor;
+struct FAssetData;
+
+/**
+ * What an actor listing needs from an actor, without the actor itself
+ */
+struct FLevelActorSummary
+{
+	/** Object path (sort key for pagination) */
+	FString Path;
+
+	FString Name;
+	FString Label;
+	FString ClassName;
+	FTransform Transform;
+	TArray<FName> Tags;
+
+	/** Summarize a loaded actor */
+	static FLevelActorSummary FromActor(const AActor* Actor);
+};
+
+/**
+ * Actor summaries of levels that are not loaded, so listing a level's actors only loads it once per save.
+ * A level's summary is built the first time it has to be loaded and dropped when its package is saved or
+ * updated on disk.
+ */
+class FLevelActorCache
+{
+public:
+
+	/** Get singleton instance */
+	static FLevelActorCache& Get();
+
+	/** Subscribe to package saved and asset updated events */
+	void Initialize();
+
+	/** Unsubscribe from events and drop all summaries */
+	void Shutdown();
+
+	/** Cached summaries of a level (null if none) */
+	const TArray<FLevelActorSummary>* Find(FName PackageName) const;
+
+	/** Store the summaries of a level */
+	void Add(FName PackageName, TArray<FLevelActorSummary>&& Summaries);
+
+	/** Drop the summaries of a level */
+	void Invalidate(FName PackageName);
+
+	/** Number of cached levels */
+	int32 Num() const { return SummariesByPackage.Num(); }
+
+private:
+
+	/** Private constructor for singleton */
+	FLevelActorCache();
+
+	/** Event callbacks */
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+	void OnAssetUpdated(const FAssetData& AssetData);
+
+	/** Level package -> actor summaries */
+	TMap<FName, TArray<FLevelActorSummary>> SummariesByPackage;
+
+	/** Event subscriptions */
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+	FDelegateHandle AssetRemovedHandle;
+
+	/** Singleton instance */
+	static FLevelActorCache* Instance;
+};
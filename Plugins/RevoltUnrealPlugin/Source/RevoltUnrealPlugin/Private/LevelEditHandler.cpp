@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "LevelEditHandler.h"
+#include "AssetIndex.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "EngineUtils.h"
@@ -176,23 +177,12 @@ bool FLevelEditHandler::SaveLevel(UWorld* World)
 
 UWorld* FLevelEditHandler::LoadLevelForEditing(const FString& LevelName)
 {
-	// Get asset registry
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	// Find the level asset
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetClassPathName(), AssetDataList, true);
-
+	// Find the level asset (exact name first, then partial)
 	FString TargetPackagePath;
-	for (const FAssetData& AssetData : AssetDataList)
+	FAssetData AssetData;
+	if (FAssetIndex::Get().FindByName(LevelName, EIndexedAssetKind::World, AssetData))
 	{
-		if (AssetData.AssetName.ToString().Equals(LevelName, ESearchCase::IgnoreCase) ||
-			AssetData.AssetName.ToString().Contains(LevelName, ESearchCase::IgnoreCase))
-		{
-			TargetPackagePath = AssetData.PackageName.ToString();
-			break;
-		}
+		TargetPackagePath = AssetData.PackageName.ToString();
 	}
 
 	if (TargetPackagePath.IsEmpty())
@@ -1,7 +1,9 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "LevelQueryHandler.h"
-#include "RevoltSettings.h"
+#include "AssetIndex.h"
+#include "JsonPageWriter.h"
+#include "LevelActorCache.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Engine/World.h"
@@ -9,118 +11,132 @@
 #include "GameFramework/Actor.h"
 #include "Components/ActorComponent.h"
 #include "EngineUtils.h"
+#include "WorldPartition/WorldPartitionActorDesc.h"
+#include "WorldPartition/WorldPartitionActorDescUtils.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Package.h"
 
-TSharedPtr<FJsonObject> FLevelQueryHandler::GetAllLevels()
+FString FLevelQueryHandler::GetAllLevels(const FPageOptions& Page)
 {
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	TArray<TSharedPtr<FJsonValue>> LevelsArray;
-
-	// Get asset registry
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
 	// Query all level assets
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetClassPathName(), AssetDataList, true);
+	TArray<FAssetData> AssetDataList = FAssetIndex::Get().GetAssetsOfKind(EIndexedAssetKind::World);
 
 	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Found %d levels"), AssetDataList.Num());
 
-	for (const FAssetData& AssetData : AssetDataList)
+	FJsonPageWriter Writer(TEXT("levels"));
+	return Writer.WriteAssetPage(AssetDataList, Page, [](const FAssetData& AssetData)
 	{
 		TSharedPtr<FJsonObject> LevelJson = MakeShared<FJsonObject>();
 		LevelJson->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
 		LevelJson->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
 		LevelJson->SetStringField(TEXT("package_path"), AssetData.PackageName.ToString());
-
-		LevelsArray.Add(MakeShared<FJsonValueObject>(LevelJson));
-	}
-
-	Result->SetArrayField(TEXT("levels"), LevelsArray);
-	Result->SetNumberField(TEXT("count"), LevelsArray.Num());
-	Result->SetBoolField(TEXT("success"), true);
-
-	return Result;
+		return LevelJson;
+	});
 }
 
-TSharedPtr<FJsonObject> FLevelQueryHandler::GetLevelActors(const FString& LevelName, const FQueryOptions& Options)
+FString FLevelQueryHandler::GetLevelActors(const FString& LevelName, const FQueryOptions& Options, const FPageOptions& Page)
 {
-	// Load the level
-	UWorld* World = LoadLevel(LevelName);
-	if (!World)
+	// Find the level asset (exact name first, then partial)
+	FAssetData LevelAsset;
+	if (!FAssetIndex::Get().FindByName(LevelName, EIndexedAssetKind::World, LevelAsset))
 	{
-		UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Failed to load level '%s'"), *LevelName);
-		return nullptr;
+		UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Could not find level '%s'"), *LevelName);
+		return FString();
 	}
 
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	TArray<TSharedPtr<FJsonValue>> ActorsArray;
+	// Components and properties need the actors themselves; a summary can come from cheaper sources
+	const bool bNeedsActors = Options.bIncludeComponents || Options.bIncludeProperties;
 
-	// Get max actors from settings
-	const URevoltSettings* Settings = GetDefault<URevoltSettings>();
-	int32 MaxActors = Settings ? Settings->MaxActorsPerQuery : 1000;
+	// A level that is already open (e.g. the editor world) is read as is
+	UWorld* World = FindObject<UWorld>(nullptr, *LevelAsset.GetObjectPathString());
+	const TCHAR* Source = TEXT("loaded");
 
-	// Iterate through all actors in the world
-	int32 ActorCount = 0;
-	for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+	TArray<FLevelActorSummary> Summaries;
+	const TArray<FLevelActorSummary>* CachedSummaries = nullptr;
+	if (!World && !bNeedsActors)
 	{
-		AActor* Actor = *ActorItr;
-		if (Actor && IsValid(Actor))
+		if (GetExternalActorSummaries(LevelAsset.PackageName, Summaries))
+		{
+			Source = TEXT("asset_registry");
+		}
+		else if ((CachedSummaries = FLevelActorCache::Get().Find(LevelAsset.PackageName)) != nullptr)
 		{
-			TSharedPtr<FJsonObject> ActorJson = ExtractActorInfo(Actor, Options);
-			if (ActorJson)
-			{
-				ActorsArray.Add(MakeShared<FJsonValueObject>(ActorJson));
-				ActorCount++;
-
-				// Limit number of actors
-				if (ActorCount >= MaxActors)
-				{
-					UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: Reached max actor limit (%d), stopping enumeration"), MaxActors);
-					break;
-				}
-			}
+			Source = TEXT("cache");
 		}
 	}
 
-	Result->SetStringField(TEXT("level_name"), LevelName);
-	Result->SetArrayField(TEXT("actors"), ActorsArray);
-	Result->SetNumberField(TEXT("count"), ActorsArray.Num());
-	Result->SetBoolField(TEXT("success"), true);
+	const bool bHasSummaries = Summaries.Num() > 0 || CachedSummaries;
+	bool bLoadedHere = false;
+	if (!World && !bHasSummaries)
+	{
+		World = LoadLevel(LevelAsset);
+		Source = TEXT("load");
+		bLoadedHere = true;
+		if (!World)
+		{
+			UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Failed to load level '%s'"), *LevelName);
+			return FString();
+		}
+	}
 
-	return Result;
-}
+	FJsonPageWriter Writer(TEXT("actors"));
+	Writer.GetWriter().WriteValue(TEXT("level_name"), LevelName);
+	Writer.GetWriter().WriteValue(TEXT("source"), Source);
 
-UWorld* FLevelQueryHandler::LoadLevel(const FString& LevelName)
-{
-	// Get asset registry
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+	if (bHasSummaries)
+	{
+		const TArray<FLevelActorSummary>& SummaryList = CachedSummaries ? *CachedSummaries : Summaries;
 
-	// Find the level asset
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetClassPathName(), AssetDataList, true);
+		TArray<FString> Keys;
+		Keys.Reserve(SummaryList.Num());
+		for (const FLevelActorSummary& Summary : SummaryList)
+		{
+			Keys.Add(Summary.Path);
+		}
+
+		return Writer.WritePage(Keys, Page, [&SummaryList](int32 Index)
+		{
+			return SummaryToJson(SummaryList[Index]);
+		});
+	}
 
-	FString TargetPackagePath;
-	for (const FAssetData& AssetData : AssetDataList)
+	// Collect the actors and key them by path; only the requested page is extracted
+	TArray<AActor*> Actors;
+	TArray<FString> Keys;
+	for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
 	{
-		if (AssetData.AssetName.ToString().Equals(LevelName, ESearchCase::IgnoreCase) ||
-			AssetData.AssetName.ToString().Contains(LevelName, ESearchCase::IgnoreCase))
+		AActor* Actor = *ActorItr;
+		if (Actor && IsValid(Actor))
 		{
-			TargetPackagePath = AssetData.PackageName.ToString();
-			break;
+			Actors.Add(Actor);
+			Keys.Add(Actor->GetPathName());
 		}
 	}
 
-	if (TargetPackagePath.IsEmpty())
+	// Remember what a load found so summary listings of this level don't load it again until it is saved
+	if (bLoadedHere)
 	{
-		UE_LOG(LogTemp, Error, TEXT("RevoltPlugin: Could not find level '%s'"), *LevelName);
-		return nullptr;
+		TArray<FLevelActorSummary> LoadedSummaries;
+		LoadedSummaries.Reserve(Actors.Num());
+		for (const AActor* Actor : Actors)
+		{
+			LoadedSummaries.Add(FLevelActorSummary::FromActor(Actor));
+		}
+		FLevelActorCache::Get().Add(LevelAsset.PackageName, MoveTemp(LoadedSummaries));
 	}
 
+	return Writer.WritePage(Keys, Page, [&Actors, &Options](int32 Index)
+	{
+		return ExtractActorInfo(Actors[Index], Options);
+	});
+}
+
+UWorld* FLevelQueryHandler::LoadLevel(const FAssetData& LevelAsset)
+{
+	const FString TargetPackagePath = LevelAsset.PackageName.ToString();
+
 	// Load the level
-	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Loading level '%s' from '%s'"), *LevelName, *TargetPackagePath);
+	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Loading level '%s' from '%s'"), *LevelAsset.AssetName.ToString(), *TargetPackagePath);
 	
 	// Use the editor's level loading system
 	UWorld* World = Cast<UWorld>(StaticLoadObject(UWorld::StaticClass(), nullptr, *TargetPackagePath));
@@ -128,22 +144,54 @@ UWorld* FLevelQueryHandler::LoadLevel(const FString& LevelName)
 	return World;
 }
 
-TSharedPtr<FJsonObject> FLevelQueryHandler::ExtractActorInfo(AActor* Actor, const FQueryOptions& Options)
+bool FLevelQueryHandler::GetExternalActorSummaries(FName LevelPackageName, TArray<FLevelActorSummary>& OutSummaries)
 {
-	if (!Actor)
+	// Levels saving one file per actor (World Partition) keep an actor descriptor in each actor's asset registry tags
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<FAssetData> ActorAssets;
+	AssetRegistry.GetAssetsByPath(*ULevel::GetExternalActorsPath(LevelPackageName.ToString()), ActorAssets, true, true);
+
+	for (const FAssetData& ActorAsset : ActorAssets)
 	{
-		return nullptr;
+		if (!FWorldPartitionActorDescUtils::IsValidActorDescriptorFromAssetData(ActorAsset))
+		{
+			continue;
+		}
+
+		TUniquePtr<FWorldPartitionActorDesc> ActorDesc = FWorldPartitionActorDescUtils::GetActorDescriptorFromAssetData(ActorAsset);
+		if (!ActorDesc)
+		{
+			continue;
+		}
+
+		// Blueprint actors report their generated class as the base class, native actors only have a native class
+		const FTopLevelAssetPath ClassPath = ActorDesc->GetBaseClass().IsValid() ? ActorDesc->GetBaseClass() : ActorDesc->GetNativeClass();
+
+		FLevelActorSummary Summary;
+		Summary.Path = ActorDesc->GetActorSoftPath().ToString();
+		Summary.Name = ActorDesc->GetActorName().ToString();
+		Summary.Label = ActorDesc->GetActorLabel().ToString();
+		Summary.ClassName = ClassPath.GetAssetName().ToString();
+		Summary.Transform = ActorDesc->GetActorTransform();
+		Summary.Tags = ActorDesc->GetTags();
+		OutSummaries.Add(MoveTemp(Summary));
 	}
 
+	return OutSummaries.Num() > 0;
+}
+
+TSharedPtr<FJsonObject> FLevelQueryHandler::SummaryToJson(const FLevelActorSummary& Summary)
+{
 	TSharedPtr<FJsonObject> ActorJson = MakeShared<FJsonObject>();
 
 	// Basic info
-	ActorJson->SetStringField(TEXT("name"), Actor->GetName());
-	ActorJson->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-	ActorJson->SetStringField(TEXT("label"), Actor->GetActorLabel());
+	ActorJson->SetStringField(TEXT("name"), Summary.Name);
+	ActorJson->SetStringField(TEXT("class"), Summary.ClassName);
+	ActorJson->SetStringField(TEXT("label"), Summary.Label);
 
 	// Location
-	FVector Location = Actor->GetActorLocation();
+	FVector Location = Summary.Transform.GetLocation();
 	TSharedPtr<FJsonObject> LocationJson = MakeShared<FJsonObject>();
 	LocationJson->SetNumberField(TEXT("x"), Location.X);
 	LocationJson->SetNumberField(TEXT("y"), Location.Y);
@@ -151,7 +199,7 @@ TSharedPtr<FJsonObject> FLevelQueryHandler::ExtractActorInfo(AActor* Actor, cons
 	ActorJson->SetObjectField(TEXT("location"), LocationJson);
 
 	// Rotation
-	FRotator Rotation = Actor->GetActorRotation();
+	FRotator Rotation = Summary.Transform.Rotator();
 	TSharedPtr<FJsonObject> RotationJson = MakeShared<FJsonObject>();
 	RotationJson->SetNumberField(TEXT("pitch"), Rotation.Pitch);
 	RotationJson->SetNumberField(TEXT("yaw"), Rotation.Yaw);
@@ -159,7 +207,7 @@ TSharedPtr<FJsonObject> FLevelQueryHandler::ExtractActorInfo(AActor* Actor, cons
 	ActorJson->SetObjectField(TEXT("rotation"), RotationJson);
 
 	// Scale
-	FVector Scale = Actor->GetActorScale3D();
+	FVector Scale = Summary.Transform.GetScale3D();
 	TSharedPtr<FJsonObject> ScaleJson = MakeShared<FJsonObject>();
 	ScaleJson->SetNumberField(TEXT("x"), Scale.X);
 	ScaleJson->SetNumberField(TEXT("y"), Scale.Y);
@@ -168,12 +216,24 @@ TSharedPtr<FJsonObject> FLevelQueryHandler::ExtractActorInfo(AActor* Actor, cons
 
 	// Tags
 	TArray<TSharedPtr<FJsonValue>> TagsArray;
-	for (const FName& Tag : Actor->Tags)
+	for (const FName& Tag : Summary.Tags)
 	{
 		TagsArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
 	}
 	ActorJson->SetArrayField(TEXT("tags"), TagsArray);
 
+	return ActorJson;
+}
+
+TSharedPtr<FJsonObject> FLevelQueryHandler::ExtractActorInfo(AActor* Actor, const FQueryOptions& Options)
+{
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> ActorJson = SummaryToJson(FLevelActorSummary::FromActor(Actor));
+
 	// Components if requested
 	if (Options.bIncludeComponents)
 	{
@@ -4,11 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "QueryOptions.h"
+#include "LevelActorCache.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 
 class UWorld;
 class AActor;
+struct FAssetData;
 
 /**
  * Handles querying level assets with on-demand loading
@@ -17,16 +19,27 @@ class FLevelQueryHandler
 {
 public:
 
-	/** Get all levels in the project */
-	static TSharedPtr<FJsonObject> GetAllLevels();
+	/** Get a page of the levels in the project (returns response JSON) */
+	static FString GetAllLevels(const FPageOptions& Page);
 
-	/** Get actors in a specific level (loads level on demand) */
-	static TSharedPtr<FJsonObject> GetLevelActors(const FString& LevelName, const FQueryOptions& Options);
+	/**
+	 * Get a page of the actors in a specific level (returns empty string on failure).
+	 * An open level is read directly. Otherwise summaries (no components or properties) come from World Partition
+	 * actor descriptors or the level's cached summary, and the level is only loaded when neither has it or when
+	 * components or properties are requested.
+	 */
+	static FString GetLevelActors(const FString& LevelName, const FQueryOptions& Options, const FPageOptions& Page);
 
 private:
 
-	/** Load a level by name */
-	static UWorld* LoadLevel(const FString& LevelName);
+	/** Load a level */
+	static UWorld* LoadLevel(const FAssetData& LevelAsset);
+
+	/** Summarize a level's external actors from their asset registry descriptors (false if it has none) */
+	static bool GetExternalActorSummaries(FName LevelPackageName, TArray<FLevelActorSummary>& OutSummaries);
+
+	/** Actor summary to JSON (name, class, label, transform, tags) */
+	static TSharedPtr<FJsonObject> SummaryToJson(const FLevelActorSummary& Summary);
 
 	/** Extract actor information to JSON */
 	static TSharedPtr<FJsonObject> ExtractActorInfo(AActor* Actor, const FQueryOptions& Options);
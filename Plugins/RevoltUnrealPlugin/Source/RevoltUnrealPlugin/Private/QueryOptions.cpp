@@ -1,10 +1,13 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "QueryOptions.h"
+#include "RevoltSettings.h"
+#include "Misc/Base64.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
 
-FQueryOptions FQueryOptions::ParseFromQueryString(const FString& QueryString)
+FQueryOptions FQueryOptions::ParseFromQueryString(const FString& QueryString, const FQueryOptions& Defaults)
 {
-	FQueryOptions Options;
+	FQueryOptions Options = Defaults;
 
 	// Parse query string parameters
 	TArray<FString> Params;
@@ -63,12 +66,30 @@ FQueryOptions FQueryOptions::ParseFromQueryString(const FString& QueryString)
 			{
 				Options.bIncludeComponents = (Value == TEXT("true") || Value == TEXT("1"));
 			}
+			else if (Key == TEXT("fields"))
+			{
+				Options.Fields = FFieldSelection::Parse(Value);
+			}
 		}
 	}
 
 	return Options;
 }
 
+FQueryOptions FQueryOptions::ParseFromQueryParams(const TMap<FString, FString>& QueryParams, const FQueryOptions& Defaults)
+{
+	FString QueryString;
+	for (const auto& Param : QueryParams)
+	{
+		if (!QueryString.IsEmpty())
+		{
+			QueryString += TEXT("&");
+		}
+		QueryString += Param.Key + TEXT("=") + Param.Value;
+	}
+	return ParseFromQueryString(QueryString, Defaults);
+}
+
 void FQueryOptions::ApplyDepthLevel(EQueryDepth Depth)
 {
 	DepthLevel = Depth;
@@ -113,3 +134,181 @@ void FQueryOptions::ApplyDepthLevel(EQueryDepth Depth)
 	}
 }
 
+FString FQueryOptions::GetCacheKey() const
+{
+	return FString::Printf(TEXT("d%d p%d f%d g%d v%d c%d m%d %s"), (int32)DepthLevel, (int32)bIncludeProperties, (int32)bIncludeFunctions,
+		(int32)bIncludeGraphNodes, (int32)bIncludeDefaultValues, (int32)bIncludeConnections, (int32)bIncludeComponents, *Fields.ToString());
+}
+
+FFieldSelection FFieldSelection::Parse(const FString& Fields)
+{
+	FFieldSelection Selection;
+
+	TArray<FString> Paths;
+	FGenericPlatformHttp::UrlDecode(Fields).ParseIntoArray(Paths, TEXT(","));
+	for (const FString& Path : Paths)
+	{
+		// "components[].name" -> components, [], name
+		TArray<FString> Steps;
+		Path.Replace(TEXT("[]"), TEXT(".[]")).ParseIntoArray(Steps, TEXT("."));
+		for (FString& Step : Steps)
+		{
+			Step.TrimStartAndEndInline();
+		}
+		Steps.RemoveAll([](const FString& Step) { return Step.IsEmpty(); });
+
+		if (Steps.Num() > 0)
+		{
+			Selection.bAll = false;
+			Selection.AddPath(Steps, 0);
+		}
+	}
+
+	return Selection;
+}
+
+void FFieldSelection::AddPath(const TArray<FString>& Steps, int32 StepIndex)
+{
+	// A shorter path already selected everything here
+	if (bAll)
+	{
+		return;
+	}
+
+	TSharedPtr<FFieldSelection>& Child = Children.FindOrAdd(Steps[StepIndex]);
+	const bool bLastStep = StepIndex == Steps.Num() - 1;
+	if (!Child.IsValid())
+	{
+		Child = MakeShared<FFieldSelection>();
+		Child->bAll = bLastStep;
+	}
+	else if (bLastStep)
+	{
+		Child->bAll = true;
+		Child->Children.Empty();
+	}
+
+	if (!bLastStep)
+	{
+		Child->AddPath(Steps, StepIndex + 1);
+	}
+}
+
+const FFieldSelection* FFieldSelection::Select(const FString& Field, bool bByDefault) const
+{
+	if (bAll)
+	{
+		return bByDefault ? this : nullptr;
+	}
+
+	const TSharedPtr<FFieldSelection>* Child = Children.Find(Field);
+	return Child ? Child->Get() : nullptr;
+}
+
+const FFieldSelection* FFieldSelection::SelectElement(const FString& Name) const
+{
+	if (bAll)
+	{
+		return this;
+	}
+
+	const TSharedPtr<FFieldSelection>* Child = Children.Find(Name);
+	if (!Child)
+	{
+		Child = Children.Find(TEXT("[]"));
+	}
+	return Child ? Child->Get() : nullptr;
+}
+
+FString FFieldSelection::ToString() const
+{
+	if (bAll)
+	{
+		return TEXT("*");
+	}
+
+	TArray<FString> Keys;
+	Children.GetKeys(Keys);
+	Keys.Sort();
+
+	FString Result = TEXT("{");
+	for (const FString& Key : Keys)
+	{
+		Result += Key.ToLower() + TEXT(":") + Children[Key]->ToString() + TEXT(";");
+	}
+	return Result + TEXT("}");
+}
+
+bool FPageOptions::ParseFromQueryParams(const TMap<FString, FString>& QueryParams, int32 MaxLimit, FPageOptions& OutOptions, FString& OutError)
+{
+	const URevoltSettings* Settings = GetDefault<URevoltSettings>();
+	OutOptions = FPageOptions();
+	OutOptions.Limit = FMath::Min(Settings ? Settings->DefaultPageSize : OutOptions.Limit, MaxLimit);
+
+	if (const FString* LimitParam = QueryParams.Find(TEXT("limit")))
+	{
+		if (!LimitParam->IsNumeric() || FCString::Atoi(**LimitParam) < 1)
+		{
+			OutError = TEXT("'limit' must be a positive integer");
+			return false;
+		}
+		OutOptions.Limit = FMath::Min(FCString::Atoi(**LimitParam), MaxLimit);
+	}
+
+	if (const FString* CursorParam = QueryParams.Find(TEXT("cursor")))
+	{
+		if (!CursorParam->IsEmpty() && !DecodeCursor(*CursorParam, OutOptions.AfterKey))
+		{
+			OutError = TEXT("Invalid 'cursor'");
+			return false;
+		}
+	}
+
+	return true;
+}
+
+TArray<int32> FPageOptions::SelectPage(const TArray<FString>& Keys, bool& bOutHasMore) const
+{
+	// Case-insensitive order with a case-sensitive tie-break, so the order is total and stable
+	auto KeyLess = [](const FString& A, const FString& B)
+	{
+		const int32 Order = A.Compare(B, ESearchCase::IgnoreCase);
+		return Order != 0 ? Order < 0 : A.Compare(B, ESearchCase::CaseSensitive) < 0;
+	};
+
+	TArray<int32> Order;
+	Order.Reserve(Keys.Num());
+	for (int32 Index = 0; Index < Keys.Num(); ++Index)
+	{
+		if (AfterKey.IsEmpty() || KeyLess(AfterKey, Keys[Index]))
+		{
+			Order.Add(Index);
+		}
+	}
+
+	Order.Sort([&Keys, &KeyLess](int32 A, int32 B) { return KeyLess(Keys[A], Keys[B]); });
+	bOutHasMore = Order.Num() > Limit;
+	if (bOutHasMore)
+	{
+		Order.SetNum(Limit);
+	}
+	return Order;
+}
+
+FString FPageOptions::EncodeCursor(const FString& Key)
+{
+	FString Cursor = FBase64::Encode(Key, EBase64Mode::UrlSafe);
+	Cursor.RemoveFromEnd(TEXT("=="));
+	Cursor.RemoveFromEnd(TEXT("="));
+	return Cursor;
+}
+
+bool FPageOptions::DecodeCursor(const FString& Cursor, FString& OutKey)
+{
+	FString Padded = Cursor;
+	while (Padded.Len() % 4 != 0)
+	{
+		Padded += TEXT("=");
+	}
+	return FBase64::Decode(Padded, OutKey, EBase64Mode::UrlSafe) && !OutKey.IsEmpty();
+}
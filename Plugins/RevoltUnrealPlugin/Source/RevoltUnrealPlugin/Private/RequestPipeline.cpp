@@ -0,0 +1,341 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RequestPipeline.h"
+#include "RevoltSettings.h"
+#include "HttpServerConstants.h"
+#include "Async/Async.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FRequestPipeline::FRequestPipeline()
+	: CurrentJob(nullptr)
+	, InFlight(0)
+	, ParseQueued(0)
+	, GameThreadQueued(0)
+	, SerializeQueued(0)
+	, Detached(0)
+	, Completed(0)
+	, Rejected(0)
+	, GameThreadSeconds(0.0)
+	, LongestSliceSeconds(0.0)
+{
+}
+
+FRequestPipeline::~FRequestPipeline()
+{
+	Stop();
+}
+
+void FRequestPipeline::Start()
+{
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FRequestPipeline::Tick));
+	}
+}
+
+void FRequestPipeline::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// Workers reference the pipeline, so let them finish; their jobs end up in one of the queues below
+	WaitForWorkers();
+
+	// Answer everything while the connections are still open, so nothing is left for a later start
+	TSharedPtr<FJob> Job;
+	while (GameThreadQueue.Dequeue(Job))
+	{
+		--GameThreadQueued;
+		Job->Response = MakeErrorResponse(TEXT("Server is shutting down"), EHttpServerResponseCodes::ServiceUnavail);
+		Complete(Job.ToSharedRef());
+	}
+	while (CompletionQueue.Dequeue(Job))
+	{
+		Complete(Job.ToSharedRef());
+	}
+}
+
+FHttpRequestHandler FRequestPipeline::Wrap(FGameThreadHandler Handler)
+{
+	return FHttpRequestHandler::CreateLambda([this, Handler = MoveTemp(Handler)](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		const URevoltSettings* Settings = GetDefault<URevoltSettings>();
+		const int32 MaxConcurrent = Settings ? Settings->MaxConcurrentRequests : 32;
+		if (InFlight >= MaxConcurrent)
+		{
+			++Rejected;
+			TUniquePtr<FHttpServerResponse> Response = MakeErrorResponse(TEXT("Too many requests in flight, retry shortly"), EHttpServerResponseCodes::ServiceUnavail);
+			Response->Headers.Add(TEXT("Retry-After"), { TEXT("1") });
+			OnComplete(MoveTemp(Response));
+			return true;
+		}
+
+		TSharedRef<FJob> Job = MakeShared<FJob>();
+		Job->Request = Request;
+		Job->OnComplete = OnComplete;
+		Job->Handler = Handler;
+		Job->CompressionThreshold = Settings ? Settings->ResponseCompressionThreshold : 0;
+		if (const TArray<FString>* AcceptEncoding = Request.Headers.Find(TEXT("Accept-Encoding")))
+		{
+			for (const FString& Value : *AcceptEncoding)
+			{
+				Job->bAcceptsGzip |= Value.Contains(TEXT("gzip"));
+			}
+		}
+
+		++InFlight;
+		++ParseQueued;
+		LaunchWorker([this, Job]()
+		{
+			ParseBody(Job);
+		});
+		return true;
+	});
+}
+
+bool FRequestPipeline::GetParsedBody(const FHttpServerRequest& Request, TSharedPtr<FJsonObject>& OutJson) const
+{
+	if (!CurrentJob || &CurrentJob->Request != &Request)
+	{
+		return false;
+	}
+
+	OutJson = CurrentJob->ParsedBody;
+	return true;
+}
+
+bool FRequestPipeline::DeferJsonBody(const FHttpServerResponse& Response, const TSharedPtr<FJsonObject>& JsonObject)
+{
+	if (!CurrentJob)
+	{
+		return false;
+	}
+
+	CurrentJob->DeferredBodies.Add(&Response).JsonObject = JsonObject;
+	return true;
+}
+
+bool FRequestPipeline::DeferTextBody(const FHttpServerResponse& Response, const FString& JsonText)
+{
+	if (!CurrentJob)
+	{
+		return false;
+	}
+
+	CurrentJob->DeferredBodies.Add(&Response).JsonText = JsonText;
+	return true;
+}
+
+void FRequestPipeline::DetachCurrentRequest()
+{
+	if (!CurrentJob || CurrentJob->bDetached)
+	{
+		return;
+	}
+
+	CurrentJob->bDetached = true;
+	--InFlight;
+	++Detached;
+}
+
+TSharedPtr<FJsonObject> FRequestPipeline::GetStats() const
+{
+	const URevoltSettings* Settings = GetDefault<URevoltSettings>();
+
+	TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+	Stats->SetNumberField(TEXT("in_flight"), InFlight.load());
+	Stats->SetNumberField(TEXT("max_concurrent"), Settings ? Settings->MaxConcurrentRequests : 32);
+	Stats->SetNumberField(TEXT("parse_queue"), ParseQueued.load());
+	Stats->SetNumberField(TEXT("game_thread_queue"), GameThreadQueued.load());
+	Stats->SetNumberField(TEXT("serialize_queue"), SerializeQueued.load());
+	Stats->SetNumberField(TEXT("detached"), Detached);
+	Stats->SetNumberField(TEXT("completed"), (double)Completed);
+	Stats->SetNumberField(TEXT("rejected"), (double)Rejected);
+	Stats->SetNumberField(TEXT("game_thread_ms"), GameThreadSeconds * 1000.0);
+	Stats->SetNumberField(TEXT("longest_slice_ms"), LongestSliceSeconds * 1000.0);
+	return Stats;
+}
+
+FString FRequestPipeline::SerializeJson(const TSharedPtr<FJsonObject>& JsonObject)
+{
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	return JsonString;
+}
+
+void FRequestPipeline::ParseBody(const TSharedRef<FJob>& Job)
+{
+	bool bValid = true;
+	if (Job->Request.Body.Num() > 0)
+	{
+		FString BodyString;
+		FFileHelper::BufferToString(BodyString, Job->Request.Body.GetData(), Job->Request.Body.Num());
+
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BodyString);
+		bValid = FJsonSerializer::Deserialize(Reader, Job->ParsedBody) && Job->ParsedBody.IsValid();
+	}
+
+	--ParseQueued;
+	if (!bValid)
+	{
+		Job->Response = MakeErrorResponse(TEXT("Invalid JSON in request body"), EHttpServerResponseCodes::BadRequest);
+		CompletionQueue.Enqueue(Job);
+		return;
+	}
+
+	++GameThreadQueued;
+	GameThreadQueue.Enqueue(Job);
+}
+
+void FRequestPipeline::RunHandler(const TSharedRef<FJob>& Job)
+{
+	CurrentJob = &Job.Get();
+	const bool bHandled = Job->Handler(Job->Request, [this, Job](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		OnHandlerComplete(Job, MoveTemp(Response));
+	});
+	CurrentJob = nullptr;
+
+	// The router was already told the request is handled, so it has to get an answer
+	if (!bHandled && !Job->bResponded)
+	{
+		OnHandlerComplete(Job, MakeErrorResponse(TEXT("Request was not handled"), EHttpServerResponseCodes::NotFound));
+	}
+}
+
+void FRequestPipeline::OnHandlerComplete(const TSharedRef<FJob>& Job, TUniquePtr<FHttpServerResponse>&& Response)
+{
+	if (Job->bResponded || !Response)
+	{
+		return;
+	}
+	Job->bResponded = true;
+
+	FDeferredBody Body;
+	const bool bDeferred = Job->DeferredBodies.RemoveAndCopyValue(Response.Get(), Body);
+	Job->DeferredBodies.Empty();
+	Job->Response = MoveTemp(Response);
+
+	if (!bDeferred)
+	{
+		Complete(Job);
+		return;
+	}
+
+	++SerializeQueued;
+	LaunchWorker([this, Job, Body = MoveTemp(Body)]() mutable
+	{
+		WriteBody(Job, MoveTemp(Body));
+	});
+}
+
+void FRequestPipeline::WriteBody(const TSharedRef<FJob>& Job, FDeferredBody Body)
+{
+	const FString JsonText = Body.JsonObject.IsValid() ? SerializeJson(Body.JsonObject) : MoveTemp(Body.JsonText);
+
+	FTCHARToUTF8 Utf8(*JsonText);
+	TArray<uint8>& ResponseBody = Job->Response->Body;
+	ResponseBody.Reset();
+	ResponseBody.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	Job->Response->Headers.Add(TEXT("content-type"), { TEXT("application/json;charset=utf-8") });
+
+	if (Job->bAcceptsGzip && Job->CompressionThreshold > 0 && ResponseBody.Num() >= Job->CompressionThreshold)
+	{
+		int32 CompressedSize = (int32)FCompression::CompressMemoryBound(NAME_Gzip, ResponseBody.Num());
+		TArray<uint8> Compressed;
+		Compressed.SetNumUninitialized(CompressedSize);
+		if (FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, ResponseBody.GetData(), ResponseBody.Num()))
+		{
+			Compressed.SetNum(CompressedSize);
+			ResponseBody = MoveTemp(Compressed);
+			Job->Response->Headers.Add(TEXT("content-encoding"), { TEXT("gzip") });
+		}
+		Job->Response->Headers.Add(TEXT("vary"), { TEXT("Accept-Encoding") });
+	}
+
+	--SerializeQueued;
+	CompletionQueue.Enqueue(Job);
+}
+
+void FRequestPipeline::Complete(const TSharedRef<FJob>& Job)
+{
+	Job->OnComplete(MoveTemp(Job->Response));
+	if (Job->bDetached)
+	{
+		--Detached;
+	}
+	else
+	{
+		--InFlight;
+	}
+	++Completed;
+}
+
+bool FRequestPipeline::Tick(float DeltaTime)
+{
+	TSharedPtr<FJob> Job;
+	while (CompletionQueue.Dequeue(Job))
+	{
+		Complete(Job.ToSharedRef());
+	}
+
+	// Run handlers until the budget is used, always at least one so a slow handler cannot starve the queue
+	const URevoltSettings* Settings = GetDefault<URevoltSettings>();
+	const double Budget = (Settings ? Settings->GameThreadBudgetMs : 4.0f) / 1000.0;
+	const double SliceStart = FPlatformTime::Seconds();
+	double Elapsed = 0.0;
+
+	while (Elapsed < Budget && GameThreadQueue.Dequeue(Job))
+	{
+		--GameThreadQueued;
+		RunHandler(Job.ToSharedRef());
+		Elapsed = FPlatformTime::Seconds() - SliceStart;
+	}
+
+	GameThreadSeconds += Elapsed;
+	LongestSliceSeconds = FMath::Max(LongestSliceSeconds, Elapsed);
+
+	return true;
+}
+
+void FRequestPipeline::LaunchWorker(TUniqueFunction<void()>&& Work)
+{
+	FScopeLock Lock(&WorkersLock);
+	Workers.RemoveAll([](const TFuture<void>& Worker) { return Worker.IsReady(); });
+	Workers.Add(Async(EAsyncExecution::ThreadPool, MoveTemp(Work)));
+}
+
+void FRequestPipeline::WaitForWorkers()
+{
+	TArray<TFuture<void>> Running;
+	{
+		FScopeLock Lock(&WorkersLock);
+		Running = MoveTemp(Workers);
+		Workers.Reset();
+	}
+
+	for (TFuture<void>& Worker : Running)
+	{
+		Worker.Wait();
+	}
+}
+
+TUniquePtr<FHttpServerResponse> FRequestPipeline::MakeErrorResponse(const FString& ErrorMessage, EHttpServerResponseCodes ResponseCode)
+{
+	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetBoolField(TEXT("success"), false);
+	JsonObject->SetStringField(TEXT("error"), ErrorMessage);
+
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(SerializeJson(JsonObject), TEXT("application/json"));
+	Response->Code = ResponseCode;
+	return Response;
+}
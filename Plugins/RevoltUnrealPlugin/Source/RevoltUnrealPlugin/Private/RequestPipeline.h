@@ -0,0 +1,164 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "HttpResultCallback.h"
+#include "HttpRequestHandler.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
+#include "HAL/CriticalSection.h"
+#include "Dom/JsonObject.h"
+#include <atomic>
+
+/**
+ * Runs HTTP requests in three stages so the editor only spends time on the parts that need UObjects:
+ *   1. Parse and validate the JSON body on a worker thread
+ *   2. Run the route handler on the game thread, in slices batched per tick under a time budget
+ *   3. Serialize the response JSON and gzip it on a worker thread
+ * The HTTP server only accepts responses on the game thread, so finished responses are handed back at the next tick.
+ * Handlers stay unchanged: while one runs, ParseRequestBody and the response helpers ask the pipeline for the
+ * pre-parsed body and defer the response body to stage 3.
+ */
+class FRequestPipeline
+{
+public:
+
+	/** Route handler run in the game thread stage */
+	typedef TFunction<bool(const FHttpServerRequest&, const FHttpResultCallback&)> FGameThreadHandler;
+
+	FRequestPipeline();
+	~FRequestPipeline();
+
+	/** Start ticking the game thread stage */
+	void Start();
+
+	/** Stop ticking, wait for the worker stages and answer every request still in the pipeline */
+	void Stop();
+
+	/** Route handler that runs a handler through the pipeline */
+	FHttpRequestHandler Wrap(FGameThreadHandler Handler);
+
+	/**
+	 * Get the body parsed in stage 1 for the request being handled
+	 * @param Request Request passed to the running handler
+	 * @param OutJson Parsed body (null if the request had no body)
+	 * @return False if the request is not being handled by the pipeline
+	 */
+	bool GetParsedBody(const FHttpServerRequest& Request, TSharedPtr<FJsonObject>& OutJson) const;
+
+	/**
+	 * Leave the body of a response to stage 3
+	 * @param Response Response created by the running handler (body empty)
+	 * @param JsonObject Body to serialize
+	 * @return False if no pipelined handler is running (the caller must fill the body itself)
+	 */
+	bool DeferJsonBody(const FHttpServerResponse& Response, const TSharedPtr<FJsonObject>& JsonObject);
+
+	/** Leave an already serialized JSON body to stage 3 (UTF-8 conversion and compression) */
+	bool DeferTextBody(const FHttpServerResponse& Response, const FString& JsonText);
+
+	/**
+	 * Stop counting the running handler's request as in flight, for a request parked to be answered later (a long poll).
+	 * It is still answered through the pipeline, but no longer holds one of the Max Concurrent Requests slots.
+	 */
+	void DetachCurrentRequest();
+
+	/** Queue depths and counters for /api/status */
+	TSharedPtr<FJsonObject> GetStats() const;
+
+	/** Serialize a JSON object the way responses are written */
+	static FString SerializeJson(const TSharedPtr<FJsonObject>& JsonObject);
+
+private:
+
+	struct FDeferredBody
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		FString JsonText;
+	};
+
+	struct FJob
+	{
+		FHttpServerRequest Request;
+		FHttpResultCallback OnComplete;
+		FGameThreadHandler Handler;
+
+		/** Stage 1 result */
+		TSharedPtr<FJsonObject> ParsedBody;
+
+		/** Bodies of the responses the handler created, by response */
+		TMap<const FHttpServerResponse*, FDeferredBody> DeferredBodies;
+
+		/** Response ready to be sent */
+		TUniquePtr<FHttpServerResponse> Response;
+
+		/** Compress bodies at least this large (0 = never), captured on the game thread */
+		int32 CompressionThreshold = 0;
+		bool bAcceptsGzip = false;
+		bool bResponded = false;
+
+		/** Released its in-flight slot while waiting */
+		bool bDetached = false;
+	};
+
+	/** Stage 1 (worker) */
+	void ParseBody(const TSharedRef<FJob>& Job);
+
+	/** Stage 2 (game thread) */
+	void RunHandler(const TSharedRef<FJob>& Job);
+
+	/** Called by the handler with its response (game thread) */
+	void OnHandlerComplete(const TSharedRef<FJob>& Job, TUniquePtr<FHttpServerResponse>&& Response);
+
+	/** Stage 3 (worker) */
+	void WriteBody(const TSharedRef<FJob>& Job, FDeferredBody Body);
+
+	/** Send the job's response (game thread) */
+	void Complete(const TSharedRef<FJob>& Job);
+
+	/** Ticker callback: send finished responses, then run handlers until the budget is used */
+	bool Tick(float DeltaTime);
+
+	/** Run a worker stage on the thread pool, tracked so Stop can wait for it */
+	void LaunchWorker(TUniqueFunction<void()>&& Work);
+
+	/** Wait for every worker stage still running */
+	void WaitForWorkers();
+
+	/** JSON error response built off the game thread */
+	static TUniquePtr<FHttpServerResponse> MakeErrorResponse(const FString& ErrorMessage, EHttpServerResponseCodes ResponseCode);
+
+	/** Jobs waiting for the game thread stage */
+	TQueue<TSharedPtr<FJob>, EQueueMode::Mpsc> GameThreadQueue;
+
+	/** Jobs with a response ready to send */
+	TQueue<TSharedPtr<FJob>, EQueueMode::Mpsc> CompletionQueue;
+
+	/** Job whose handler is running (game thread only) */
+	FJob* CurrentJob;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	/** Worker stages launched and not yet known to be finished */
+	FCriticalSection WorkersLock;
+	TArray<TFuture<void>> Workers;
+
+	/** Queue depths */
+	std::atomic<int32> InFlight;
+	std::atomic<int32> ParseQueued;
+	std::atomic<int32> GameThreadQueued;
+	std::atomic<int32> SerializeQueued;
+
+	/** Requests parked outside the pipeline (game thread only) */
+	int32 Detached;
+
+	/** Counters (game thread only) */
+	uint64 Completed;
+	uint64 Rejected;
+	double GameThreadSeconds;
+	double LongestSliceSeconds;
+};
@@ -0,0 +1,181 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ResponseCache.h"
+#include "RevoltSettings.h"
+#include "Editor.h"
+#include "Hash/CityHash.h"
+#include "UObject/Package.h"
+
+FResponseCache* FResponseCache::Instance = nullptr;
+
+FResponseCache::FResponseCache()
+	: Epoch(0)
+	, UseCounter(0)
+	, Hits(0)
+	, Misses(0)
+{
+}
+
+FResponseCache& FResponseCache::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FResponseCache();
+	}
+	return *Instance;
+}
+
+void FResponseCache::Initialize()
+{
+	// Marked-dirty fires on every modification, not only the clean -> dirty transition
+	PackageDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddRaw(this, &FResponseCache::OnPackageMarkedDirty);
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FResponseCache::OnPackageSaved);
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FResponseCache::OnBlueprintCompiled);
+	}
+}
+
+void FResponseCache::Shutdown()
+{
+	UPackage::PackageMarkedDirtyEvent.Remove(PackageDirtyHandle);
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+
+	Clear();
+	Generations.Empty();
+}
+
+bool FResponseCache::Find(FName PackageName, const FString& Key, FString& OutJson, FString& OutETag)
+{
+	const URevoltSettings* Settings = GetDefault<URevoltSettings>();
+	if (!Settings || !Settings->bEnableResponseCache)
+	{
+		return false;
+	}
+
+	FEntry* Entry = Entries.Find(PackageName.ToString() + TEXT("|") + Key);
+	if (!Entry)
+	{
+		++Misses;
+		return false;
+	}
+
+	++Hits;
+	Entry->LastUsed = ++UseCounter;
+	OutJson = Entry->Json;
+	OutETag = Entry->ETag;
+	return true;
+}
+
+uint32 FResponseCache::GetGeneration(FName PackageName) const
+{
+	// Both counters only grow, so their sum changes whenever either is bumped
+	const uint32* Generation = Generations.Find(PackageName);
+	return Epoch + (Generation ? *Generation : 0);
+}
+
+FString FResponseCache::Add(FName PackageName, const FString& Key, const FString& Json, uint32 Generation)
+{
+	FString ETag = MakeETag(Json);
+
+	const URevoltSettings* Settings = GetDefault<URevoltSettings>();
+	const int32 MaxEntries = Settings ? Settings->ResponseCacheMaxEntries : 256;
+	if (!Settings || !Settings->bEnableResponseCache || MaxEntries <= 0)
+	{
+		return ETag;
+	}
+
+	// The package changed while the response was being built, so it may already be stale
+	if (GetGeneration(PackageName) != Generation)
+	{
+		return ETag;
+	}
+
+	const FString CacheKey = PackageName.ToString() + TEXT("|") + Key;
+	if (!Entries.Contains(CacheKey))
+	{
+		while (Entries.Num() >= MaxEntries)
+		{
+			EvictOldest();
+		}
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(CacheKey);
+	Entry.PackageName = PackageName;
+	Entry.Json = Json;
+	Entry.ETag = ETag;
+	Entry.LastUsed = ++UseCounter;
+
+	return ETag;
+}
+
+void FResponseCache::Invalidate(FName PackageName)
+{
+	++Generations.FindOrAdd(PackageName);
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It->Value.PackageName == PackageName)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FResponseCache::Clear()
+{
+	// Bump every package at once so responses being built right now are not stored either
+	++Epoch;
+	Entries.Empty();
+}
+
+FString FResponseCache::MakeETag(const FString& Json)
+{
+	const uint64 Hash = CityHash64(reinterpret_cast<const char*>(*Json), Json.Len() * sizeof(TCHAR));
+	return FString::Printf(TEXT("\"%016llx\""), Hash);
+}
+
+void FResponseCache::EvictOldest()
+{
+	const FString* OldestKey = nullptr;
+	uint64 OldestUse = MAX_uint64;
+	for (const TPair<FString, FEntry>& Pair : Entries)
+	{
+		if (Pair.Value.LastUsed < OldestUse)
+		{
+			OldestUse = Pair.Value.LastUsed;
+			OldestKey = &Pair.Key;
+		}
+	}
+
+	if (OldestKey)
+	{
+		Entries.Remove(FString(*OldestKey));
+	}
+}
+
+void FResponseCache::OnPackageMarkedDirty(UPackage* Package, bool bWasDirty)
+{
+	if (Package)
+	{
+		Invalidate(Package->GetFName());
+	}
+}
+
+void FResponseCache::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (Package)
+	{
+		Invalidate(Package->GetFName());
+	}
+}
+
+void FResponseCache::OnBlueprintCompiled()
+{
+	// Compiling a parent changes what its children inherit, and those live in other packages
+	Clear();
+}
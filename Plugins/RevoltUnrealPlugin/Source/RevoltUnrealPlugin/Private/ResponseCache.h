@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectSaveContext.h"
+
+class UPackage;
+
+/**
+ * Cache of serialized query responses, keyed by the package they were extracted from and the request key
+ * (asset path + query options).
+ * Every package has a generation that is bumped whenever it is marked dirty or saved; entries of a package are
+ * dropped when its generation changes, and a response built while the package changed is not stored.
+ * ETags are a hash of the response text, so they stay valid across invalidations that did not change the output.
+ */
+class FResponseCache
+{
+public:
+
+	/** Get singleton instance */
+	static FResponseCache& Get();
+
+	/** Subscribe to package dirty/saved and blueprint compile events */
+	void Initialize();
+
+	/** Unsubscribe from events and drop all entries */
+	void Shutdown();
+
+	/**
+	 * Find a cached response
+	 * @param PackageName Package the response was extracted from
+	 * @param Key Request key
+	 * @param OutJson Cached response text
+	 * @param OutETag ETag of the response
+	 * @return True on a hit
+	 */
+	bool Find(FName PackageName, const FString& Key, FString& OutJson, FString& OutETag);
+
+	/** Current generation of a package (capture before building a response, pass to Add) */
+	uint32 GetGeneration(FName PackageName) const;
+
+	/**
+	 * Store a response
+	 * @param PackageName Package the response was extracted from
+	 * @param Key Request key
+	 * @param Json Response text
+	 * @param Generation Package generation captured before the response was built
+	 * @return ETag of the response
+	 */
+	FString Add(FName PackageName, const FString& Key, const FString& Json, uint32 Generation);
+
+	/** Drop the entries of a package and bump its generation */
+	void Invalidate(FName PackageName);
+
+	/** Drop all entries and bump every package generation */
+	void Clear();
+
+	/** ETag for a response text */
+	static FString MakeETag(const FString& Json);
+
+	/** Statistics */
+	int32 Num() const { return Entries.Num(); }
+	uint64 GetHits() const { return Hits; }
+	uint64 GetMisses() const { return Misses; }
+
+private:
+
+	/** Private constructor for singleton */
+	FResponseCache();
+
+	struct FEntry
+	{
+		FName PackageName;
+		FString Json;
+		FString ETag;
+		uint64 LastUsed = 0;
+	};
+
+	/** Evict the least recently used entry */
+	void EvictOldest();
+
+	/** Event callbacks */
+	void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+	void OnBlueprintCompiled();
+
+	/** Cache key -> entry (cache key is package name + request key) */
+	TMap<FString, FEntry> Entries;
+
+	/** Package -> generation (missing means 0) */
+	TMap<FName, uint32> Generations;
+
+	/** Bumped by Clear, added to every package generation */
+	uint32 Epoch;
+
+	/** Use counter for LRU eviction */
+	uint64 UseCounter;
+
+	/** Statistics */
+	uint64 Hits;
+	uint64 Misses;
+
+	/** Event subscriptions */
+	FDelegateHandle PackageDirtyHandle;
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+
+	/** Singleton instance */
+	static FResponseCache* Instance;
+};
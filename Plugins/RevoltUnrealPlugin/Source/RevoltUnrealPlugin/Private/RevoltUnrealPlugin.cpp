@@ -2,6 +2,11 @@
 
 #include "RevoltUnrealPlugin.h"
 #include "HttpServerManager.h"
+#include "AssetIndex.h"
+#include "ResponseCache.h"
+#include "LevelActorCache.h"
+#include "ChangeFeed.h"
+#include "BackupManager.h"
 #include "RevoltSettings.h"
 #include "ToolMenus.h"
 #include "Editor.h"
@@ -14,6 +19,24 @@ void FRevoltUnrealPluginModule::StartupModule()
 {
 	UE_LOG(LogTemp, Log, TEXT("RevoltUnrealPlugin: Module starting up"));
 
+	// Keep an asset index current so queries don't walk the asset registry
+	FAssetIndex::Get().Initialize();
+
+	// Drop cached query responses when the packages they came from change
+	FResponseCache::Get().Initialize();
+
+	// Drop cached level actor summaries when their level is saved
+	FLevelActorCache::Get().Initialize();
+
+	// Record asset, actor and transaction events for /api/changes
+	FChangeFeed::Get().Initialize();
+
+	// Apply the backup retention policy (expired manifests, then chunks nothing uses)
+	if (const URevoltSettings* Settings = GetDefault<URevoltSettings>())
+	{
+		FBackupManager::CleanOldBackups(Settings->BackupRetentionDays);
+	}
+
 	// Initialize menus
 	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FRevoltUnrealPluginModule::RegisterMenus));
 
@@ -27,6 +50,17 @@ void FRevoltUnrealPluginModule::StartupModule()
 		})
 	);
 
+	IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("Revolt.BenchmarkBackups"),
+		TEXT("Compare backup time and disk use of the chunk store and full copies. Usage: Revolt.BenchmarkBackups [Edits=1000] [PackageName]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 NumEdits = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000;
+			const FString PackageName = Args.Num() > 1 ? Args[1] : FString();
+			FBackupManager::RunBenchmark(NumEdits, PackageName);
+		})
+	);
+
 	// Force start server for testing
 	UE_LOG(LogTemp, Log, TEXT("RevoltUnrealPlugin: Force starting server for testing..."));
 	if (GEditor)
@@ -50,6 +84,14 @@ void FRevoltUnrealPluginModule::ShutdownModule()
 	// Stop the HTTP server
 	FHttpServerManager::Get().StopServer();
 
+	// Let backups still being written finish
+	FBackupManager::Shutdown();
+
+	FChangeFeed::Get().Shutdown();
+	FLevelActorCache::Get().Shutdown();
+	FResponseCache::Get().Shutdown();
+	FAssetIndex::Get().Shutdown();
+
 	// Unregister menus
 	UnregisterMenus();
 }
@@ -2,6 +2,14 @@
 
 #include "TransactionManager.h"
 #include "BackupManager.h"
+#include "BlueprintEditHandler.h"
+#include "ChangeFeed.h"
+#include "RevoltSettings.h"
+#include "Engine/Blueprint.h"
+#include "Dom/JsonValue.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
 
 FTransactionManager* FTransactionManager::Instance = nullptr;
 
@@ -56,15 +64,24 @@ bool FTransactionManager::EndTransaction()
 	UndoStack.Add(CurrentTransaction);
 	if (UndoStack.Num() > MaxUndoStackSize)
 	{
+		ReleaseDeltas(*UndoStack[0]);
 		UndoStack.RemoveAt(0);
 	}
 
 	// Clear redo stack when new transaction completes
+	for (const TSharedPtr<FTransactionRecord>& Transaction : RedoStack)
+	{
+		ReleaseDeltas(*Transaction);
+	}
 	RedoStack.Empty();
 
+	EnforceMemoryBudget();
+
 	UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Transaction completed: '%s' (%d changes)"),
 		*CurrentTransaction->Description, CurrentTransaction->Changes.Num());
 
+	PublishEvent(TEXT("transaction_committed"), *CurrentTransaction);
+
 	CurrentTransaction.Reset();
 	return true;
 }
@@ -79,6 +96,11 @@ bool FTransactionManager::CancelTransaction()
 
 	UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: Transaction cancelled: '%s'"), *CurrentTransaction->Description);
 
+	PublishEvent(TEXT("transaction_cancelled"), *CurrentTransaction);
+
+	// Put edited property values back, except in packages restored from a backup below
+	ApplyPropertyDeltas(*CurrentTransaction, true, GetBackedUpPackages(*CurrentTransaction));
+
 	// Restore all backups from this transaction
 	for (const auto& Change : CurrentTransaction->Changes)
 	{
@@ -87,7 +109,8 @@ bool FTransactionManager::CancelTransaction()
 		{
 			if (!BackupPath.IsEmpty())
 			{
-				FBackupManager::RestoreBackup(BackupPath);
+				// Structural changes can only be undone from the file
+				FBackupManager::RestoreBackup(BackupPath, true);
 			}
 		}
 	}
@@ -114,6 +137,22 @@ void FTransactionManager::RecordChange(const FString& AssetPath, const FString&
 	CurrentTransaction->Changes.Add(Change);
 }
 
+void FTransactionManager::RecordPropertyChange(UObject* Owner, const FName& PropertyName, const FString& OldValue, const FString& NewValue)
+{
+	if (!CurrentTransaction || !Owner)
+	{
+		return;
+	}
+
+	FPropertyDelta& Delta = CurrentTransaction->PropertyDeltas.AddDefaulted_GetRef();
+	Delta.Owner = FSoftObjectPath(Owner);
+	Delta.PropertyName = PropertyName;
+	Delta.OldValue = OldValue;
+	Delta.NewValue = NewValue;
+
+	CurrentTransaction->DeltaBytes += Delta.GetAllocatedSize();
+}
+
 bool FTransactionManager::Undo()
 {
 	if (UndoStack.Num() == 0)
@@ -125,14 +164,31 @@ bool FTransactionManager::Undo()
 	// Get last transaction
 	TSharedPtr<FTransactionRecord> Transaction = UndoStack.Pop();
 
-	// Restore all backups
-	bool bSuccess = true;
+	// Property edits: set the old values again
+	const TSet<FString> BackedUpPackages = GetBackedUpPackages(*Transaction);
+	bool bSuccess = ApplyPropertyDeltas(*Transaction, true, BackedUpPackages);
+
+	// Structural changes: back up the current file for redo, then restore the one from before the transaction
 	for (const auto& Change : Transaction->Changes)
 	{
 		FString BackupPath;
 		if (Change->TryGetStringField(TEXT("backup_path"), BackupPath))
 		{
-			if (!FBackupManager::RestoreBackup(BackupPath))
+			FString AssetPath;
+			Change->TryGetStringField(TEXT("asset_path"), AssetPath);
+			// Backups capture the file, so unsaved edits are saved first or redo would restore the pre-transaction file
+			Change->RemoveField(TEXT("redo_backup_path"));
+			UPackage* Package = FindPackage(nullptr, *FPackageName::ObjectPathToPackageName(AssetPath));
+			if (Package && (!Package->IsDirty() || SavePackage(Package)))
+			{
+				Change->SetStringField(TEXT("redo_backup_path"), FBackupManager::CreateBackup(Package));
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: Could not capture '%s' for redo"), *AssetPath);
+			}
+
+			if (!FBackupManager::RestoreBackup(BackupPath, true))
 			{
 				bSuccess = false;
 			}
@@ -144,6 +200,11 @@ bool FTransactionManager::Undo()
 		// Move to redo stack
 		RedoStack.Add(Transaction);
 		UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Undone transaction: '%s'"), *Transaction->Description);
+		PublishEvent(TEXT("transaction_undone"), *Transaction);
+	}
+	else
+	{
+		ReleaseDeltas(*Transaction);
 	}
 
 	return bSuccess;
@@ -157,14 +218,174 @@ bool FTransactionManager::Redo()
 		return false;
 	}
 
-	// For now, log that redo would happen
 	TSharedPtr<FTransactionRecord> Transaction = RedoStack.Pop();
-	UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: Redo transaction: '%s' - Feature requires re-executing operations"), *Transaction->Description);
 
-	// Move back to undo stack
-	UndoStack.Add(Transaction);
+	// Structural changes: restore the files backed up when the transaction was undone
+	bool bSuccess = true;
+	for (const auto& Change : Transaction->Changes)
+	{
+		FString BackupPath;
+		if (Change->TryGetStringField(TEXT("backup_path"), BackupPath))
+		{
+			FString RedoBackupPath;
+			if (!Change->TryGetStringField(TEXT("redo_backup_path"), RedoBackupPath) || !FBackupManager::RestoreBackup(RedoBackupPath, true))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: No backup to redo changes to '%s'"), *Change->GetStringField(TEXT("asset_path")));
+				bSuccess = false;
+			}
+		}
+	}
+
+	// Property edits: set the new values again
+	if (!ApplyPropertyDeltas(*Transaction, false, GetBackedUpPackages(*Transaction)))
+	{
+		bSuccess = false;
+	}
 
-	return true;
+	if (bSuccess)
+	{
+		// Move back to undo stack
+		UndoStack.Add(Transaction);
+		UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Redone transaction: '%s'"), *Transaction->Description);
+		PublishEvent(TEXT("transaction_redone"), *Transaction);
+	}
+	else
+	{
+		ReleaseDeltas(*Transaction);
+	}
+
+	return bSuccess;
+}
+
+bool FTransactionManager::ApplyPropertyDeltas(const FTransactionRecord& Transaction, bool bUndo, const TSet<FString>& SkipPackages)
+{
+	bool bAllApplied = true;
+
+	const int32 NumDeltas = Transaction.PropertyDeltas.Num();
+	for (int32 i = 0; i < NumDeltas; i++)
+	{
+		// Undo newest first, so a property edited twice ends at its first old value
+		const FPropertyDelta& Delta = Transaction.PropertyDeltas[bUndo ? NumDeltas - 1 - i : i];
+
+		if (SkipPackages.Contains(Delta.Owner.GetLongPackageName()))
+		{
+			continue;
+		}
+
+		// Resolved by path, so objects replaced by a package reload are found again
+		UObject* Owner = Delta.Owner.ResolveObject();
+		if (!Owner)
+		{
+			Owner = Delta.Owner.TryLoad();
+		}
+		if (!Owner)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: Cannot set '%s', its asset '%s' was not found"), *Delta.PropertyName.ToString(), *Delta.Owner.ToString());
+			bAllApplied = false;
+			continue;
+		}
+
+		// Blueprint values live on the current CDO
+		UObject* Target = Owner;
+		if (UBlueprint* Blueprint = Cast<UBlueprint>(Owner))
+		{
+			Target = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+		}
+
+		FProperty* Property = Target ? Target->GetClass()->FindPropertyByName(Delta.PropertyName) : nullptr;
+		if (!Property || !FBlueprintEditHandler::SetPropertyValue(Target, Property, bUndo ? Delta.OldValue : Delta.NewValue))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("RevoltPlugin: Failed to set '%s' on '%s'"), *Delta.PropertyName.ToString(), *Owner->GetName());
+			bAllApplied = false;
+			continue;
+		}
+
+		Owner->MarkPackageDirty();
+	}
+
+	return bAllApplied;
+}
+
+TSet<FString> FTransactionManager::GetBackedUpPackages(const FTransactionRecord& Transaction)
+{
+	TSet<FString> Packages;
+	for (const auto& Change : Transaction.Changes)
+	{
+		FString BackupPath;
+		FString AssetPath;
+		if (Change->TryGetStringField(TEXT("backup_path"), BackupPath) && Change->TryGetStringField(TEXT("asset_path"), AssetPath))
+		{
+			Packages.Add(FPackageName::ObjectPathToPackageName(AssetPath));
+		}
+	}
+	return Packages;
+}
+
+void FTransactionManager::EnforceMemoryBudget()
+{
+	const URevoltSettings* Settings = GetDefault<URevoltSettings>();
+	const int64 BudgetBytes = (int64)Settings->UndoMemoryBudgetMB * 1024 * 1024;
+
+	int64 UsedBytes = 0;
+	for (const TSharedPtr<FTransactionRecord>& Transaction : UndoStack)
+	{
+		UsedBytes += Transaction->DeltaBytes;
+	}
+	for (const TSharedPtr<FTransactionRecord>& Transaction : RedoStack)
+	{
+		UsedBytes += Transaction->DeltaBytes;
+	}
+
+	while (UsedBytes > BudgetBytes && UndoStack.Num() > 0)
+	{
+		TSharedPtr<FTransactionRecord> Oldest = UndoStack[0];
+		UndoStack.RemoveAt(0);
+
+		UsedBytes -= Oldest->DeltaBytes;
+		ReleaseDeltas(*Oldest);
+
+		UE_LOG(LogTemp, Log, TEXT("RevoltPlugin: Undo memory budget reached, '%s' can no longer be undone"), *Oldest->Description);
+	}
+}
+
+bool FTransactionManager::SavePackage(UPackage* Package)
+{
+	FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_NoError;
+
+	return UPackage::SavePackage(Package, nullptr, *PackageFileName, SaveArgs);
+}
+
+void FTransactionManager::ReleaseDeltas(FTransactionRecord& Transaction)
+{
+	Transaction.PropertyDeltas.Empty();
+	Transaction.DeltaBytes = 0;
+}
+
+void FTransactionManager::PublishEvent(const FString& Type, const FTransactionRecord& Transaction)
+{
+	// Packages touched, so mirrors know what to query again
+	TSet<FString> Packages = GetBackedUpPackages(Transaction);
+	for (const FPropertyDelta& Delta : Transaction.PropertyDeltas)
+	{
+		Packages.Add(Delta.Owner.GetLongPackageName());
+	}
+
+	TArray<TSharedPtr<FJsonValue>> PackageValues;
+	for (const FString& Package : Packages)
+	{
+		PackageValues.Add(MakeShared<FJsonValueString>(Package));
+	}
+
+	TSharedPtr<FJsonObject> Event = MakeShared<FJsonObject>();
+	Event->SetStringField(TEXT("description"), Transaction.Description);
+	Event->SetNumberField(TEXT("change_count"), Transaction.Changes.Num());
+	Event->SetNumberField(TEXT("property_change_count"), Transaction.PropertyDeltas.Num());
+	Event->SetArrayField(TEXT("packages"), PackageValues);
+	FChangeFeed::Get().Publish(Type, Event);
 }
 
 TArray<TSharedPtr<FJsonObject>> FTransactionManager::GetTransactionHistory(int32 MaxEntries)
@@ -190,6 +411,10 @@ TArray<TSharedPtr<FJsonObject>> FTransactionManager::GetTransactionHistory(int32
 
 void FTransactionManager::ClearHistory()
 {
+	for (const TSharedPtr<FTransactionRecord>& Transaction : TransactionHistory)
+	{
+		ReleaseDeltas(*Transaction);
+	}
 	TransactionHistory.Empty();
 	UndoStack.Empty();
 	RedoStack.Empty();
@@ -4,6 +4,27 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "UObject/SoftObjectPath.h"
+
+class UPackage;
+
+/**
+ * Property value change kept in memory, undone and redone by setting the value again
+ */
+struct FPropertyDelta
+{
+	/** Blueprint (the value lives on its CDO, which compiling replaces) or data asset, by path as restoring a backup reloads it */
+	FSoftObjectPath Owner;
+	FName PropertyName;
+	FString OldValue;
+	FString NewValue;
+
+	/** Bytes counted against the undo memory budget */
+	int64 GetAllocatedSize() const
+	{
+		return sizeof(FPropertyDelta) + OldValue.GetAllocatedSize() + NewValue.GetAllocatedSize();
+	}
+};
 
 /**
  * Transaction record for undo/redo operations
@@ -17,15 +38,24 @@ struct FTransactionRecord
 	TArray<TSharedPtr<FJsonObject>> Changes;
 	bool bCompleted;
 
+	/** Property changes in the order they were made */
+	TArray<FPropertyDelta> PropertyDeltas;
+
+	/** Bytes used by PropertyDeltas */
+	int64 DeltaBytes;
+
 	FTransactionRecord()
 		: Timestamp(FDateTime::Now())
 		, bCompleted(false)
+		, DeltaBytes(0)
 	{
 	}
 };
 
 /**
  * Manages transactions for atomic operations and undo/redo
+ * Property edits are undone and redone in memory from their recorded values. Changes recorded with a backup
+ * (structural edits) are undone by restoring the package file, which replaces the property deltas of that package.
  */
 class FTransactionManager
 {
@@ -68,6 +98,15 @@ public:
 	 */
 	void RecordChange(const FString& AssetPath, const FString& BackupPath, const TSharedPtr<FJsonObject>& Change);
 
+	/**
+	 * Record a property change in the current transaction (ignored without one)
+	 * @param Owner Blueprint or data asset the property was edited on
+	 * @param PropertyName Property name
+	 * @param OldValue Value before the edit (exported text)
+	 * @param NewValue Value after the edit (exported text)
+	 */
+	void RecordPropertyChange(UObject* Owner, const FName& PropertyName, const FString& OldValue, const FString& NewValue);
+
 	/**
 	 * Undo the last transaction
 	 * @return True if undo successful
@@ -97,6 +136,30 @@ private:
 	/** Private constructor for singleton */
 	FTransactionManager();
 
+	/**
+	 * Set the recorded values of a transaction's property changes (newest first when undoing)
+	 * @param Transaction Transaction to apply
+	 * @param bUndo Apply old values instead of new values
+	 * @param SkipPackages Packages restored from a file instead
+	 * @return True if every value was set
+	 */
+	bool ApplyPropertyDeltas(const FTransactionRecord& Transaction, bool bUndo, const TSet<FString>& SkipPackages);
+
+	/** Packages of a transaction's changes that have a backup */
+	static TSet<FString> GetBackedUpPackages(const FTransactionRecord& Transaction);
+
+	/** Drop the oldest undo entries until the property deltas fit the memory budget */
+	void EnforceMemoryBudget();
+
+	/** Save a package to its file */
+	static bool SavePackage(UPackage* Package);
+
+	/** Free the property deltas of a transaction that left the undo and redo stacks */
+	static void ReleaseDeltas(FTransactionRecord& Transaction);
+
+	/** Add a transaction event to the change feed, with the packages it touched */
+	static void PublishEvent(const FString& Type, const FTransactionRecord& Transaction);
+
 	/** Current active transaction */
 	TSharedPtr<FTransactionRecord> CurrentTransaction;
 
@@ -16,6 +16,55 @@ enum class EQueryDepth : uint8
 	Full        // + graph nodes and connections
 };
 
+/**
+ * Field projection parsed from the "fields" URL query parameter
+ * A comma separated list of dot separated paths. Inside an array of reflected members (properties, functions,
+ * graphs, ...) a path step names a member, and "[]" applies the rest of the path to every member, e.g.
+ * "parent_class,properties.Health,functions[].name". A path selects everything below where it ends.
+ * Fields a selection does not mention are left out; where a whole level is selected, the depth flags decide.
+ */
+struct FFieldSelection
+{
+	/** Select everything (no projection) */
+	FFieldSelection() : bAll(true) {}
+
+	/**
+	 * Parse a fields list
+	 * @param Fields Comma separated paths (empty selects everything)
+	 * @return Selection tree
+	 */
+	static FFieldSelection Parse(const FString& Fields);
+
+	/** Whether everything below this level is selected */
+	bool IsAll() const { return bAll; }
+
+	/**
+	 * Selection below a field
+	 * @param Field Field name
+	 * @param bByDefault Whether the field is included when this whole level is selected (usually a depth flag)
+	 * @return Selection below the field, or nullptr if the field is not selected
+	 */
+	const FFieldSelection* Select(const FString& Field, bool bByDefault = true) const;
+
+	/**
+	 * Selection for one member of an array of reflected members
+	 * @param Name Member name (property, function, graph, ...)
+	 * @return The member's own selection, else the "[]" selection, or nullptr if the member is not selected
+	 */
+	const FFieldSelection* SelectElement(const FString& Name) const;
+
+	/** Canonical form, for cache keys */
+	FString ToString() const;
+
+private:
+
+	/** Add a path below this node */
+	void AddPath(const TArray<FString>& Steps, int32 StepIndex);
+
+	bool bAll;
+	TMap<FString, TSharedPtr<FFieldSelection>> Children;
+};
+
 /**
  * Query options for controlling data extraction depth
  * Parsed from URL query parameters
@@ -43,20 +92,74 @@ struct FQueryOptions
 	/** Include component data for actors */
 	bool bIncludeComponents = true;
 
+	/** Field projection ("fields" parameter) applied on top of the depth flags */
+	FFieldSelection Fields;
+
 	/** Default constructor */
 	FQueryOptions() = default;
 
 	/**
 	 * Parse query options from URL query string
 	 * @param QueryString URL query parameters (e.g., "depth=full&properties=true")
+	 * @param Defaults Options used for parameters the query string does not set
 	 * @return Parsed query options
 	 */
-	static FQueryOptions ParseFromQueryString(const FString& QueryString);
+	static FQueryOptions ParseFromQueryString(const FString& QueryString, const FQueryOptions& Defaults = FQueryOptions());
+
+	/**
+	 * Parse query options from parsed URL query parameters
+	 * @param QueryParams Request query parameters
+	 * @param Defaults Options used for parameters the request does not set
+	 * @return Parsed query options
+	 */
+	static FQueryOptions ParseFromQueryParams(const TMap<FString, FString>& QueryParams, const FQueryOptions& Defaults = FQueryOptions());
 
 	/**
 	 * Apply depth level preset
 	 * @param Depth The depth level to apply
 	 */
 	void ApplyDepthLevel(EQueryDepth Depth);
+
+	/** Compact string identifying these options, for response cache keys */
+	FString GetCacheKey() const;
 };
 
+
+/**
+ * Cursor pagination for list endpoints
+ * Parsed from the "limit" and "cursor" URL query parameters. Lists are ordered by a stable key
+ * (object path), and the cursor encodes the key of the last item of the previous page, so pages
+ * stay consistent while assets are added or removed between requests.
+ */
+struct FPageOptions
+{
+	/** Maximum number of items in the page */
+	int32 Limit = 100;
+
+	/** Key of the last item of the previous page (empty for the first page) */
+	FString AfterKey;
+
+	/**
+	 * Parse page options from URL query parameters
+	 * @param QueryParams Request query parameters
+	 * @param MaxLimit Largest page size the endpoint allows
+	 * @param OutOptions Parsed page options
+	 * @param OutError Reason the options were rejected
+	 * @return True if the parameters were valid
+	 */
+	static bool ParseFromQueryParams(const TMap<FString, FString>& QueryParams, int32 MaxLimit, FPageOptions& OutOptions, FString& OutError);
+
+	/**
+	 * Pick the page out of a list
+	 * @param Keys Stable key of every item in the list (any order)
+	 * @param bOutHasMore Whether items remain after the page
+	 * @return Indices into Keys of the page's items, in key order
+	 */
+	TArray<int32> SelectPage(const TArray<FString>& Keys, bool& bOutHasMore) const;
+
+	/** Encode an item key as a URL-safe cursor */
+	static FString EncodeCursor(const FString& Key);
+
+	/** Decode a cursor back to its item key */
+	static bool DecodeCursor(const FString& Cursor, FString& OutKey);
+};
@@ -32,14 +32,46 @@ public:
 	UPROPERTY(config, EditAnywhere, Category="Server")
 	bool bEnableLogging = true;
 
+	/** Requests accepted at once; further requests get 503 until one finishes */
+	UPROPERTY(config, EditAnywhere, Category="Server", meta=(ClampMin=1, ClampMax=1024))
+	int32 MaxConcurrentRequests = 32;
+
+	/** Change feed polls allowed to wait at once; they don't count against MaxConcurrentRequests while waiting */
+	UPROPERTY(config, EditAnywhere, Category="Server", meta=(ClampMin=1, ClampMax=4096))
+	int32 MaxWaitingPolls = 64;
+
+	/** Game thread time per tick spent running request handlers (at least one handler runs per tick) */
+	UPROPERTY(config, EditAnywhere, Category="Server", meta=(ClampMin=0.5, ClampMax=100.0, Units="Milliseconds"))
+	float GameThreadBudgetMs = 4.0f;
+
+	/** Responses at least this many bytes are gzip-compressed for clients that accept it (0 disables compression) */
+	UPROPERTY(config, EditAnywhere, Category="Server", meta=(ClampMin=0))
+	int32 ResponseCompressionThreshold = 8192;
+
 	/** Default query depth level */
 	UPROPERTY(config, EditAnywhere, Category="Query")
 	EQueryDepth DefaultQueryDepth = EQueryDepth::Standard;
 
-	/** Maximum number of actors to return per level query */
+	/** Maximum number of actors to return per page of a level query */
 	UPROPERTY(config, EditAnywhere, Category="Query", meta=(ClampMin=1, ClampMax=10000))
 	int32 MaxActorsPerQuery = 1000;
 
+	/** Page size of list queries when the request does not pass a limit */
+	UPROPERTY(config, EditAnywhere, Category="Query", meta=(ClampMin=1, ClampMax=10000))
+	int32 DefaultPageSize = 100;
+
+	/** Largest page size a list query may request */
+	UPROPERTY(config, EditAnywhere, Category="Query", meta=(ClampMin=1, ClampMax=10000))
+	int32 MaxPageSize = 1000;
+
+	/** Cache serialized blueprint query responses until the blueprint's package changes */
+	UPROPERTY(config, EditAnywhere, Category="Query")
+	bool bEnableResponseCache = true;
+
+	/** Maximum number of cached query responses */
+	UPROPERTY(config, EditAnywhere, Category="Query", meta=(ClampMin=1, ClampMax=10000, EditCondition="bEnableResponseCache"))
+	int32 ResponseCacheMaxEntries = 256;
+
 	/** Enable automatic backups before edits */
 	UPROPERTY(config, EditAnywhere, Category="Safety")
 	bool bAutoBackup = true;
@@ -48,6 +80,10 @@ public:
 	UPROPERTY(config, EditAnywhere, Category="Safety", meta=(ClampMin=1, ClampMax=90))
 	int32 BackupRetentionDays = 7;
 
+	/** Memory for in-memory undo/redo of property edits; the oldest transactions stop being undoable past it */
+	UPROPERTY(config, EditAnywhere, Category="Safety", meta=(ClampMin=1, ClampMax=1024, Units="Megabytes"))
+	int32 UndoMemoryBudgetMB = 16;
+
 	/** Require confirmation for all edit operations */
 	UPROPERTY(config, EditAnywhere, Category="Safety")
 	bool bRequireConfirmation = true;
@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AliasTable.h"
+
+void FAliasTable::Build(TConstArrayView<float> Weights)
+{
+	Reset();
+
+	double TotalWeight = 0.0;
+	for (float Weight : Weights) TotalWeight += FMath::Max(Weight, 0.0f);
+	if (TotalWeight <= 0.0) return;
+
+	const int32 Num = Weights.Num();
+	Probability.SetNumUninitialized(Num);
+	Alias.SetNumUninitialized(Num);
+
+	// Scale so the average column holds exactly 1, then pair each under-full column with an over-full one
+	TArray<double, TInlineAllocator<32>> Scaled;
+	TArray<int32, TInlineAllocator<32>> Small;
+	TArray<int32, TInlineAllocator<32>> Large;
+	Scaled.SetNumUninitialized(Num);
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		Scaled[Index] = FMath::Max(Weights[Index], 0.0f) * Num / TotalWeight;
+		(Scaled[Index] < 1.0 ? Small : Large).Add(Index);
+	}
+
+	while (Small.Num() > 0 && Large.Num() > 0)
+	{
+		const int32 Less = Small.Pop(EAllowShrinking::No);
+		const int32 More = Large.Pop(EAllowShrinking::No);
+		Probability[Less] = static_cast<float>(Scaled[Less]);
+		Alias[Less] = More;
+		Scaled[More] = (Scaled[More] + Scaled[Less]) - 1.0;
+		(Scaled[More] < 1.0 ? Small : Large).Add(More);
+	}
+
+	// Whatever is left is full up to rounding error
+	for (int32 Index : Large) { Probability[Index] = 1.0f; Alias[Index] = Index; }
+	for (int32 Index : Small) { Probability[Index] = 1.0f; Alias[Index] = Index; }
+}
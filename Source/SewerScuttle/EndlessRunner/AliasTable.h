@@ -0,0 +1,37 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "KeyedRandom.h"
+
+/**
+ * Vose alias table over a set of weights: built in O(n), then samples an index in O(1).
+ * Indices with a zero or negative weight are never picked.
+ */
+struct SEWERSCUTTLE_API FAliasTable
+{
+	/** Build from weights (leaves the table empty if no weight is positive) */
+	void Build(TConstArrayView<float> Weights);
+
+	/** Empty the table */
+	void Reset() { Probability.Reset(); Alias.Reset(); }
+
+	/** True if there is nothing to sample */
+	bool IsEmpty() const { return Probability.Num() == 0; }
+
+	/** Pick an index with probability proportional to its weight (INDEX_NONE if empty) */
+	int32 Sample(FKeyedRandom& Random) const
+	{
+		if (IsEmpty()) return INDEX_NONE;
+		const int32 Column = Random.RandRange(0, Probability.Num() - 1);
+		return Random.FRand() < Probability[Column] ? Column : Alias[Column];
+	}
+
+private:
+	/** Chance of keeping each column's own index */
+	TArray<float> Probability;
+
+	/** Index each column falls back to */
+	TArray<int32> Alias;
+};
@@ -0,0 +1,141 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BootPipeline.h"
+#include "CoreGlobals.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(SewerScuttleBoot, true);
+
+const FName UBootPipeline::MenuFirstFrameMilestone(TEXT("MenuFirstFrame"));
+const FName UBootPipeline::SeedWaitSpan(TEXT("SeedWait"));
+const FName UBootPipeline::RunFirstFrameSpan(TEXT("RunFirstFrame"));
+
+void UBootPipeline::AddTask(FName Name, const TArray<FName>& DependsOn, FBootTask Task)
+{
+	if (bStarted || Tasks.Contains(Name))
+	{
+		UE_LOG(LogTemp, Error, TEXT("BootPipeline: Cannot add task %s (already started or duplicate)"), *Name.ToString());
+		return;
+	}
+
+	FTaskEntry& Entry = Tasks.Add(Name);
+	Entry.DependsOn = DependsOn;
+	Entry.Task = MoveTemp(Task);
+	TaskOrder.Add(Name);
+}
+
+void UBootPipeline::Start()
+{
+	if (bStarted) return;
+	bStarted = true;
+	StartTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogTemp, Log, TEXT("BootTimeline: Boot started %.1fms after process start"), (StartTime - GStartTime) * 1000.0);
+
+	for (const FName& Name : TaskOrder)
+	{
+		TryStartTask(Name);
+	}
+}
+
+bool UBootPipeline::IsTaskComplete(FName Name) const
+{
+	const FTaskEntry* Entry = Tasks.Find(Name);
+	return Entry && Entry->bComplete;
+}
+
+void UBootPipeline::TryStartTask(FName Name)
+{
+	FTaskEntry* Entry = Tasks.Find(Name);
+	if (!Entry || Entry->bStarted) return;
+
+	for (const FName& Dependency : Entry->DependsOn)
+	{
+		if (!IsTaskComplete(Dependency)) return;
+	}
+
+	Entry->bStarted = true;
+	Entry->StartedAt = FPlatformTime::Seconds();
+
+	// Copy out: the task may complete synchronously and start others before returning
+	FBootTask Task = Entry->Task;
+	Task(FSimpleDelegate::CreateWeakLambda(this, [this, Name]() { CompleteTask(Name); }));
+}
+
+void UBootPipeline::CompleteTask(FName Name)
+{
+	FTaskEntry* Entry = Tasks.Find(Name);
+	if (!Entry || Entry->bComplete) return;
+
+	Entry->bComplete = true;
+	CompletedCount++;
+	MarkMilestone(Name);
+
+	UE_LOG(LogTemp, Log, TEXT("BootTimeline: %s took %.1fms (done at %.1fms)"),
+		*Name.ToString(), (FPlatformTime::Seconds() - Entry->StartedAt) * 1000.0, GetMilestoneMs(Name));
+
+	for (const FName& Other : TaskOrder)
+	{
+		TryStartTask(Other);
+	}
+
+	if (IsComplete())
+	{
+		LogTimeline();
+	}
+}
+
+void UBootPipeline::MarkMilestone(FName Name)
+{
+	if (!bStarted || GetMilestoneMs(Name) >= 0.0) return;
+	Milestones.Emplace(Name, FPlatformTime::Seconds() - StartTime);
+}
+
+double UBootPipeline::GetMilestoneMs(FName Name) const
+{
+	for (const TPair<FName, double>& Milestone : Milestones)
+	{
+		if (Milestone.Key == Name) return Milestone.Value * 1000.0;
+	}
+	return -1.0;
+}
+
+void UBootPipeline::MarkMenuFirstFrame()
+{
+	if (GetMilestoneMs(MenuFirstFrameMilestone) >= 0.0) return;
+	MarkMilestone(MenuFirstFrameMilestone);
+
+	const double TimeToMenuMs = GetMilestoneMs(MenuFirstFrameMilestone);
+	CSV_CUSTOM_STAT(SewerScuttleBoot, TimeToMenuMs, TimeToMenuMs, ECsvCustomStatOp::Set);
+	UE_LOG(LogTemp, Log, TEXT("BootTimeline: time_to_menu_ms=%.1f (%.1fms since process start)"),
+		TimeToMenuMs, (FPlatformTime::Seconds() - GStartTime) * 1000.0);
+}
+
+void UBootPipeline::BeginSpan(FName Name)
+{
+	ActiveSpans.Add(Name, FPlatformTime::Seconds());
+}
+
+void UBootPipeline::EndSpan(FName Name)
+{
+	double SpanStart = 0.0;
+	if (!ActiveSpans.RemoveAndCopyValue(Name, SpanStart)) return;
+
+	const double SpanMs = (FPlatformTime::Seconds() - SpanStart) * 1000.0;
+	MarkMilestone(Name);
+
+#if CSV_PROFILER
+	FCsvProfiler::RecordCustomStat(FName(*FString::Printf(TEXT("%sMs"), *Name.ToString())), CSV_CATEGORY_INDEX(SewerScuttleBoot), SpanMs, ECsvCustomStatOp::Set);
+#endif
+	UE_LOG(LogTemp, Log, TEXT("BootTimeline: %s_ms=%.1f"), *Name.ToString(), SpanMs);
+}
+
+void UBootPipeline::LogTimeline() const
+{
+	FString Timeline;
+	for (const TPair<FName, double>& Milestone : Milestones)
+	{
+		Timeline += FString::Printf(TEXT(" %s=%.1f"), *Milestone.Key.ToString(), Milestone.Value * 1000.0);
+	}
+	UE_LOG(LogTemp, Log, TEXT("BootTimeline: %d/%d tasks complete, ms since boot:%s"), CompletedCount, Tasks.Num(), *Timeline);
+}
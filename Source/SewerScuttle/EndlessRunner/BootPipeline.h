@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "BootPipeline.generated.h"
+
+/**
+ * Runs the startup tasks (content, input, identity, HTTP warm-up, speculative seed) as a small
+ * dependency graph: every task starts as soon as the tasks it depends on have finished, so
+ * independent work overlaps instead of running back to back.
+ * Also records the startup timeline (per-task completion, time-to-menu, and timed spans such as
+ * time-to-first-frame-of-run), logged as "BootTimeline:" lines and published as CSV profiler stats.
+ */
+UCLASS()
+class SEWERSCUTTLE_API UBootPipeline : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Task body: start the work (sync or async) and execute Done exactly once when it has finished */
+	using FBootTask = TFunction<void(FSimpleDelegate Done)>;
+
+	/** Register a task; must be called before Start */
+	void AddTask(FName Name, const TArray<FName>& DependsOn, FBootTask Task);
+
+	/** Start every task whose dependencies are already met */
+	void Start();
+
+	/** Check if a task has finished */
+	bool IsTaskComplete(FName Name) const;
+
+	/** Check if every registered task has finished */
+	bool IsComplete() const { return Tasks.Num() > 0 && CompletedCount == Tasks.Num(); }
+
+	/** Record a named point on the timeline (only the first occurrence is kept) */
+	void MarkMilestone(FName Name);
+
+	/** Milliseconds from Start to a milestone, or -1 if it hasn't been reached */
+	double GetMilestoneMs(FName Name) const;
+
+	/** Record the first frame the menu was on screen */
+	void MarkMenuFirstFrame();
+
+	/** Start timing a span (restarts it if already running) */
+	void BeginSpan(FName Name);
+
+	/** Finish a running span: logs "<Name>_ms", publishes it as a CSV stat and marks its first occurrence as a milestone */
+	void EndSpan(FName Name);
+
+	/** Check if a span is running */
+	bool IsSpanActive(FName Name) const { return ActiveSpans.Contains(Name); }
+
+	/** Log every milestone in the order reached */
+	void LogTimeline() const;
+
+	static const FName MenuFirstFrameMilestone;
+
+	/** Play pressed -> track choices on screen (seed round trip, hidden by the speculative seed) */
+	static const FName SeedWaitSpan;
+
+	/** First track picked -> first frame of gameplay (sequence generation and content streaming) */
+	static const FName RunFirstFrameSpan;
+
+private:
+	struct FTaskEntry
+	{
+		TArray<FName> DependsOn;
+		FBootTask Task;
+		double StartedAt = 0.0;
+		bool bStarted = false;
+		bool bComplete = false;
+	};
+
+	/** Start the task if all of its dependencies have finished */
+	void TryStartTask(FName Name);
+
+	/** Done callback for a task */
+	void CompleteTask(FName Name);
+
+	TMap<FName, FTaskEntry> Tasks;
+
+	/** Registration order, so ready tasks start deterministically */
+	TArray<FName> TaskOrder;
+
+	/** Milestones in the order they were reached (seconds since Start) */
+	TArray<TPair<FName, double>> Milestones;
+
+	int32 CompletedCount = 0;
+	double StartTime = 0.0;
+
+	/** Running spans and when they began */
+	TMap<FName, double> ActiveSpans;
+
+	bool bStarted = false;
+};
@@ -0,0 +1,217 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoinField.h"
+#include "CollectibleCoin.h"
+#include "EndlessRunnerGameMode.h"
+#include "LaneCollisionResolver.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+
+ACoinField::ACoinField()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	RootSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootSceneComponent"));
+	RootComponent = RootSceneComponent;
+	RootSceneComponent->SetMobility(EComponentMobility::Movable);
+}
+
+void ACoinField::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		for (FCoinFieldItem& Item : Items)
+		{
+			Resolver->Unregister(Item.LaneRecordId);
+			Item.LaneRecordId = INDEX_NONE;
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+int32 ACoinField::GetOrCreateBatch(TSubclassOf<ACollectibleCoin> CoinClass)
+{
+	if (const int32* Existing = BatchByClass.Find(CoinClass.Get()))
+	{
+		return *Existing;
+	}
+
+	// Draw with whatever the coin class's default object was set up with (mesh, materials, mesh offset)
+	const ACollectibleCoin* CoinDefaults = CoinClass->GetDefaultObject<ACollectibleCoin>();
+	const UStaticMeshComponent* CoinMesh = CoinDefaults->GetMeshComponent();
+
+	UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(this);
+	Instances->SetupAttachment(RootSceneComponent);
+	Instances->SetMobility(EComponentMobility::Movable);
+	Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Instances->SetGenerateOverlapEvents(false);
+	Instances->SetCanEverAffectNavigation(false);
+	if (CoinMesh)
+	{
+		Instances->SetStaticMesh(CoinMesh->GetStaticMesh());
+		for (int32 MaterialIndex = 0; MaterialIndex < CoinMesh->GetNumOverrideMaterials(); ++MaterialIndex)
+		{
+			Instances->SetMaterial(MaterialIndex, CoinMesh->OverrideMaterials[MaterialIndex]);
+		}
+		Instances->SetCastShadow(CoinMesh->CastShadow);
+	}
+	Instances->RegisterComponent();
+
+	FCoinBatch Batch;
+	Batch.MeshOffset = CoinMesh ? CoinMesh->GetRelativeTransform() : FTransform::Identity;
+	const USphereComponent* Sphere = CoinDefaults->GetCollisionSphere();
+	const float Radius = Sphere ? Sphere->GetScaledSphereRadius() : 50.0f;
+	Batch.PickupExtent = FVector(Radius, Radius, Radius + BobAmplitude);
+	if (const UParticleSystemComponent* Effect = CoinDefaults->GetCollectionEffect())
+	{
+		Batch.CollectionEffect = Effect->Template;
+	}
+
+	const int32 BatchIndex = Batches.Add(Batch);
+	BatchComponents.Add(Instances);
+	BatchByClass.Add(CoinClass.Get(), BatchIndex);
+	return BatchIndex;
+}
+
+int32 ACoinField::AddCoin(TSubclassOf<ACollectibleCoin> CoinClass, const FVector& Location, int32 Value)
+{
+	if (!CoinClass) return INDEX_NONE;
+
+	const ACollectibleCoin* CoinDefaults = CoinClass->GetDefaultObject<ACollectibleCoin>();
+	const int32 BatchIndex = GetOrCreateBatch(CoinClass);
+	FCoinBatch& Batch = Batches[BatchIndex];
+
+	const int32 ItemIndex = Items.AddDefaulted();
+	FCoinFieldItem& Item = Items[ItemIndex];
+	Item.Location = Location;
+	Item.BatchIndex = BatchIndex;
+	Item.Value = CoinDefaults->bIsSpecial ? FMath::FloorToInt(Value * CoinDefaults->SpecialValueMultiplier) : Value;
+	Item.bMagnetable = CoinDefaults->IsMagnetable();
+	Item.InstanceIndex = BatchComponents[BatchIndex]->AddInstance(Batch.MeshOffset * FTransform(Location), true);
+	Batch.Items.Add(ItemIndex);
+
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		Item.LaneRecordId = Resolver->Register(this, ELaneContentKind::CoinFieldItem, FBox(Location - Batch.PickupExtent, Location + Batch.PickupExtent), ItemIndex);
+	}
+
+	++NumUncollected;
+	SetActorTickEnabled(bAnimateItems);
+	return ItemIndex;
+}
+
+void ACoinField::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bAnimateItems || NumUncollected == 0)
+	{
+		return;
+	}
+
+	// Every coin in the field spins and bobs in phase, so one rotation and offset serves them all
+	const float Time = GetGameTimeSinceCreation();
+	const FQuat Spin(FRotator(0.0f, FMath::Fmod(Time * RotationSpeed, 360.0f), 0.0f));
+	const FVector Bob(0.0f, 0.0f, FMath::Sin(Time * BobSpeed) * BobAmplitude);
+
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); ++BatchIndex)
+	{
+		const FCoinBatch& Batch = Batches[BatchIndex];
+		UInstancedStaticMeshComponent* Instances = BatchComponents[BatchIndex];
+		bool bAnyMoved = false;
+		for (int32 Instance = 0; Instance < Batch.Items.Num(); ++Instance)
+		{
+			// Collected instances stay collapsed, only live ones are rewritten
+			const FCoinFieldItem& Item = Items[Batch.Items[Instance]];
+			if (Item.bCollected) continue;
+
+			Instances->UpdateInstanceTransform(Instance, Batch.MeshOffset * FTransform(Spin, GetItemLocation(Item) + Bob), true, false);
+			bAnyMoved = true;
+		}
+		if (bAnyMoved)
+		{
+			Instances->MarkRenderStateDirty();
+		}
+	}
+}
+
+void ACoinField::CollectItem(int32 ItemIndex)
+{
+	if (!Items.IsValidIndex(ItemIndex) || Items[ItemIndex].bCollected)
+	{
+		return;
+	}
+
+	FCoinFieldItem& Item = Items[ItemIndex];
+	Item.bCollected = true;
+	--NumUncollected;
+
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		Resolver->Unregister(Item.LaneRecordId);
+	}
+	Item.LaneRecordId = INDEX_NONE;
+
+	// Hide the instance by collapsing it (removing would renumber the other instances)
+	BatchComponents[Item.BatchIndex]->UpdateInstanceTransform(Item.InstanceIndex, FTransform(FQuat::Identity, Item.Location, FVector::ZeroVector), true, true);
+
+	if (UParticleSystem* Effect = Batches[Item.BatchIndex].CollectionEffect)
+	{
+		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), Effect, GetItemLocation(Item));
+	}
+
+	// Add to run currency (temporary, resets each game)
+	if (UWorld* World = GetWorld())
+	{
+		if (AEndlessRunnerGameMode* GameMode = Cast<AEndlessRunnerGameMode>(World->GetAuthGameMode()))
+		{
+			GameMode->AddRunCurrency(Item.Value);
+		}
+	}
+
+	if (NumUncollected == 0)
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+void ACoinField::PullMagnetable(const FVector& Location, float Range, float Speed, float DeltaTime)
+{
+	if (NumUncollected == 0) return;
+
+	ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this);
+	const float RangeSquared = Range * Range;
+	for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+	{
+		FCoinFieldItem& Item = Items[ItemIndex];
+		if (Item.bCollected || !Item.bMagnetable) continue;
+
+		const FVector ItemLocation = GetItemLocation(Item);
+		if (FVector::DistSquared(Location, ItemLocation) > RangeSquared) continue;
+
+		const FVector NewLocation = ItemLocation + (Location - ItemLocation).GetSafeNormal() * Speed * DeltaTime;
+		Item.PulledOffset = NewLocation - Item.Location;
+		if (FVector::Dist(Location, NewLocation) <= MagnetCollectDistance)
+		{
+			CollectItem(ItemIndex);
+			continue;
+		}
+
+		const FCoinBatch& Batch = Batches[Item.BatchIndex];
+		if (Resolver)
+		{
+			Resolver->UpdateBounds(Item.LaneRecordId, FBox(NewLocation - Batch.PickupExtent, NewLocation + Batch.PickupExtent));
+		}
+
+		// Tick rewrites animated instances anyway
+		if (!bAnimateItems)
+		{
+			BatchComponents[Item.BatchIndex]->UpdateInstanceTransform(Item.InstanceIndex, Batch.MeshOffset * FTransform(NewLocation), true, true);
+		}
+	}
+}
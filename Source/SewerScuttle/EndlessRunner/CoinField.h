@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "CoinField.generated.h"
+
+class ACollectibleCoin;
+class UInstancedStaticMeshComponent;
+class UParticleSystem;
+
+/**
+ * All plain coins spawned on one track piece, drawn through instanced static mesh components (one per coin class)
+ * Replaces a coin actor with its own mesh, sphere and tick per coin: pickup is resolved by the lane collision
+ * resolver, collecting a coin hides its instance and the spin/bob is written to the uncollected instances each frame
+ * (or done by the material, see bAnimateItems).
+ */
+UCLASS()
+class SEWERSCUTTLE_API ACoinField : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ACoinField();
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaTime) override;
+
+	/** Add a coin at a world location, drawn and valued like CoinClass. Returns the item index */
+	int32 AddCoin(TSubclassOf<ACollectibleCoin> CoinClass, const FVector& Location, int32 Value);
+
+	/** Collect a specific item by index (hides its instance) */
+	UFUNCTION(BlueprintCallable, Category = "!Coin")
+	void CollectItem(int32 ItemIndex);
+
+	/**
+	 * Pull magnetable items within Range of Location toward it at Speed, collecting those that get within
+	 * MagnetCollectDistance (for magnet system, same as ACollectibleCoin)
+	 */
+	void PullMagnetable(const FVector& Location, float Range, float Speed, float DeltaTime);
+
+	/** Distance from the magnet at which a pulled item is collected */
+	static constexpr float MagnetCollectDistance = 20.0f;
+
+	/** Get number of uncollected items */
+	UFUNCTION(BlueprintPure, Category = "!Coin")
+	int32 GetUncollectedCount() const { return NumUncollected; }
+
+protected:
+	/** Root scene component */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	USceneComponent* RootSceneComponent;
+
+	/** Rotation speed for items */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation", meta = (ClampMin = "0.0", ClampMax = "360.0"))
+	float RotationSpeed = 90.0f;
+
+	/** Bobbing speed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation", meta = (ClampMin = "0.0", ClampMax = "10.0"))
+	float BobSpeed = 2.0f;
+
+	/** Bobbing amplitude */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation", meta = (ClampMin = "0.0", ClampMax = "100.0"))
+	float BobAmplitude = 20.0f;
+
+	/** Whether to animate items on the CPU (turn off when the coin material spins/bobs through world position offset) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
+	bool bAnimateItems = true;
+
+	/** Instanced components, one per coin class */
+	UPROPERTY()
+	TArray<UInstancedStaticMeshComponent*> BatchComponents;
+
+private:
+	struct FCoinFieldItem
+	{
+		FVector Location = FVector::ZeroVector;
+
+		/** How far the magnet has pulled the item from Location */
+		FVector PulledOffset = FVector::ZeroVector;
+
+		int32 BatchIndex = INDEX_NONE;
+		int32 InstanceIndex = INDEX_NONE;
+		int32 Value = 1;
+		bool bMagnetable = true;
+		bool bCollected = false;
+		int32 LaneRecordId = INDEX_NONE;
+	};
+
+	/** Per coin class data, parallel to BatchComponents */
+	struct FCoinBatch
+	{
+		/** Coin mesh transform relative to the coin actor */
+		FTransform MeshOffset;
+
+		/** Effect the coin class plays on collection */
+		UParticleSystem* CollectionEffect = nullptr;
+
+		/** Half size of the pickup box (the coin class's sphere, grown in Z to cover the bob) */
+		FVector PickupExtent = FVector::ZeroVector;
+
+		/** Item index of each instance */
+		TArray<int32> Items;
+	};
+
+	/** Current location of an item, including the magnet pull */
+	static FVector GetItemLocation(const FCoinFieldItem& Item) { return Item.Location + Item.PulledOffset; }
+
+	/** Find or create the batch drawing a coin class */
+	int32 GetOrCreateBatch(TSubclassOf<ACollectibleCoin> CoinClass);
+
+	TArray<FCoinFieldItem> Items;
+	TArray<FCoinBatch> Batches;
+	TMap<UClass*, int32> BatchByClass;
+	int32 NumUncollected = 0;
+};
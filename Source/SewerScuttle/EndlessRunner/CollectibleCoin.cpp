@@ -8,6 +8,7 @@
 #include "GameFramework/Character.h"
 #include "RabbitCharacter.h"
 #include "EndlessRunnerGameMode.h"
+#include "LaneCollisionResolver.h"
 
 ACollectibleCoin::ACollectibleCoin()
 {
@@ -17,10 +18,9 @@ ACollectibleCoin::ACollectibleCoin()
 	CollisionSphere = CreateDefaultSubobject<USphereComponent>(TEXT("CollisionSphere"));
 	RootComponent = CollisionSphere;
 	CollisionSphere->SetSphereRadius(50.0f);
-	CollisionSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	CollisionSphere->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
-	CollisionSphere->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
-	CollisionSphere->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
+	// Shape only - pickup is resolved by the lane collision resolver
+	CollisionSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	CollisionSphere->SetGenerateOverlapEvents(false);
 
 	// Create mesh component
 	MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent"));
@@ -37,11 +37,40 @@ void ACollectibleCoin::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Set up overlap event
-	CollisionSphere->OnComponentBeginOverlap.AddDynamic(this, &ACollectibleCoin::OnOverlapBegin);
-
 	// Store initial Z position
 	InitialZ = GetActorLocation().Z;
+
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		LaneRecordId = Resolver->Register(this, ELaneContentKind::Coin, GetLaneBounds());
+	}
+}
+
+void ACollectibleCoin::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		Resolver->Unregister(LaneRecordId);
+	}
+	LaneRecordId = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+FBox ACollectibleCoin::GetLaneBounds() const
+{
+	FVector Center = GetActorLocation();
+	Center.Z = InitialZ;
+	const float Radius = CollisionSphere ? CollisionSphere->GetScaledSphereRadius() : 50.0f;
+	return FBox(Center - FVector(Radius, Radius, Radius + BobAmplitude), Center + FVector(Radius, Radius, Radius + BobAmplitude));
+}
+
+void ACollectibleCoin::UpdateLaneRecord()
+{
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		Resolver->UpdateBounds(LaneRecordId, GetLaneBounds());
+	}
 }
 
 void ACollectibleCoin::Tick(float DeltaTime)
@@ -65,57 +94,26 @@ void ACollectibleCoin::Tick(float DeltaTime)
 	SetActorLocation(Location);
 }
 
-void ACollectibleCoin::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
-{
-	// Early exit if already collected (prevents multiple overlap calls)
-	// Check this FIRST before any other processing
-	if (bCollected)
-	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("CollectibleCoin: Ignoring overlap - already collected (Actor: %s)"), *GetName());
-		return;
-	}
-
-	ARabbitCharacter* Player = Cast<ARabbitCharacter>(OtherActor);
-	if (!Player)
-	{
-		return;
-	}
-
-	// Only respond to the player's capsule component to prevent multiple overlap events
-	// The character's capsule is the main collision component
-	if (OtherComp != Player->GetCapsuleComponent())
-	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("CollectibleCoin: Ignoring overlap - not capsule component (Component: %s, Actor: %s)"), *OtherComp->GetName(), *GetName());
-		return;
-	}
-
-	// Disable collision IMMEDIATELY to prevent multiple overlap events
-	// This must happen before Collect() to prevent race conditions
-	if (CollisionSphere)
-	{
-		CollisionSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		// Also remove the overlap delegate to be extra safe
-		CollisionSphere->OnComponentBeginOverlap.RemoveAll(this);
-	}
-	
-	UE_LOG(LogTemp, Log, TEXT("CollectibleCoin: Collecting coin (Value: %d, Actor: %s)"), Value, *GetName());
-	Collect();
-}
-
 void ACollectibleCoin::Collect()
 {
 	// Early exit if already collected (prevents double collection)
-	// Note: bCollected should already be set in OnOverlapBegin, but check again for safety
+	// Note: the lane collision resolver skips collected coins, but check again for safety
 	// This protects against Blueprint calls or other code paths
 	if (bCollected)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("CollectibleCoin: Collect() called but already collected! (Actor: %s) - This should not happen if called from OnOverlapBegin"), *GetName());
+		UE_LOG(LogTemp, Warning, TEXT("CollectibleCoin: Collect() called but already collected! (Actor: %s) - This should not happen if called from the lane collision resolver"), *GetName());
 		return;
 	}
 
-	// Set collected flag (should already be set in OnOverlapBegin, but ensure it for Blueprint calls)
+	// Set collected flag
 	bCollected = true;
 
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		Resolver->Unregister(LaneRecordId);
+	}
+	LaneRecordId = INDEX_NONE;
+
 	// Play collection effect
 	if (CollectionEffect)
 	{
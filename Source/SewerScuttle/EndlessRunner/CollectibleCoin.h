@@ -24,6 +24,7 @@ public:
 	ACollectibleCoin();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Get coin value */
 	UFUNCTION(BlueprintPure, Category = "!Coin")
@@ -48,6 +49,15 @@ public:
 	/** Get collision sphere component (for magnet system) */
 	USphereComponent* GetCollisionSphere() const { return CollisionSphere; }
 
+	/** Get mesh component (coin fields draw the class default's mesh) */
+	UStaticMeshComponent* GetMeshComponent() const { return MeshComponent; }
+
+	/** Get collection effect component */
+	UParticleSystemComponent* GetCollectionEffect() const { return CollectionEffect; }
+
+	/** Move the coin's lane collision record to where the coin is now (after the magnet moved it) */
+	void UpdateLaneRecord();
+
 protected:
 	/** Collision sphere */
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Components")
@@ -98,10 +108,13 @@ protected:
 	/** Initial Z position */
 	float InitialZ = 0.0f;
 
-	/** Handle overlap */
-	UFUNCTION()
-	void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
 	virtual void Tick(float DeltaTime) override;
+
+private:
+	/** Pickup bounds around the sphere at InitialZ, covering the bob */
+	FBox GetLaneBounds() const;
+
+	/** Record in the lane collision resolver */
+	int32 LaneRecordId = INDEX_NONE;
 };
 
@@ -7,8 +7,22 @@ UConfigManager* UConfigManager::Get()
 	return GetMutableDefault<UConfigManager>();
 }
 
+bool UConfigManager::UseMockBackend() const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return bUseMockBackend || FParse::Param(FCommandLine::Get(), TEXT("MockBackend"));
+#endif
+}
+
 FString UConfigManager::GetApiBaseUrl() const
 {
+	if (UseMockBackend())
+	{
+		return FString::Printf(TEXT("http://localhost:%d/api"), MockBackendPort);
+	}
+
 	FString Base = bUseDevEnvironment ? ApiBaseUrlDev : ApiBaseUrlProd;
 	
 	// Remove any existing protocol if user included it
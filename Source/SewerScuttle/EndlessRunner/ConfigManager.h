@@ -27,6 +27,20 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Config")
 	FString GetDevDeviceId() const { return DevDeviceId; }
 
+	UFUNCTION(BlueprintPure, Category = "Config")
+	FString GetContentVersion() const { return ContentVersion; }
+
+	UFUNCTION(BlueprintPure, Category = "Config")
+	bool UseLocalTrackGeneration() const { return bUseLocalTrackGeneration; }
+
+	UFUNCTION(BlueprintPure, Category = "Config")
+	bool UseMockBackend() const;
+
+	int32 GetMockBackendPort() const { return MockBackendPort; }
+	int32 GetMockLatencyMs() const { return MockLatencyMs; }
+	int32 GetMockJitterMs() const { return MockJitterMs; }
+	float GetMockFailureRate() const { return MockFailureRate; }
+
 private:
 	UPROPERTY(Config, EditAnywhere, Category = "Environment")
 	FString ApiBaseUrlDev = TEXT("backend.test/api");
@@ -37,6 +51,17 @@ private:
 	UPROPERTY(Config, EditAnywhere, Category = "Environment")
 	bool bUseDevEnvironment = true;
 
+	/** Version stamped on exported content (must match the backend's imported content version) */
+	UPROPERTY(Config, EditAnywhere, Category = "Content")
+	FString ContentVersion = TEXT("1.0.0");
+
+	/**
+	 * Generate tracks, shops and boss rewards on the client once the server has issued the run seed.
+	 * Only used when the server's content_version matches ContentVersion; otherwise the server is asked.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Content")
+	bool bUseLocalTrackGeneration = true;
+
 	/** 
 	 * Developer Auth Token override for testing in Editor.
 	 * If set, this token will be used for all API requests when playing in the Editor.
@@ -50,5 +75,27 @@ private:
 	 */
 	UPROPERTY(Config, EditAnywhere, Category = "Development", meta = (ConfigRestartRequired = false))
 	FString DevDeviceId;
+
+	/**
+	 * Route all API requests to the in-process mock backend (non-shipping builds only).
+	 * Also enabled by -MockBackend on the command line.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Mock Backend")
+	bool bUseMockBackend = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Mock Backend", meta = (ClampMin = 1024, ClampMax = 65535))
+	int32 MockBackendPort = 8090;
+
+	/** Base delay added to every mock response */
+	UPROPERTY(Config, EditAnywhere, Category = "Mock Backend", meta = (ClampMin = 0, Units = "ms"))
+	int32 MockLatencyMs = 0;
+
+	/** Random +/- delay on top of MockLatencyMs */
+	UPROPERTY(Config, EditAnywhere, Category = "Mock Backend", meta = (ClampMin = 0, Units = "ms"))
+	int32 MockJitterMs = 0;
+
+	/** Fraction of requests answered with HTTP 503 */
+	UPROPERTY(Config, EditAnywhere, Category = "Mock Backend", meta = (ClampMin = 0.0, ClampMax = 1.0))
+	float MockFailureRate = 0.0f;
 };
 
@@ -8,121 +8,341 @@
 #include "ShopItemDefinition.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
-void UContentRegistry::GatherContent()
+const FName UContentRegistry::AllBundleName(TEXT("All"));
+
+namespace
 {
-	TrackPieces.Empty();
-	Obstacles.Empty();
-	PowerUps.Empty();
-	Collectibles.Empty();
-	ShopItems.Empty();
+	/** Bundle that definitions loaded through the synchronous fallback are parked in, until a bundle containing them streams in */
+	const FName FallbackBundleName(TEXT("Fallback"));
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+	/** How many package dependency levels LoadBundleAsync walks (definition -> actor class -> meshes/effects) */
+	constexpr int32 BundleDependencyDepth = 2;
 
-	TArray<FAssetData> AssetDataList;
-	
-	// Gather Track Pieces
-	AssetRegistry.GetAssetsByClass(UTrackPieceDefinition::StaticClass()->GetClassPathName(), AssetDataList);
-	for (const FAssetData& AssetData : AssetDataList)
+	/** Fill Resident with the loaded definitions from Assets that a live bundle holds, preserving scan order */
+	template<typename T>
+	void CollectLoaded(const TArray<FAssetData>& Assets, const TSet<FSoftObjectPath>& Held, TArray<T*>& Resident)
 	{
-		if (UTrackPieceDefinition* Def = Cast<UTrackPieceDefinition>(AssetData.GetAsset()))
+		Resident.Reset();
+		for (const FAssetData& AssetData : Assets)
 		{
-			TrackPieces.Add(Def);
+			if (!Held.Contains(AssetData.GetSoftObjectPath())) continue;
+			if (T* Def = Cast<T>(AssetData.FastGetAsset(false))) Resident.Add(Def);
 		}
 	}
-	AssetDataList.Empty();
+}
+
+void UContentRegistry::GatherContent()
+{
+	ScanContent();
 
-	// Gather Obstacles
-	AssetRegistry.GetAssetsByClass(UObstacleDefinition::StaticClass()->GetClassPathName(), AssetDataList);
-	for (const FAssetData& AssetData : AssetDataList)
+	FContentBundle& Bundle = Bundles.FindOrAdd(AllBundleName);
+	for (const FContentIndex* Index : { &TrackPieceIndex, &ObstacleIndex, &PowerUpIndex, &CollectibleIndex, &ShopItemIndex })
 	{
-		if (UObstacleDefinition* Def = Cast<UObstacleDefinition>(AssetData.GetAsset()))
+		for (const FAssetData& AssetData : Index->Assets)
 		{
-			Obstacles.Add(Def);
+			AssetData.GetAsset();
+			Bundle.DefinitionPaths.Add(AssetData.GetSoftObjectPath());
 		}
 	}
-	AssetDataList.Empty();
+	CollectResident();
 
-	// Gather Power-ups
-	AssetRegistry.GetAssetsByClass(UPowerUpDefinition::StaticClass()->GetClassPathName(), AssetDataList);
-	for (const FAssetData& AssetData : AssetDataList)
+	UE_LOG(LogTemp, Log, TEXT("ContentRegistry: Gathered %d track pieces, %d obstacles, %d power-ups, %d collectibles, %d shop items"),
+		TrackPieces.Num(), Obstacles.Num(), PowerUps.Num(), Collectibles.Num(), ShopItems.Num());
+}
+
+void UContentRegistry::ScanContent()
+{
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	auto Scan = [&AssetRegistry](UClass* DefinitionClass, FContentIndex& Index)
 	{
-		if (UPowerUpDefinition* Def = Cast<UPowerUpDefinition>(AssetData.GetAsset()))
+		Index.Reset();
+		AssetRegistry.GetAssetsByClass(DefinitionClass->GetClassPathName(), Index.Assets);
+		for (int32 i = 0; i < Index.Assets.Num(); ++i)
 		{
-			PowerUps.Add(Def);
+			Index.IndexById.Add(Index.Assets[i].AssetName.ToString(), i);
 		}
+	};
+
+	Scan(UTrackPieceDefinition::StaticClass(), TrackPieceIndex);
+	Scan(UObstacleDefinition::StaticClass(), ObstacleIndex);
+	Scan(UPowerUpDefinition::StaticClass(), PowerUpIndex);
+	Scan(UCollectibleDefinition::StaticClass(), CollectibleIndex);
+	Scan(UShopItemDefinition::StaticClass(), ShopItemIndex);
+
+	CollectResident();
+
+	UE_LOG(LogTemp, Log, TEXT("ContentRegistry: Indexed %d track pieces, %d obstacles, %d power-ups, %d collectibles, %d shop items"),
+		TrackPieceIndex.Assets.Num(), ObstacleIndex.Assets.Num(), PowerUpIndex.Assets.Num(), CollectibleIndex.Assets.Num(), ShopItemIndex.Assets.Num());
+}
+
+void UContentRegistry::LoadAllAsync(FSimpleDelegate OnComplete)
+{
+	TArray<FString> ContentIds;
+	for (const FContentIndex* Index : { &TrackPieceIndex, &ObstacleIndex, &PowerUpIndex, &CollectibleIndex, &ShopItemIndex })
+	{
+		for (const TPair<FString, int32>& Pair : Index->IndexById) ContentIds.Add(Pair.Key);
 	}
-	AssetDataList.Empty();
+	LoadDefinitionsAsync(AllBundleName, ContentIds, OnComplete);
+}
 
-	// Gather Collectibles
-	AssetRegistry.GetAssetsByClass(UCollectibleDefinition::StaticClass()->GetClassPathName(), AssetDataList);
-	for (const FAssetData& AssetData : AssetDataList)
+void UContentRegistry::LoadDefinitionsAsync(FName BundleName, const TArray<FString>& ContentIds, FSimpleDelegate OnComplete)
+{
+	TSet<FSoftObjectPath> DefinitionPaths;
+	for (const FString& ContentId : ContentIds)
 	{
-		if (UCollectibleDefinition* Def = Cast<UCollectibleDefinition>(AssetData.GetAsset()))
-		{
-			Collectibles.Add(Def);
-		}
+		if (const FAssetData* AssetData = FindAssetData(ContentId)) DefinitionPaths.Add(AssetData->GetSoftObjectPath());
 	}
-	AssetDataList.Empty();
 
-	// Gather Shop Items
-	AssetDataList.Empty();
-	AssetRegistry.GetAssetsByClass(UShopItemDefinition::StaticClass()->GetClassPathName(), AssetDataList);
-	for (const FAssetData& AssetData : AssetDataList)
+	TArray<FSoftObjectPath> Paths = DefinitionPaths.Array();
+	RequestBundle(BundleName, MoveTemp(DefinitionPaths), MoveTemp(Paths), OnComplete);
+}
+
+void UContentRegistry::LoadBundleAsync(FName BundleName, const TArray<FString>& ContentIds, FSimpleDelegate OnComplete)
+{
+	TSet<FSoftObjectPath> DefinitionPaths;
+	TSet<FSoftObjectPath> AllPaths;
+	TSet<FName> VisitedPackages;
+	for (const FString& ContentId : ContentIds)
 	{
-		if (UShopItemDefinition* Def = Cast<UShopItemDefinition>(AssetData.GetAsset()))
-		{
-			ShopItems.Add(Def);
-		}
+		const FAssetData* AssetData = FindAssetData(ContentId);
+		if (!AssetData) continue;
+
+		DefinitionPaths.Add(AssetData->GetSoftObjectPath());
+		AllPaths.Add(AssetData->GetSoftObjectPath());
+		VisitedPackages.Add(AssetData->PackageName);
+		GatherReferencedAssets(AssetData->PackageName, BundleDependencyDepth, VisitedPackages, AllPaths);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("ContentRegistry: Gathered %d track pieces, %d obstacles, %d power-ups, %d collectibles, %d shop items"),
-		TrackPieces.Num(), Obstacles.Num(), PowerUps.Num(), Collectibles.Num(), ShopItems.Num());
+	RequestBundle(BundleName, MoveTemp(DefinitionPaths), AllPaths.Array(), OnComplete);
 }
 
-UTrackPieceDefinition* UContentRegistry::FindTrackPieceById(const FString& ContentId) const
+void UContentRegistry::GatherReferencedAssets(FName PackageName, int32 Depth, TSet<FName>& VisitedPackages, TSet<FSoftObjectPath>& OutPaths) const
 {
-	for (UTrackPieceDefinition* Def : TrackPieces)
+	if (Depth <= 0) return;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<FName> Dependencies;
+	AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+	for (const FName& Dependency : Dependencies)
 	{
-		if (Def && (Def->GetName() == ContentId || Def->PieceName == ContentId)) return Def;
+		// Engine and plugin content is shared and stays resident anyway
+		if (VisitedPackages.Contains(Dependency) || !Dependency.ToString().StartsWith(TEXT("/Game/"))) continue;
+		VisitedPackages.Add(Dependency);
+
+		TArray<FAssetData> PackageAssets;
+		AssetRegistry.GetAssetsByPackageName(Dependency, PackageAssets);
+		for (const FAssetData& AssetData : PackageAssets) OutPaths.Add(AssetData.GetSoftObjectPath());
+
+		GatherReferencedAssets(Dependency, Depth - 1, VisitedPackages, OutPaths);
 	}
-	return nullptr;
 }
 
-UObstacleDefinition* UContentRegistry::FindObstacleById(const FString& ContentId) const
+void UContentRegistry::RequestBundle(FName BundleName, TSet<FSoftObjectPath>&& DefinitionPaths, TArray<FSoftObjectPath>&& Paths, FSimpleDelegate OnComplete)
 {
-	for (UObstacleDefinition* Def : Obstacles)
+	TSharedPtr<FStreamableHandle> Superseded;
+	if (PendingBundles.RemoveAndCopyValue(BundleName, Superseded) && Superseded.IsValid())
 	{
-		if (Def && (Def->GetName() == ContentId || Def->ObstacleName == ContentId)) return Def;
+		Superseded->CancelHandle();
+	}
+
+	if (Paths.Num() == 0)
+	{
+		FinishBundle(BundleName, nullptr, MoveTemp(DefinitionPaths));
+		OnComplete.ExecuteIfBound();
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	TWeakObjectPtr<UContentRegistry> WeakThis(this);
+	TSharedRef<TSet<FSoftObjectPath>> Definitions = MakeShared<TSet<FSoftObjectPath>>(MoveTemp(DefinitionPaths));
+
+	// Start stalled so the handle is recorded before an already-resident request can complete
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(Paths),
+		FStreamableDelegate::CreateLambda([WeakThis, BundleName, Definitions, OnComplete, StartTime]()
+		{
+			UContentRegistry* Registry = WeakThis.Get();
+			if (!Registry) return;
+
+			TSharedPtr<FStreamableHandle> LoadedHandle;
+			Registry->PendingBundles.RemoveAndCopyValue(BundleName, LoadedHandle);
+			Registry->FinishBundle(BundleName, LoadedHandle, MoveTemp(*Definitions));
+			UE_LOG(LogTemp, Log, TEXT("ContentRegistry: Bundle %s streamed in %.1fms"), *BundleName.ToString(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+			OnComplete.ExecuteIfBound();
+		}),
+		FStreamableManager::DefaultAsyncLoadPriority, false, true, FString::Printf(TEXT("ContentRegistry %s"), *BundleName.ToString()));
+
+	if (Handle.IsValid())
+	{
+		PendingBundles.Add(BundleName, Handle);
+		Handle->StartStalledHandle();
+	}
+	else
+	{
+		OnComplete.ExecuteIfBound();
 	}
-	return nullptr;
 }
 
-UPowerUpDefinition* UContentRegistry::FindPowerUpById(const FString& ContentId) const
+void UContentRegistry::FinishBundle(FName BundleName, TSharedPtr<FStreamableHandle> Handle, TSet<FSoftObjectPath>&& DefinitionPaths)
 {
-	for (UPowerUpDefinition* Def : PowerUps)
+	FContentBundle Bundle;
+	Bundle.DefinitionPaths = MoveTemp(DefinitionPaths);
+	Bundle.Handle = Handle;
+
+	// Getters skip definitions that aren't loaded, so name them here rather than let callers see a silently smaller set
+	for (auto It = Bundle.DefinitionPaths.CreateIterator(); It; ++It)
 	{
-		if (Def && (Def->GetName() == ContentId || Def->PowerUpName == ContentId)) return Def;
+		if (It->ResolveObject()) continue;
+		UE_LOG(LogTemp, Warning, TEXT("ContentRegistry: Bundle %s failed to load definition %s, skipping it"), *BundleName.ToString(), *It->ToString());
+		++Bundle.MissingDefinitions;
+		It.RemoveCurrent();
 	}
-	return nullptr;
+
+	if (Handle.IsValid())
+	{
+		TArray<UObject*> LoadedAssets;
+		Handle->GetLoadedAssets(LoadedAssets);
+		Bundle.AssetCount = LoadedAssets.Num();
+		for (UObject* Asset : LoadedAssets)
+		{
+			if (Asset) Bundle.MemoryBytes += Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ContentRegistry: Bundle %s resident - %d definitions, %d assets, %.2f MB"),
+		*BundleName.ToString(), Bundle.DefinitionPaths.Num(), Bundle.AssetCount, Bundle.MemoryBytes / (1024.0 * 1024.0));
+
+	// Fallback definitions the new bundle streamed in are held by it now (and released with it)
+	if (FContentBundle* Fallback = Bundles.Find(FallbackBundleName))
+	{
+		const int32 NumFallback = Fallback->DefinitionPaths.Num();
+		Fallback->DefinitionPaths = Fallback->DefinitionPaths.Difference(Bundle.DefinitionPaths);
+		if (Fallback->DefinitionPaths.Num() < NumFallback)
+		{
+			UE_LOG(LogTemp, Log, TEXT("ContentRegistry: Bundle %s took over %d synchronously loaded definitions"), *BundleName.ToString(), NumFallback - Fallback->DefinitionPaths.Num());
+		}
+		if (Fallback->DefinitionPaths.Num() == 0)
+		{
+			Bundles.Remove(FallbackBundleName);
+		}
+	}
+
+	// Replacing the old bundle only now means assets shared between the two are never dropped and reloaded
+	Bundles.Add(BundleName, MoveTemp(Bundle));
+	CollectResident();
+}
+
+void UContentRegistry::ReleaseBundle(FName BundleName)
+{
+	TSharedPtr<FStreamableHandle> Pending;
+	if (PendingBundles.RemoveAndCopyValue(BundleName, Pending) && Pending.IsValid())
+	{
+		Pending->CancelHandle();
+	}
+
+	FContentBundle Bundle;
+	if (!Bundles.RemoveAndCopyValue(BundleName, Bundle)) return;
+
+	if (Bundle.Handle.IsValid())
+	{
+		Bundle.Handle->ReleaseHandle();
+	}
+	CollectResident();
+
+	UE_LOG(LogTemp, Log, TEXT("ContentRegistry: Released bundle %s (%d assets, %.2f MB)"), *BundleName.ToString(), Bundle.AssetCount, Bundle.MemoryBytes / (1024.0 * 1024.0));
+}
+
+bool UContentRegistry::IsBundleComplete(FName BundleName) const
+{
+	const FContentBundle* Bundle = Bundles.Find(BundleName);
+	return Bundle && Bundle->MissingDefinitions == 0;
+}
+
+int64 UContentRegistry::GetBundleMemoryBytes(FName BundleName) const
+{
+	const FContentBundle* Bundle = Bundles.Find(BundleName);
+	return Bundle ? Bundle->MemoryBytes : 0;
+}
+
+bool UContentRegistry::IsDefinitionLoaded(const FString& ContentId) const
+{
+	const FAssetData* AssetData = FindAssetData(ContentId);
+	return AssetData && AssetData->IsAssetLoaded();
 }
 
-UCollectibleDefinition* UContentRegistry::FindCollectibleById(const FString& ContentId) const
+const FAssetData* UContentRegistry::FindAssetData(const FString& ContentId) const
 {
-	for (UCollectibleDefinition* Def : Collectibles)
+	for (const FContentIndex* Index : { &TrackPieceIndex, &ObstacleIndex, &PowerUpIndex, &CollectibleIndex, &ShopItemIndex })
 	{
-		if (Def && (Def->GetName() == ContentId || Def->CollectibleName == ContentId)) return Def;
+		if (const FAssetData* AssetData = Index->Find(ContentId)) return AssetData;
 	}
 	return nullptr;
 }
 
-UShopItemDefinition* UContentRegistry::FindShopItemById(const FString& ContentId) const
+void UContentRegistry::CollectResident()
+{
+	TSet<FSoftObjectPath> Held;
+	for (const TPair<FName, FContentBundle>& Pair : Bundles) Held.Append(Pair.Value.DefinitionPaths);
+
+	CollectLoaded(TrackPieceIndex.Assets, Held, TrackPieces);
+	CollectLoaded(ObstacleIndex.Assets, Held, Obstacles);
+	CollectLoaded(PowerUpIndex.Assets, Held, PowerUps);
+	CollectLoaded(CollectibleIndex.Assets, Held, Collectibles);
+	CollectLoaded(ShopItemIndex.Assets, Held, ShopItems);
+}
+
+template<typename T>
+T* UContentRegistry::FindDefinition(const FContentIndex& Index, TArray<T*>& Resident, const FString& ContentId, FString T::*DisplayName)
 {
-	for (UShopItemDefinition* Def : ShopItems)
+	if (const FAssetData* AssetData = Index.Find(ContentId))
+	{
+		if (T* Def = Cast<T>(AssetData->FastGetAsset(false))) return Def;
+
+		// Callers should have awaited a bundle containing this definition; this hitches the game thread
+		UE_LOG(LogTemp, Warning, TEXT("ContentRegistry: %s was not streamed in ahead of use, loading synchronously"), *ContentId);
+		T* Def = Cast<T>(AssetData->GetAsset());
+		if (Def)
+		{
+			Bundles.FindOrAdd(FallbackBundleName).DefinitionPaths.Add(AssetData->GetSoftObjectPath());
+			CollectResident();
+		}
+		return Def;
+	}
+
+	// Display name lookups only see resident definitions
+	for (T* Def : Resident)
 	{
-		if (Def && (Def->GetName() == ContentId || Def->ItemName == ContentId)) return Def;
+		if (Def && Def->*DisplayName == ContentId) return Def;
 	}
 	return nullptr;
 }
 
+UTrackPieceDefinition* UContentRegistry::FindTrackPieceById(const FString& ContentId)
+{
+	return FindDefinition(TrackPieceIndex, TrackPieces, ContentId, &UTrackPieceDefinition::PieceName);
+}
+
+UObstacleDefinition* UContentRegistry::FindObstacleById(const FString& ContentId)
+{
+	return FindDefinition(ObstacleIndex, Obstacles, ContentId, &UObstacleDefinition::ObstacleName);
+}
+
+UPowerUpDefinition* UContentRegistry::FindPowerUpById(const FString& ContentId)
+{
+	return FindDefinition(PowerUpIndex, PowerUps, ContentId, &UPowerUpDefinition::PowerUpName);
+}
+
+UCollectibleDefinition* UContentRegistry::FindCollectibleById(const FString& ContentId)
+{
+	return FindDefinition(CollectibleIndex, Collectibles, ContentId, &UCollectibleDefinition::CollectibleName);
+}
+
+UShopItemDefinition* UContentRegistry::FindShopItemById(const FString& ContentId)
+{
+	return FindDefinition(ShopItemIndex, ShopItems, ContentId, &UShopItemDefinition::ItemName);
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "AssetRegistry/AssetData.h"
 #include "ContentRegistry.generated.h"
 
 class UTrackPieceDefinition;
@@ -11,9 +12,14 @@ class UObstacleDefinition;
 class UPowerUpDefinition;
 class UCollectibleDefinition;
 class UShopItemDefinition;
+struct FStreamableHandle;
 
 /**
- * Registry for gathering all game content definitions for export
+ * Registry for all game content definitions
+ * ScanContent only reads the asset registry (no loads); definitions are streamed in on demand as
+ * named bundles (LoadAllAsync / LoadDefinitionsAsync / LoadBundleAsync) and stay resident until
+ * their bundle is released. Definitions a find had to load synchronously stay resident until a
+ * bundle containing them finishes streaming. Getters and finds only see resident definitions.
  */
 UCLASS()
 class SEWERSCUTTLE_API UContentRegistry : public UObject
@@ -21,9 +27,48 @@ class SEWERSCUTTLE_API UContentRegistry : public UObject
 	GENERATED_BODY()
 
 public:
-	/** Gather all content definitions from the project */
+	/** Gather and synchronously load all content definitions (editor export path) */
 	void GatherContent();
 
+	/** Index all content definitions from the asset registry without loading them */
+	void ScanContent();
+
+	/** Stream in every definition in the background (bundle AllBundleName), OnComplete fires on the game thread */
+	void LoadAllAsync(FSimpleDelegate OnComplete);
+
+	/** Stream in only the given definitions (by content ID) as a bundle, OnComplete fires once all are resident */
+	void LoadDefinitionsAsync(FName BundleName, const TArray<FString>& ContentIds, FSimpleDelegate OnComplete);
+
+	/**
+	 * Stream the given definitions plus the game assets they reference (classes, meshes, effects - walked
+	 * through the asset registry's package dependencies, so nothing is loaded to compute the set) as one bundle.
+	 * Replaces any existing bundle with the same name once the new one is resident; a newer request for the
+	 * same name cancels an in-flight one (its OnComplete never fires).
+	 */
+	void LoadBundleAsync(FName BundleName, const TArray<FString>& ContentIds, FSimpleDelegate OnComplete);
+
+	/** Drop a bundle; its assets become collectable unless another bundle or live actor still references them */
+	void ReleaseBundle(FName BundleName);
+
+	/** Check if a bundle is loaded */
+	bool IsBundleLoaded(FName BundleName) const { return Bundles.Contains(BundleName); }
+
+	/** Check if a bundle is loaded with every requested definition (failed loads are logged and left out) */
+	bool IsBundleComplete(FName BundleName) const;
+
+	/** Check if a bundle is still streaming */
+	bool IsBundlePending(FName BundleName) const { return PendingBundles.Contains(BundleName); }
+
+	/** Estimated memory of a bundle's assets, measured when it finished loading */
+	int64 GetBundleMemoryBytes(FName BundleName) const;
+
+	/** Bundle used by LoadAllAsync/GatherContent */
+	static const FName AllBundleName;
+
+
+	/** Check if a definition is resident */
+	bool IsDefinitionLoaded(const FString& ContentId) const;
+
 	/** Get gathered track pieces */
 	const TArray<UTrackPieceDefinition*>& GetTrackPieces() const { return TrackPieces; }
 
@@ -41,25 +86,82 @@ public:
 
 	/** Find a track piece definition by its ID (AssetName) */
 	UFUNCTION(BlueprintPure, Category = "Content")
-	UTrackPieceDefinition* FindTrackPieceById(const FString& ContentId) const;
+	UTrackPieceDefinition* FindTrackPieceById(const FString& ContentId);
 
 	/** Find an obstacle definition by its ID (AssetName) */
 	UFUNCTION(BlueprintPure, Category = "Content")
-	UObstacleDefinition* FindObstacleById(const FString& ContentId) const;
+	UObstacleDefinition* FindObstacleById(const FString& ContentId);
 
 	/** Find a power-up definition by its ID (AssetName) */
 	UFUNCTION(BlueprintPure, Category = "Content")
-	UPowerUpDefinition* FindPowerUpById(const FString& ContentId) const;
+	UPowerUpDefinition* FindPowerUpById(const FString& ContentId);
 
 	/** Find a collectible definition by its ID (AssetName) */
 	UFUNCTION(BlueprintPure, Category = "Content")
-	UCollectibleDefinition* FindCollectibleById(const FString& ContentId) const;
+	UCollectibleDefinition* FindCollectibleById(const FString& ContentId);
 
 	/** Find a shop item definition by its ID (AssetName) */
 	UFUNCTION(BlueprintPure, Category = "Content")
-	UShopItemDefinition* FindShopItemById(const FString& ContentId) const;
+	UShopItemDefinition* FindShopItemById(const FString& ContentId);
 
 private:
+	/** Asset registry entries for one definition type, in scan order (which is also export order) */
+	struct FContentIndex
+	{
+		TArray<FAssetData> Assets;
+		TMap<FString, int32> IndexById;
+
+		void Reset() { Assets.Reset(); IndexById.Reset(); }
+		const FAssetData* Find(const FString& ContentId) const { const int32* Index = IndexById.Find(ContentId); return Index ? &Assets[*Index] : nullptr; }
+	};
+
+	/** Find the asset registry entry for a content ID across all definition types */
+	const FAssetData* FindAssetData(const FString& ContentId) const;
+
+	/** A set of streamed assets kept resident together */
+	struct FContentBundle
+	{
+		/** Definitions the bundle was requested for */
+		TSet<FSoftObjectPath> DefinitionPaths;
+
+		/** Keeps the bundle's assets loaded (null for synchronously loaded bundles) */
+		TSharedPtr<FStreamableHandle> Handle;
+
+		/** Requested definitions that failed to load */
+		int32 MissingDefinitions = 0;
+
+		int32 AssetCount = 0;
+		int64 MemoryBytes = 0;
+	};
+
+	/** Rebuild the resident arrays (in scan order) from the definitions held by live bundles */
+	void CollectResident();
+
+	/** Add the /Game assets a package references (hard and soft), walking Depth levels */
+	void GatherReferencedAssets(FName PackageName, int32 Depth, TSet<FName>& VisitedPackages, TSet<FSoftObjectPath>& OutPaths) const;
+
+	/** Start streaming a bundle */
+	void RequestBundle(FName BundleName, TSet<FSoftObjectPath>&& DefinitionPaths, TArray<FSoftObjectPath>&& Paths, FSimpleDelegate OnComplete);
+
+	/** Record a bundle once its assets are resident */
+	void FinishBundle(FName BundleName, TSharedPtr<FStreamableHandle> Handle, TSet<FSoftObjectPath>&& DefinitionPaths);
+
+	/** Resolve (or, as a last resort, synchronously load) a definition by ID */
+	template<typename T>
+	T* FindDefinition(const FContentIndex& Index, TArray<T*>& Resident, const FString& ContentId, FString T::*DisplayName);
+
+	FContentIndex TrackPieceIndex;
+	FContentIndex ObstacleIndex;
+	FContentIndex PowerUpIndex;
+	FContentIndex CollectibleIndex;
+	FContentIndex ShopItemIndex;
+
+	/** Resident bundles by name */
+	TMap<FName, FContentBundle> Bundles;
+
+	/** In-flight bundle requests by name (a newer request for the same name supersedes an older one) */
+	TMap<FName, TSharedPtr<FStreamableHandle>> PendingBundles;
+
 	UPROPERTY()
 	TArray<UTrackPieceDefinition*> TrackPieces;
 
@@ -75,4 +177,3 @@ private:
 	UPROPERTY()
 	TArray<UShopItemDefinition*> ShopItems;
 };
-
@@ -5,6 +5,7 @@
 #include "Misc/CommandLine.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "ConfigManager.h"
+#include "Async/Async.h"
 
 UDeviceIdManager* UDeviceIdManager::Get()
 {
@@ -15,33 +16,71 @@ FString UDeviceIdManager::GetDeviceId() const
 {
 	if (CachedDeviceId.IsEmpty())
 	{
-		// 1. Try command line override (highest priority)
-		FString CommandLineId;
-		if (FParse::Value(FCommandLine::Get(), TEXT("DeviceId="), CommandLineId))
+		CachedDeviceId = GetDeviceIdOverride();
+		if (CachedDeviceId.IsEmpty())
 		{
-			CachedDeviceId = CommandLineId;
+			CachedDeviceId = ResolvePlatformDeviceId();
 		}
+	}
+	return CachedDeviceId;
+}
 
-		// 2. Try Editor dev override
-		if (CachedDeviceId.IsEmpty() && GIsEditor)
-		{
-			if (UConfigManager* Config = UConfigManager::Get())
-			{
-				CachedDeviceId = Config->GetDevDeviceId();
-			}
-		}
+FString UDeviceIdManager::GetDeviceIdOverride()
+{
+	// 1. Try command line override (highest priority)
+	FString DeviceId;
+	if (FParse::Value(FCommandLine::Get(), TEXT("DeviceId="), DeviceId))
+	{
+		return DeviceId;
+	}
 
-		// 3. Standard Logic
-		if (CachedDeviceId.IsEmpty())
+	// 2. Try Editor dev override
+	if (GIsEditor)
+	{
+		if (UConfigManager* Config = UConfigManager::Get())
 		{
-			CachedDeviceId = UKismetSystemLibrary::GetDeviceId();
-			if (CachedDeviceId.IsEmpty())
-			{
-				CachedDeviceId = FGuid::NewGuid().ToString();
-			}
+			DeviceId = Config->GetDevDeviceId();
 		}
 	}
-	return CachedDeviceId;
+	return DeviceId;
+}
+
+FString UDeviceIdManager::ResolvePlatformDeviceId()
+{
+	// 3. Standard Logic
+	FString DeviceId = UKismetSystemLibrary::GetDeviceId();
+	if (DeviceId.IsEmpty())
+	{
+		DeviceId = FGuid::NewGuid().ToString();
+	}
+	return DeviceId;
+}
+
+void UDeviceIdManager::ResolveAsync(FSimpleDelegate OnResolved)
+{
+	if (CachedDeviceId.IsEmpty())
+	{
+		// Config objects are only safe to read here, on the game thread
+		CachedDeviceId = GetDeviceIdOverride();
+	}
+
+	if (!CachedDeviceId.IsEmpty())
+	{
+		OnResolved.ExecuteIfBound();
+		return;
+	}
+
+	Async(EAsyncExecution::ThreadPool, [OnResolved]()
+	{
+		FString DeviceId = ResolvePlatformDeviceId();
+		AsyncTask(ENamedThreads::GameThread, [DeviceId = MoveTemp(DeviceId), OnResolved]()
+		{
+			// GetDeviceId may have resolved it on the game thread in the meantime
+			UDeviceIdManager* Manager = UDeviceIdManager::Get();
+			if (Manager->CachedDeviceId.IsEmpty()) Manager->CachedDeviceId = DeviceId;
+			OnResolved.ExecuteIfBound();
+		});
+	});
 }
 
 bool UDeviceIdManager::HasDeviceId() const
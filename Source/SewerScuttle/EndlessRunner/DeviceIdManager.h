@@ -23,7 +23,19 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Identity")
 	bool HasDeviceId() const;
 
+	/**
+	 * Resolve the device ID, with the platform lookup (which can be slow) on a worker thread.
+	 * Overrides are read on the calling game thread; OnResolved fires on the game thread.
+	 */
+	void ResolveAsync(FSimpleDelegate OnResolved);
+
 private:
+	/** Command line, then editor override (game thread: reads config); empty if neither is set */
+	static FString GetDeviceIdOverride();
+
+	/** Platform ID, then a new GUID (safe on any thread) */
+	static FString ResolvePlatformDeviceId();
+
 	mutable FString CachedDeviceId;
 };
 
@@ -28,6 +28,8 @@
 #include "CollectibleCoin.h"
 #include "MultiCollectible.h"
 #include "PowerUp.h"
+#include "LaneCollisionResolver.h"
+#include "CoinField.h"
 #include "PowerUpDefinition.h"
 #include "ShopItemDefinition.h"
 #include "Obstacle.h"
@@ -35,10 +37,26 @@
 #include "PlayerClassDefinition.h"
 #include "WebServerInterface.h"
 #include "ContentRegistry.h"
+#include "LocalRunGenerator.h"
+#include "ConfigManager.h"
+#include "MockBackendServer.h"
 #include "DeviceIdManager.h"
+#include "SecureStorage.h"
+#include "BootPipeline.h"
+#include "GhostRunner.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Misc/ConfigCacheIni.h"
 #include "Misc/DateTime.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 
+namespace
+{
+	/** The speculative seed is requested for the class the player last started a run with */
+	const TCHAR* BootConfigSection = TEXT("SewerScuttle.Boot");
+	const TCHAR* LastPlayerClassKey = TEXT("LastPlayerClass");
+}
+
 AEndlessRunnerGameMode::AEndlessRunnerGameMode()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -51,7 +69,7 @@ AEndlessRunnerGameMode::AEndlessRunnerGameMode()
 	
 	// Initialize seed to 0 (will generate random on first game start if not set)
 	TrackSeed = 0;
-	SeededRandomStream.Initialize(TrackSeed);
+	LegacyRandomStream.Initialize(TrackSeed);
 	
 	// Set default HUD class
 	HUDClass = AEndlessRunnerHUD::StaticClass();
@@ -81,7 +99,61 @@ void AEndlessRunnerGameMode::BeginPlay()
 	}
 
 	ContentRegistry = NewObject<UContentRegistry>(this);
-	ContentRegistry->GatherContent();
+	LocalRunGenerator = NewObject<ULocalRunGenerator>(this);
+
+#if !UE_BUILD_SHIPPING
+	if (UConfigManager::Get()->UseMockBackend())
+	{
+		FMockBackendServer::Get().StartServer();
+	}
+#endif
+
+	// Boot work runs as overlapping async tasks so the menu is interactive immediately:
+	// content streams while identity resolves, the connection warms up and a seed is requested speculatively
+	BootPipeline = NewObject<UBootPipeline>(this);
+	BootPipeline->AddTask(TEXT("ContentIndex"), {}, [this](FSimpleDelegate Done)
+	{
+		ContentRegistry->ScanContent();
+		Done.ExecuteIfBound();
+	});
+	BootPipeline->AddTask(TEXT("Content"), { TEXT("ContentIndex") }, [this](FSimpleDelegate Done)
+	{
+		ContentRegistry->LoadAllAsync(FSimpleDelegate::CreateWeakLambda(this, [this, Done]()
+		{
+			OnContentLoaded();
+			Done.ExecuteIfBound();
+		}));
+	});
+	BootPipeline->AddTask(TEXT("Input"), {}, [this](FSimpleDelegate Done)
+	{
+		SetupEnhancedInput(Done);
+	});
+	BootPipeline->AddTask(TEXT("Identity"), {}, [](FSimpleDelegate Done)
+	{
+		// Device ID and stored auth token both resolve off the game thread
+		TSharedRef<int32> Remaining = MakeShared<int32>(2);
+		FSimpleDelegate Joined = FSimpleDelegate::CreateLambda([Remaining, Done]() { if (--(*Remaining) == 0) Done.ExecuteIfBound(); });
+		UDeviceIdManager::Get()->ResolveAsync(Joined);
+		USecureStorage::Get()->PreloadAsync(Joined);
+	});
+	BootPipeline->AddTask(TEXT("HttpWarmUp"), { TEXT("Identity") }, [this](FSimpleDelegate Done)
+	{
+		EnsureWebServerInterface();
+		WebServerInterface->WarmUp(Done);
+	});
+	BootPipeline->AddTask(TEXT("SeedPrefetch"), { TEXT("HttpWarmUp") }, [this](FSimpleDelegate Done)
+	{
+		// Each prefetch starts a run on the server, so only ask for one if this player has played a ranked run before
+		// (the class is recorded by StartGame); practice runs and first launches don't need one
+		FString LastClass;
+		GConfig->GetString(BootConfigSection, LastPlayerClassKey, LastClass, GGameUserSettingsIni);
+		if (LastClass.IsEmpty())
+		{
+			Done.ExecuteIfBound();
+			return;
+		}
+		WebServerInterface->PrefetchRunSeed(FPlayerClassData::StringToPlayerClass(LastClass), Done);
+	});
 
 	GameplayManager = NewObject<UGameplayManager>(this);
 	CurrencyManager = NewObject<UCurrencyManager>(this);
@@ -96,7 +168,7 @@ void AEndlessRunnerGameMode::BeginPlay()
 		CurrencyManager->Initialize();
 	}
 
-	SetupEnhancedInput();
+	BootPipeline->Start();
 }
 
 void AEndlessRunnerGameMode::RestartPlayer(AController* NewPlayer)
@@ -120,13 +192,28 @@ void AEndlessRunnerGameMode::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	if (BootPipeline && RunnerGameState == EGameState::Menu)
+	{
+		BootPipeline->MarkMenuFirstFrame();
+	}
+
 	if (RunnerGameState == EGameState::Playing)
 	{
+		if (BootPipeline)
+		{
+			BootPipeline->EndSpan(UBootPipeline::RunFirstFrameSpan);
+		}
+
 		if (bIsReplayMode)
 		{
 			UpdateReplay(DeltaTime);
 		}
 
+		for (AGhostRunner* Ghost : Ghosts)
+		{
+			if (IsValid(Ghost)) Ghost->AdvanceTo(GameTime);
+		}
+
 		GameTime += DeltaTime;
 
 		if (!CachedPlayer || !IsValid(CachedPlayer))
@@ -139,6 +226,7 @@ void AEndlessRunnerGameMode::Tick(float DeltaTime)
 		if (CachedPlayer)
 		{
 			DistanceTraveled = TotalPreviousDistance + (CachedPlayer->GetActorLocation().X - PlayerSpawnLocation.X);
+			GetLaneCollisionResolver()->Resolve(CachedPlayer);
 		}
 
 		static float ScoreUpdateTimer = 0.0f;
@@ -184,47 +272,133 @@ void AEndlessRunnerGameMode::StartGame()
 {
 	UE_LOG(LogTemp, Warning, TEXT("GameMode: StartGame() called - Requesting NEW seed for class: %s"), *FPlayerClassData::PlayerClassToString(SelectedClass));
 	bIsEndlessMode = false;
+	bIsPracticeRun = false;
+	bLocalRunStartPending = false;
 	bTrackSequenceLoaded = false;
+	ReleaseTierContent(INDEX_NONE);
+	ClearGhosts();
+	PendingGhostReplay.Empty();
 	
 	// Reset run-specific data immediately
 	SeedId = TEXT("");
 	TrackSeed = 0;
+	RngVersion = RunRngVersion::Current;
 	CurrentTier = 1;
 	SelectedTrackIndices.Empty();
 	
-	if (!WebServerInterface)
+	EnsureWebServerInterface();
+
+	if (BootPipeline)
 	{
-		WebServerInterface = NewObject<UWebServerInterface>(this);
-		WebServerInterface->Initialize();
-		
-		FOnSeedReceived OnSeedReceivedDelegate;
-		OnSeedReceivedDelegate.BindUFunction(this, FName("OnSeedReceived"));
-		WebServerInterface->SetOnSeedReceived(OnSeedReceivedDelegate);
-		
-		FOnTrackSelectionReceived OnTrackSelectionReceivedDelegate;
-		OnTrackSelectionReceivedDelegate.BindUFunction(this, FName("OnTrackSelectionReceived"));
-		WebServerInterface->SetOnTrackSelectionReceived(OnTrackSelectionReceivedDelegate);
-		
-		FOnTrackSequenceReceived OnTrackSequenceReceivedDelegate;
-		OnTrackSequenceReceivedDelegate.BindUFunction(this, FName("OnTrackSequenceReceived"));
-		WebServerInterface->SetOnTrackSequenceReceived(OnTrackSequenceReceivedDelegate);
-		
-		FOnShopItemsReceived OnShopItemsReceivedDelegate;
-		OnShopItemsReceivedDelegate.BindUFunction(this, FName("OnShopItemsReceived"));
-		WebServerInterface->SetOnShopItemsReceived(OnShopItemsReceivedDelegate);
-		
-		FOnBossRewardsReceived OnBossRewardsReceivedDelegate;
-		OnBossRewardsReceivedDelegate.BindUFunction(this, FName("OnBossRewardsReceived"));
-		WebServerInterface->SetOnBossRewardsReceived(OnBossRewardsReceivedDelegate);
-		
-		FOnError OnErrorDelegate;
-		OnErrorDelegate.BindUFunction(this, FName("OnSeedRequestError"));
-		WebServerInterface->SetOnError(OnErrorDelegate);
+		BootPipeline->BeginSpan(UBootPipeline::SeedWaitSpan);
 	}
+	GConfig->SetString(BootConfigSection, LastPlayerClassKey, *FPlayerClassData::PlayerClassToString(SelectedClass), GGameUserSettingsIni);
 
 	WebServerInterface->RequestRunSeed(0, SelectedClass);
 }
 
+void AEndlessRunnerGameMode::EnsureWebServerInterface()
+{
+	if (WebServerInterface) return;
+
+	WebServerInterface = NewObject<UWebServerInterface>(this);
+	WebServerInterface->Initialize();
+	
+	FOnSeedReceived OnSeedReceivedDelegate;
+	OnSeedReceivedDelegate.BindUFunction(this, FName("OnSeedReceived"));
+	WebServerInterface->SetOnSeedReceived(OnSeedReceivedDelegate);
+	
+	FOnTrackSelectionReceived OnTrackSelectionReceivedDelegate;
+	OnTrackSelectionReceivedDelegate.BindUFunction(this, FName("OnTrackSelectionReceived"));
+	WebServerInterface->SetOnTrackSelectionReceived(OnTrackSelectionReceivedDelegate);
+	
+	FOnTrackSequenceReceived OnTrackSequenceReceivedDelegate;
+	OnTrackSequenceReceivedDelegate.BindUFunction(this, FName("OnTrackSequenceReceived"));
+	WebServerInterface->SetOnTrackSequenceReceived(OnTrackSequenceReceivedDelegate);
+	
+	FOnShopItemsReceived OnShopItemsReceivedDelegate;
+	OnShopItemsReceivedDelegate.BindUFunction(this, FName("OnShopItemsReceived"));
+	WebServerInterface->SetOnShopItemsReceived(OnShopItemsReceivedDelegate);
+	
+	FOnBossRewardsReceived OnBossRewardsReceivedDelegate;
+	OnBossRewardsReceivedDelegate.BindUFunction(this, FName("OnBossRewardsReceived"));
+	WebServerInterface->SetOnBossRewardsReceived(OnBossRewardsReceivedDelegate);
+	
+	FOnError OnErrorDelegate;
+	OnErrorDelegate.BindUFunction(this, FName("OnSeedRequestError"));
+	WebServerInterface->SetOnError(OnErrorDelegate);
+}
+
+void AEndlessRunnerGameMode::OnContentLoaded()
+{
+	if (LocalRunGenerator && ContentRegistry)
+	{
+		// Local runs must match what the server would generate for the content version, so a partial set is unusable;
+		// runs fall back to server generation and the next practice run retries the load
+		if (ContentRegistry->IsBundleComplete(UContentRegistry::AllBundleName))
+		{
+			LocalRunGenerator->BuildFromRegistry(ContentRegistry, UConfigManager::Get()->GetContentVersion());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("GameMode: Content failed to load completely, local track generation disabled"));
+		}
+
+		// The generator keeps its own tables; runs only need their tier's bundle resident
+		ContentRegistry->ReleaseBundle(UContentRegistry::AllBundleName);
+	}
+
+	if (bLocalRunStartPending)
+	{
+		bLocalRunStartPending = false;
+		if (LocalRunGenerator && LocalRunGenerator->HasContent()) StartLocalRun();
+		else UE_LOG(LogTemp, Error, TEXT("GameMode: Content loaded but local generator has no content, cannot start practice run"));
+	}
+}
+
+void AEndlessRunnerGameMode::StartPracticeGame()
+{
+	GenerateRandomSeed();
+	RngVersion = RunRngVersion::Current;
+	PendingGhostReplay.Empty();
+	StartLocalRun();
+}
+
+void AEndlessRunnerGameMode::StartLocalRun()
+{
+	if (!LocalRunGenerator || !LocalRunGenerator->HasContent())
+	{
+		if (ContentRegistry && LocalRunGenerator)
+		{
+			UE_LOG(LogTemp, Log, TEXT("GameMode: StartLocalRun() - content still streaming, starting when ready"));
+			bLocalRunStartPending = true;
+			if (!ContentRegistry->IsBundlePending(UContentRegistry::AllBundleName))
+			{
+				ContentRegistry->LoadAllAsync(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerGameMode::OnContentLoaded));
+			}
+			return;
+		}
+		UE_LOG(LogTemp, Error, TEXT("GameMode: StartLocalRun() - no local content, cannot generate tracks"));
+		return;
+	}
+
+	bIsEndlessMode = false;
+	bIsPracticeRun = true;
+	bTrackSequenceLoaded = false;
+	ReleaseTierContent(INDEX_NONE);
+	ClearGhosts();
+
+	// Empty SeedId keeps the run out of submission
+	SeedId = TEXT("");
+	CurrentTier = 1;
+	SelectedTrackIndices.Empty();
+
+	UE_LOG(LogTemp, Warning, TEXT("GameMode: StartLocalRun() - Local seed: %d, class: %s"), TrackSeed, *FPlayerClassData::PlayerClassToString(SelectedClass));
+
+	LocalRunGenerator->BeginRun(TrackSeed, SelectedClass);
+	OnTrackSelectionReceived(LocalRunGenerator->GetTierTracks(1));
+}
+
 void AEndlessRunnerGameMode::StartGameWithSeed(int32 Seed, const FString& InSeedId, int32 InMaxCoins, int32 InMaxObstacles, int32 InMaxTrackPieces)
 {
 	UE_LOG(LogTemp, Warning, TEXT("GameMode: StartGameWithSeed() called - Seed: %d, SeedId: %s"), Seed, *InSeedId);
@@ -247,7 +421,7 @@ void AEndlessRunnerGameMode::StartGameWithSeed(int32 Seed, const FString& InSeed
 	
 	GetWorldTimerManager().ClearTimer(GameOverDelayTimerHandle);
 	
-	SeededRandomStream.Initialize(TrackSeed);
+	LegacyRandomStream.Initialize(TrackSeed);
 	
 	bSpawnSpecialCollectibles = false;
 	
@@ -449,6 +623,7 @@ void AEndlessRunnerGameMode::EndGame()
 	}
 
 	SetGameState(EGameState::GameOver);
+	ReleaseTierContent(INDEX_NONE);
 	
 	if (!SeedId.IsEmpty() && WebServerInterface)
 	{
@@ -473,7 +648,7 @@ void AEndlessRunnerGameMode::EndGame()
 
 		WebServerInterface->SubmitRun(
 			SeedId, Score, DistanceMeters, DurationSeconds, RunCurrency, ObstaclesHit, PowerupsUsed, TrackPiecesSpawned,
-			StartedAtStr, SelectedTrackIndices, false, bIsEndlessMode, ActualSequence, FPlayerClassData::PlayerClassToString(SelectedClass),
+			StartedAtStr, SelectedTrackIndices, false, bIsEndlessMode, ActualSequence, FPlayerClassData::PlayerClassToString(SelectedClass), RngVersion,
 			ReplayData
 		);
 	}
@@ -522,16 +697,24 @@ void AEndlessRunnerGameMode::UpdateScore(float DeltaTime)
 	}
 }
 
-void AEndlessRunnerGameMode::SetupEnhancedInput()
+void AEndlessRunnerGameMode::SetupEnhancedInput(FSimpleDelegate OnComplete)
 {
 	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
-	if (!PlayerController) return;
-	ULocalPlayer* LocalPlayer = PlayerController->GetLocalPlayer();
-	if (!LocalPlayer) return;
-	UEnhancedInputLocalPlayerSubsystem* InputSubsystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
-	if (!InputSubsystem) return;
-	UInputMappingContext* IMC_Keyboard = LoadObject<UInputMappingContext>(nullptr, TEXT("/Game/EndlessRunner/Input/IMC_Keyboard"));
-	if (IMC_Keyboard) InputSubsystem->AddMappingContext(IMC_Keyboard, 0);
+	ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	UEnhancedInputLocalPlayerSubsystem* InputSubsystem = LocalPlayer ? LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>() : nullptr;
+	if (!InputSubsystem) { OnComplete.ExecuteIfBound(); return; }
+
+	// The menu is mouse driven, so the mapping context can stream in behind it
+	const FSoftObjectPath MappingContextPath(TEXT("/Game/EndlessRunner/Input/IMC_Keyboard.IMC_Keyboard"));
+	TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem> WeakSubsystem(InputSubsystem);
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MappingContextPath,
+		FStreamableDelegate::CreateWeakLambda(this, [WeakSubsystem, MappingContextPath, OnComplete]()
+		{
+			UInputMappingContext* IMC_Keyboard = Cast<UInputMappingContext>(MappingContextPath.ResolveObject());
+			if (IMC_Keyboard && WeakSubsystem.IsValid()) WeakSubsystem->AddMappingContext(IMC_Keyboard, 0);
+			OnComplete.ExecuteIfBound();
+		}));
+	if (!Handle.IsValid()) OnComplete.ExecuteIfBound();
 }
 
 void AEndlessRunnerGameMode::OnPlayerHitObstacle(int32 LivesLost, bool bInstantDeath)
@@ -689,22 +872,33 @@ int32 AEndlessRunnerGameMode::GetCurrentJumpCount() const
 	return (Player && Player->GetJumpComponent()) ? Player->GetJumpComponent()->GetCurrentJumpCount() : 0;
 }
 
-FString AEndlessRunnerGameMode::GetActivePowerUpStatus() const
+FString AEndlessRunnerGameMode::GetActivePowerUpStatus() const { return GetActivePowerUpState().ToString(); }
+
+FActivePowerUpState AEndlessRunnerGameMode::GetActivePowerUpState() const
 {
-	TArray<FString> Effects;
+	FActivePowerUpState State;
 	ARabbitCharacter* Player = GetCachedPlayer();
 	if (Player && Player->GetAttributeSet())
 	{
-		float S = 1.0f + Player->GetAttributeSet()->GetSpeedMultiplier();
-		if (S != 1.0f) Effects.Add(FString::Printf(TEXT("Speed x%.1f"), S));
-		float C = Player->GetCoinMultiplier();
-		if (C != 1.0f) Effects.Add(FString::Printf(TEXT("Coins x%.1f"), C));
-		float Sc = Player->GetScoreMultiplier();
-		if (Sc != 1.0f) Effects.Add(FString::Printf(TEXT("Score x%.1f"), Sc));
+		State.SpeedMultiplier = 1.0f + Player->GetAttributeSet()->GetSpeedMultiplier();
+		State.CoinMultiplier = Player->GetCoinMultiplier();
+		State.ScoreMultiplier = Player->GetScoreMultiplier();
 	}
-	if (CachedPlayer && CachedPlayer->IsInvincible()) Effects.Add(TEXT("Invincible"));
-	if (bMagnetActive) Effects.Add(TEXT("Magnet"));
-	if (bAutopilotActive) Effects.Add(TEXT("Autopilot"));
+	State.bInvincible = CachedPlayer && CachedPlayer->IsInvincible();
+	State.bMagnet = bMagnetActive;
+	State.bAutopilot = bAutopilotActive;
+	return State;
+}
+
+FString FActivePowerUpState::ToString() const
+{
+	TArray<FString> Effects;
+	if (SpeedMultiplier != 1.0f) Effects.Add(FString::Printf(TEXT("Speed x%.1f"), SpeedMultiplier));
+	if (CoinMultiplier != 1.0f) Effects.Add(FString::Printf(TEXT("Coins x%.1f"), CoinMultiplier));
+	if (ScoreMultiplier != 1.0f) Effects.Add(FString::Printf(TEXT("Score x%.1f"), ScoreMultiplier));
+	if (bInvincible) Effects.Add(TEXT("Invincible"));
+	if (bMagnet) Effects.Add(TEXT("Magnet"));
+	if (bAutopilot) Effects.Add(TEXT("Autopilot"));
 	return FString::Join(Effects, TEXT(" | "));
 }
 
@@ -719,6 +913,12 @@ void AEndlessRunnerGameMode::AddRunCurrency(int32 Amount)
 void AEndlessRunnerGameMode::ClearPowerUpInvincibility() { GetWorldTimerManager().ClearTimer(InvincibilityTimerHandle); }
 void AEndlessRunnerGameMode::ClearGameModeInvincibility() { GetWorldTimerManager().ClearTimer(InvincibilityTimerHandle); ARabbitCharacter* P = GetCachedPlayer(); if (P) P->SetInvincible(false); }
 
+ULaneCollisionResolver* AEndlessRunnerGameMode::GetLaneCollisionResolver()
+{
+	if (!LaneCollisionResolver) LaneCollisionResolver = NewObject<ULaneCollisionResolver>(this);
+	return LaneCollisionResolver;
+}
+
 ARabbitCharacter* AEndlessRunnerGameMode::GetCachedPlayer() const
 {
 	if (CachedPlayer && IsValid(CachedPlayer)) return CachedPlayer;
@@ -744,10 +944,15 @@ void AEndlessRunnerGameMode::UpdateMagnetEffect(float DeltaTime)
 			FVector NL = C->GetActorLocation() + (PL - C->GetActorLocation()).GetSafeNormal() * MS * DeltaTime;
 			C->SetActorLocation(NL, false, nullptr, ETeleportType::None);
 			if (FVector::Dist(PL, NL) <= 20.0f && !C->IsCollected()) C->Collect();
-			else if (USphereComponent* CS = C->GetCollisionSphere()) CS->UpdateOverlaps();
+			else C->UpdateLaneRecord();
 		}
 	}
 
+	for (TActorIterator<ACoinField> FI(W); FI; ++FI)
+	{
+		if (IsValid(*FI)) FI->PullMagnetable(PL, MagnetRange, MS, DeltaTime);
+	}
+
 	for (TActorIterator<AMultiCollectible> MI(W); MI; ++MI)
 	{
 		AMultiCollectible* MC = *MI;
@@ -756,8 +961,8 @@ void AEndlessRunnerGameMode::UpdateMagnetEffect(float DeltaTime)
 		for (int32 i = 0; i < Items.Num(); ++i)
 		{
 			const FCollectibleItem& Item = Items[i];
-			if (Item.bCollected || !Item.MeshComponent) continue;
-			FVector IL = Item.MeshComponent->GetComponentLocation();
+			if (Item.bCollected) continue;
+			FVector IL = MC->GetItemLocation(i);
 			if (FVector::Dist(PL, IL) <= MagnetRange)
 			{
 				FVector NWL = IL + (PL - IL).GetSafeNormal() * MS * DeltaTime;
@@ -838,27 +1043,88 @@ void AEndlessRunnerGameMode::ApplyClassPerks(ARabbitCharacter* Player)
 int32 AEndlessRunnerGameMode::GetLives() const { const ARabbitCharacter* P = GetCachedPlayer(); return (P && P->GetAttributeSet()) ? FMath::RoundToInt(P->GetAttributeSet()->GetCurrentLives()) : Lives; }
 bool AEndlessRunnerGameMode::IsOnLastLegs() const { return GetLives() <= 0; }
 
-void AEndlessRunnerGameMode::SetTrackSeed(int32 NewSeed) { TrackSeed = FMath::Abs(NewSeed); SeededRandomStream.Initialize(TrackSeed); }
-void AEndlessRunnerGameMode::GenerateRandomSeed() { TrackSeed = FMath::RandRange(1, 2147483647); SeededRandomStream.Initialize(TrackSeed); }
+void AEndlessRunnerGameMode::SetTrackSeed(int32 NewSeed) { TrackSeed = FMath::Abs(NewSeed); LegacyRandomStream.Initialize(TrackSeed); }
+void AEndlessRunnerGameMode::GenerateRandomSeed() { TrackSeed = FMath::RandRange(1, 2147483647); LegacyRandomStream.Initialize(TrackSeed); }
 
 void AEndlessRunnerGameMode::OnSeedReceived(const FRunSeedData& SeedData)
 {
-	TrackSeed = SeedData.Seed; SeedId = SeedData.SeedId; MaxCoins = SeedData.MaxCoins; MaxObstacles = SeedData.MaxObstacles; MaxTrackPieces = SeedData.MaxTrackPieces; SeededRandomStream.Initialize(TrackSeed);
+	TrackSeed = SeedData.Seed; SeedId = SeedData.SeedId; MaxCoins = SeedData.MaxCoins; MaxObstacles = SeedData.MaxObstacles; MaxTrackPieces = SeedData.MaxTrackPieces; LegacyRandomStream.Initialize(TrackSeed);
 }
 
 void AEndlessRunnerGameMode::OnTrackSelectionReceived(const FTrackSelectionData& SelectionData)
 {
+	if (BootPipeline) BootPipeline->EndSpan(UBootPipeline::SeedWaitSpan);
 	CurrentTrackSelection = SelectionData; CurrentTier = SelectionData.Tier;
 	if (CurrentTier == 1) SelectedTrackIndices.Empty();
+
+	// Server runs: once the seed is known, the rest of the run can be generated locally if our content matches the server's
+	if (CurrentTier == 1 && !bIsPracticeRun && LocalRunGenerator && !SelectionData.SeedId.IsEmpty())
+	{
+		if (UConfigManager::Get()->UseLocalTrackGeneration() && LocalRunGenerator->HasContent() && LocalRunGenerator->GetContentVersion() == SelectionData.ContentVersion)
+		{
+			LocalRunGenerator->BeginRun(SelectionData.Seed, SelectedClass, SelectionData.SeedId);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Log, TEXT("GameMode: Using server track generation (local content %s, server content %s)"), LocalRunGenerator ? *LocalRunGenerator->GetContentVersion() : TEXT("none"), *SelectionData.ContentVersion);
+		}
+	}
 	ShowTrackSelection();
 }
 
 void AEndlessRunnerGameMode::OnPowerUpUsed() { if (RunnerGameState == EGameState::Playing) PowerupsUsed++; }
-void AEndlessRunnerGameMode::OnSeedRequestError(const FString& M) { TrackSeed = FMath::RandRange(1, 2147483647); SeedId = TEXT(""); SeededRandomStream.Initialize(TrackSeed); SetGameState(EGameState::Menu); }
+void AEndlessRunnerGameMode::OnSeedRequestError(const FString& M) { TrackSeed = FMath::RandRange(1, 2147483647); SeedId = TEXT(""); LegacyRandomStream.Initialize(TrackSeed); SetGameState(EGameState::Menu); }
 
 void AEndlessRunnerGameMode::OnTrackSequenceReceived(const FTrackSequenceData& SequenceData)
 {
 	UE_LOG(LogTemp, Warning, TEXT("GameMode: OnTrackSequenceReceived called. Pieces: %d, CurrentTier: %d"), SequenceData.Pieces.Num(), CurrentTier);
+
+	// Only the definitions this sequence references need to be resident before the run starts
+	TArray<FString> ContentIds;
+	for (const FTrackPiecePrescription& Piece : SequenceData.Pieces) ContentIds.AddUnique(Piece.PieceId.ToString());
+	for (const FName& DefinitionId : SequenceData.DefinitionIds) ContentIds.AddUnique(DefinitionId.ToString());
+	for (const FShopData& Shop : SequenceData.AllShopsData) for (const FShopItemData& Item : Shop.Items) ContentIds.AddUnique(Item.Id);
+	for (const FBossRewardData& Reward : SequenceData.BossRewards) ContentIds.AddUnique(Reward.Id);
+
+	PendingTrackSequence = SequenceData;
+	const int32 RequestId = ++PendingTrackSequenceRequestId;
+	// One bundle per tier: definitions plus the classes/meshes/effects they pull in
+	if (ContentRegistry) ContentRegistry->LoadBundleAsync(GetTierBundleName(CurrentTier), ContentIds, FSimpleDelegate::CreateUObject(this, &AEndlessRunnerGameMode::OnTrackSequenceContentReady, RequestId));
+	else OnTrackSequenceContentReady(RequestId);
+}
+
+void AEndlessRunnerGameMode::OnTrackSequenceContentReady(int32 RequestId)
+{
+	// A newer sequence arrived while this one was streaming
+	if (RequestId != PendingTrackSequenceRequestId) return;
+
+	// The new tier is resident, so dropping the previous one can't unload anything it shares
+	LoadedContentTiers.Add(CurrentTier);
+	ReleaseTierContent(CurrentTier);
+	StartTrackSequence(PendingTrackSequence);
+}
+
+void AEndlessRunnerGameMode::ReleaseTierContent(int32 KeepTier)
+{
+	if (KeepTier == INDEX_NONE)
+	{
+		// Also drop a tier that is still streaming so its completion can't start a stale sequence
+		++PendingTrackSequenceRequestId;
+		if (ContentRegistry) ContentRegistry->ReleaseBundle(GetTierBundleName(CurrentTier));
+	}
+
+	for (auto It = LoadedContentTiers.CreateIterator(); It; ++It)
+	{
+		if (*It == KeepTier) continue;
+		if (ContentRegistry) ContentRegistry->ReleaseBundle(GetTierBundleName(*It));
+		It.RemoveCurrent();
+	}
+}
+
+FName AEndlessRunnerGameMode::GetTierBundleName(int32 Tier) { return FName(*FString::Printf(TEXT("Tier%d"), Tier)); }
+
+void AEndlessRunnerGameMode::StartTrackSequence(const FTrackSequenceData& SequenceData)
+{
 	TrackSequence = SequenceData;
 	bTrackSequenceLoaded = true;
 	
@@ -869,7 +1135,7 @@ void AEndlessRunnerGameMode::OnTrackSequenceReceived(const FTrackSequenceData& S
 	else { Score = 0; RunCurrency = 0; TrackCurrency = 0; ObstaclesHit = 0; PowerupsUsed = 0; DistanceTraveled = 0.0f; TotalPreviousDistance = 0.0f; PreviousDistanceForScore = 0.0f; GameTime = 0.0f; RunStartTime = FDateTime::Now(); }
 	
 	SetGameState(EGameState::Playing);
-	if (TrackSeed > 0) SeededRandomStream.Initialize(TrackSeed);
+	if (TrackSeed > 0) LegacyRandomStream.Initialize(TrackSeed);
 	
 	UWorld* World = GetWorld(); if (!World) return;
 	APlayerController* PlayerController = World->GetFirstPlayerController(); if (!PlayerController) return;
@@ -879,6 +1145,14 @@ void AEndlessRunnerGameMode::OnTrackSequenceReceived(const FTrackSequenceData& S
 	else { Player->ResetRagdollState(); FVector RL(100.0f, 0.0f, 400.0f); Player->SetActorLocation(RL, false, nullptr, ETeleportType::TeleportPhysics); Player->SetActorRotation(FRotator::ZeroRotator); Player->ResetLanePosition(); PlayerSpawnLocation = RL; PlayerSpawnRotation = FRotator::ZeroRotator; }
 	
 	CachedPlayer = Player;
+
+	// Ghost races start their ghost with the player, at the start of tier 1
+	if (CurrentTier == 1 && PendingGhostReplay.Num() > 0)
+	{
+		AddGhost(PendingGhostReplay);
+		PendingGhostReplay.Empty();
+	}
+
 	if (Player)
 	{
 		if (CurrentTier == 1) { Player->ResetGASEffects(); if (URabbitJumpComponent* J = Player->GetJumpComponent()) J->ResetJumpCount(); if (Player->GetAttributeSet()) { Player->GetAttributeSet()->SetBaseLives(static_cast<float>(StartingLives)); Lives = StartingLives; } ApplyClassPerks(Player); }
@@ -912,7 +1186,21 @@ void AEndlessRunnerGameMode::OnShopItemsReceived(const FShopData& ShopData)
 void AEndlessRunnerGameMode::OnBossRewardsReceived(const TArray<FBossRewardData>& Rewards) { BossRewards = Rewards; if (AEndlessRunnerHUD* HUD = Cast<AEndlessRunnerHUD>(GetWorld()->GetFirstPlayerController()->GetHUD())) HUD->ShowBossRewards(); }
 
 void AEndlessRunnerGameMode::ShowTrackSelection() { SetGameState(EGameState::TrackSelection); if (AEndlessRunnerHUD* HUD = Cast<AEndlessRunnerHUD>(GetWorld()->GetFirstPlayerController()->GetHUD())) HUD->ShowTrackSelection(); }
-void AEndlessRunnerGameMode::SelectTrack(int32 TrackIndex) { if (TrackIndex < 0 || TrackIndex >= CurrentTrackSelection.Tracks.Num()) return; CurrentTrackIndex = TrackIndex; SelectedTrackIndices.Add(TrackIndex); if (WebServerInterface && !SeedId.IsEmpty()) WebServerInterface->SelectTrack(SeedId, CurrentTier, TrackIndex); }
+void AEndlessRunnerGameMode::SelectTrack(int32 TrackIndex)
+{
+	if (TrackIndex < 0 || TrackIndex >= CurrentTrackSelection.Tracks.Num()) return;
+	if (BootPipeline && CurrentTier == 1 && SelectedTrackIndices.Num() == 0) BootPipeline->BeginSpan(UBootPipeline::RunFirstFrameSpan);
+	CurrentTrackIndex = TrackIndex; SelectedTrackIndices.Add(TrackIndex);
+	if (CanGenerateLocally()) OnTrackSequenceReceived(LocalRunGenerator->GenerateTrackSequence(CurrentTier, TrackIndex));
+	else if (WebServerInterface && !SeedId.IsEmpty()) WebServerInterface->SelectTrack(SeedId, CurrentTier, TrackIndex);
+}
+
+bool AEndlessRunnerGameMode::CanGenerateLocally() const
+{
+	if (!LocalRunGenerator || !LocalRunGenerator->IsRunActive()) return false;
+	if (bIsPracticeRun) return true;
+	return UConfigManager::Get()->UseLocalTrackGeneration() && !SeedId.IsEmpty() && LocalRunGenerator->GetContentVersion() == CurrentTrackSelection.ContentVersion;
+}
 
 void AEndlessRunnerGameMode::OnShopTriggerOverlap(ATrackPiece* ShopPiece) 
 { 
@@ -1050,13 +1338,13 @@ void AEndlessRunnerGameMode::SelectBossReward(const FString& ID)
 	if (CurrentTier >= 3) CompleteRun(); else AdvanceToNextTier();
 }
 
-void AEndlessRunnerGameMode::AdvanceToNextTier() { CurrentTier++; CurrentTrackIndex = 0; TrackSequence.Pieces.Empty(); TrackSequence.ShopPositions.Empty(); TrackSequence.BossId = TEXT(""); if (WebServerInterface && !SeedId.IsEmpty()) WebServerInterface->RequestTierTracks(SeedId, CurrentTier); }
+void AEndlessRunnerGameMode::AdvanceToNextTier() { CurrentTier++; CurrentTrackIndex = 0; TrackSequence.Pieces.Empty(); TrackSequence.ShopPositions.Empty(); TrackSequence.BossId = TEXT(""); if (CanGenerateLocally()) OnTrackSelectionReceived(LocalRunGenerator->GetTierTracks(CurrentTier)); else if (WebServerInterface && !SeedId.IsEmpty()) WebServerInterface->RequestTierTracks(SeedId, CurrentTier); }
 void AEndlessRunnerGameMode::CompleteRun() 
 { 
 	if (WebServerInterface && !SeedId.IsEmpty()) 
 	{
 		TArray<FString> PieceIds;
-		for (const FTrackPiecePrescription& P : TrackSequence.Pieces) PieceIds.Add(P.PieceId);
+		for (const FTrackPiecePrescription& P : TrackSequence.Pieces) PieceIds.Add(P.PieceId.ToString());
 
 		TArray<FReplayEvent> ReplayData;
 		if (CachedPlayer)
@@ -1069,7 +1357,7 @@ void AEndlessRunnerGameMode::CompleteRun()
 			SeedId, Score, FMath::RoundToInt(GetDistanceTraveled()), FMath::RoundToInt(GameTime), 
 			RunCurrency, ObstaclesHit, PowerupsUsed, 
 			TrackGenerator ? TrackGenerator->GetTotalTrackPiecesSpawned() : 0, 
-			RunStartTime.ToIso8601(), SelectedTrackIndices, true, false, PieceIds, FPlayerClassData::PlayerClassToString(SelectedClass),
+			RunStartTime.ToIso8601(), SelectedTrackIndices, true, false, PieceIds, FPlayerClassData::PlayerClassToString(SelectedClass), RngVersion,
 			ReplayData
 		); 
 	}
@@ -1079,11 +1367,13 @@ void AEndlessRunnerGameMode::CompleteRun()
 void AEndlessRunnerGameMode::ShowEndlessModeOption() { if (AEndlessRunnerHUD* HUD = Cast<AEndlessRunnerHUD>(GetWorld()->GetFirstPlayerController()->GetHUD())) HUD->ShowEndlessModePrompt(); }
 void AEndlessRunnerGameMode::StartEndlessMode() { bIsEndlessMode = true; bTrackSequenceLoaded = false; CurrentTier = 3; if (TrackGenerator) { TrackGenerator->SetCurrentDifficulty(3); TrackGenerator->SetEndlessMode(true); } if (APlayerController* PC = GetWorld()->GetFirstPlayerController()) { PC->SetPause(false); PC->bShowMouseCursor = false; PC->SetInputMode(FInputModeGameOnly()); } SetGameState(EGameState::Playing); }
 
-void AEndlessRunnerGameMode::StartReplay(int32 Seed, const FString& InSeedId, EPlayerClass PlayerClass, const TArray<FReplayEvent>& ReplayData)
+void AEndlessRunnerGameMode::StartReplay(int32 Seed, const FString& InSeedId, EPlayerClass PlayerClass, int32 InRngVersion, const TArray<FReplayEvent>& ReplayData)
 {
-	UE_LOG(LogTemp, Warning, TEXT("GameMode: Starting Replay - Seed: %d, Class: %s"), Seed, *FPlayerClassData::PlayerClassToString(PlayerClass));
+	UE_LOG(LogTemp, Warning, TEXT("GameMode: Starting Replay - Seed: %d, Class: %s, RNG version: %d"), Seed, *FPlayerClassData::PlayerClassToString(PlayerClass), InRngVersion);
 	
 	bIsReplayMode = true;
+	RngVersion = InRngVersion;
+	ClearGhosts();
 	CurrentReplayBuffer = ReplayData;
 	CurrentReplayEventIndex = 0;
 	SelectedClass = PlayerClass;
@@ -1094,6 +1384,49 @@ void AEndlessRunnerGameMode::StartReplay(int32 Seed, const FString& InSeedId, EP
 	GameTime = 0.0f;
 }
 
+void AEndlessRunnerGameMode::StartGhostRace(int32 Seed, EPlayerClass PlayerClass, int32 InRngVersion, const TArray<FReplayEvent>& ReplayData)
+{
+	UE_LOG(LogTemp, Warning, TEXT("GameMode: Starting Ghost Race - Seed: %d, Class: %s"), Seed, *FPlayerClassData::PlayerClassToString(PlayerClass));
+
+	// The player drives a practice run of the replay's seed and class, so it is unranked and generated locally
+	bIsReplayMode = false;
+	SelectedClass = PlayerClass;
+	SetTrackSeed(Seed);
+
+	// The ghost's inputs were recorded against the track its own RNG version generated
+	RngVersion = InRngVersion;
+
+	// Added once tier 1's track starts, so the ghost sets off with the player
+	PendingGhostReplay = ReplayData;
+	StartLocalRun();
+}
+
+AGhostRunner* AEndlessRunnerGameMode::AddGhost(const TArray<FReplayEvent>& ReplayData)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	UClass* Class = GhostRunnerClass ? GhostRunnerClass.Get() : AGhostRunner::StaticClass();
+	AGhostRunner* Ghost = World->SpawnActor<AGhostRunner>(Class, PlayerSpawnLocation, PlayerSpawnRotation, SpawnParams);
+	if (!Ghost) return nullptr;
+
+	Ghost->Initialize(ReplayData);
+	Ghost->AdvanceTo(GameTime);
+	Ghosts.Add(Ghost);
+	return Ghost;
+}
+
+void AEndlessRunnerGameMode::ClearGhosts()
+{
+	for (AGhostRunner* Ghost : Ghosts)
+	{
+		if (IsValid(Ghost)) Ghost->Destroy();
+	}
+	Ghosts.Empty();
+}
+
 void AEndlessRunnerGameMode::UpdateReplay(float DeltaTime)
 {
 	if (!bIsReplayMode || !CachedPlayer) return;
@@ -7,6 +7,7 @@
 #include "PlayerClass.h"
 #include "WebServerInterface.h"
 #include "ReplayModels.h"
+#include "KeyedRandom.h"
 #include "EndlessRunnerGameMode.generated.h"
 
 class ATrackGenerator;
@@ -18,6 +19,11 @@ class UPlayerClassDefinition;
 class UWebServerInterface;
 class UPowerUpDefinition;
 class UContentRegistry;
+class ULocalRunGenerator;
+class UBootPipeline;
+class AGhostRunner;
+class ULaneCollisionResolver;
+class ACoinField;
 
 UENUM(BlueprintType)
 enum class EGameState : uint8
@@ -32,6 +38,32 @@ enum class EGameState : uint8
 	GameOver		UMETA(DisplayName = "Game Over")
 };
 
+/**
+ * Snapshot of the active power-up effects, cheap to poll and compare every frame
+ * Multipliers compare at the tenths the HUD displays them with
+ */
+struct FActivePowerUpState
+{
+	float SpeedMultiplier = 1.0f;
+	float CoinMultiplier = 1.0f;
+	float ScoreMultiplier = 1.0f;
+	bool bInvincible = false;
+	bool bMagnet = false;
+	bool bAutopilot = false;
+
+	bool operator==(const FActivePowerUpState& Other) const
+	{
+		return FMath::RoundToInt(SpeedMultiplier * 10.0f) == FMath::RoundToInt(Other.SpeedMultiplier * 10.0f)
+			&& FMath::RoundToInt(CoinMultiplier * 10.0f) == FMath::RoundToInt(Other.CoinMultiplier * 10.0f)
+			&& FMath::RoundToInt(ScoreMultiplier * 10.0f) == FMath::RoundToInt(Other.ScoreMultiplier * 10.0f)
+			&& bInvincible == Other.bInvincible && bMagnet == Other.bMagnet && bAutopilot == Other.bAutopilot;
+	}
+	bool operator!=(const FActivePowerUpState& Other) const { return !(*this == Other); }
+
+	/** "Speed x1.5 | Magnet" style summary, empty when nothing is active */
+	FString ToString() const;
+};
+
 /**
  * Main game mode for endless runner
  * Manages game state, scoring, and core gameplay systems
@@ -64,6 +96,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Game")
 	void StartGameWithSeed(int32 Seed, const FString& InSeedId, int32 InMaxCoins, int32 InMaxObstacles, int32 InMaxTrackPieces);
 
+	/** Start an unranked practice run - seed and tracks are generated locally, nothing is submitted */
+	UFUNCTION(BlueprintCallable, Category = "Game")
+	void StartPracticeGame();
+
+	/** Is the current run a local practice run */
+	UFUNCTION(BlueprintPure, Category = "Game")
+	bool IsPracticeRun() const { return bIsPracticeRun; }
+
 	/** Pause game */
 	UFUNCTION(BlueprintCallable, Category = "Game")
 	void PauseGame();
@@ -112,6 +152,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Game")
 	UCurrencyManager* GetCurrencyManager() const { return CurrencyManager; }
 
+	/** Get the lane collision resolver (created on first use, content can register before BeginPlay runs here) */
+	ULaneCollisionResolver* GetLaneCollisionResolver();
+
 	/** Get selected player class */
 	UFUNCTION(BlueprintPure, Category = "Class")
 	EPlayerClass GetSelectedClass() const { return SelectedClass; }
@@ -200,6 +243,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Game")
 	FString GetActivePowerUpStatus() const;
 
+	/** Get active powerup effects without building a string (for per-frame polling) */
+	FActivePowerUpState GetActivePowerUpState() const;
+
 	/** Get current track seed */
 	UFUNCTION(BlueprintPure, Category = "Seed")
 	int32 GetTrackSeed() const { return TrackSeed; }
@@ -212,8 +258,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Seed")
 	void GenerateRandomSeed();
 
-	/** Get seeded random stream (for use by TrackGenerator and SpawnManager) */
-	FRandomStream& GetSeededRandomStream() { return SeededRandomStream; }
+	/** Random numbers for one generation decision, keyed by the track seed and tier (for use by TrackGenerator and SpawnManager) */
+	FKeyedRandom MakeKeyedRandom(ERunRandomStream Stream, int32 KeyA, int32 KeyB = 0) const { return FKeyedRandom(TrackSeed, Stream, CurrentTier, KeyA, KeyB); }
+
+	/** Random number scheme the current run is generated with (RunRngVersion) */
+	UFUNCTION(BlueprintPure, Category = "Seed")
+	int32 GetRngVersion() const { return RngVersion; }
+
+	/** Shared stream for runs generated with RunRngVersion::Legacy (replays of runs recorded before keyed generation) */
+	FRandomStream& GetLegacyRandomStream() { return LegacyRandomStream; }
 
 	/** Check if track sequence is loaded (seeded run) */
 	UFUNCTION(BlueprintPure, Category = "Track Progression")
@@ -231,10 +284,13 @@ public:
 	UFUNCTION()
 	void OnTrackSelectionReceived(const FTrackSelectionData& SelectionData);
 
-	/** Handle track sequence received from server */
+	/** Handle track sequence received from server (streams referenced content, then starts the track) */
 	UFUNCTION()
 	void OnTrackSequenceReceived(const FTrackSequenceData& SequenceData);
 
+	/** Start playing a track sequence whose content is resident */
+	void StartTrackSequence(const FTrackSequenceData& SequenceData);
+
 	/** Handle shop items received from server */
 	UFUNCTION()
 	void OnShopItemsReceived(const FShopData& ShopData);
@@ -305,11 +361,31 @@ public:
 
 	/** Replay System */
 	UFUNCTION(BlueprintCallable, Category = "Replay")
-	void StartReplay(int32 Seed, const FString& InSeedId, EPlayerClass PlayerClass, const TArray<FReplayEvent>& ReplayData);
+	void StartReplay(int32 Seed, const FString& InSeedId, EPlayerClass PlayerClass, int32 InRngVersion, const TArray<FReplayEvent>& ReplayData);
 
 	UFUNCTION(BlueprintPure, Category = "Replay")
 	bool IsReplayMode() const { return bIsReplayMode; }
 
+	/** Race a recorded run live: the player runs its seed (unranked) alongside a ghost playing back the replay */
+	UFUNCTION(BlueprintCallable, Category = "Replay")
+	void StartGhostRace(int32 Seed, EPlayerClass PlayerClass, int32 InRngVersion, const TArray<FReplayEvent>& ReplayData);
+
+	/** Add a ghost for a replay to the current run (several can race at once) */
+	UFUNCTION(BlueprintCallable, Category = "Replay")
+	AGhostRunner* AddGhost(const TArray<FReplayEvent>& ReplayData);
+
+	/** Remove all ghosts */
+	UFUNCTION(BlueprintCallable, Category = "Replay")
+	void ClearGhosts();
+
+	/** Ghost actor class (override to give ghosts a proper mesh/material) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replay")
+	TSubclassOf<AGhostRunner> GhostRunnerClass;
+
+	/** Coin field class spawned per track piece for plain coins (override to change the animation settings) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawning")
+	TSubclassOf<ACoinField> CoinFieldClass;
+
 	/** Check if magnet is active */
 	UFUNCTION(BlueprintPure, Category = "PowerUp")
 	bool IsMagnetActive() const { return bMagnetActive; }
@@ -342,6 +418,18 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Managers")
 	UWebServerInterface* WebServerInterface;
 
+	/** Client-side run generator (mirrors the backend's RunSeedService) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Managers")
+	ULocalRunGenerator* LocalRunGenerator;
+
+	/** Startup task graph and timeline */
+	UPROPERTY()
+	UBootPipeline* BootPipeline;
+
+	/** Player contact with obstacles and pickups */
+	UPROPERTY()
+	ULaneCollisionResolver* LaneCollisionResolver = nullptr;
+
 	/** Current game state */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Game")
 	EGameState RunnerGameState = EGameState::Menu;
@@ -441,8 +529,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Seed")
 	FDateTime RunStartTime;
 
-	/** Seeded random stream for deterministic generation */
-	FRandomStream SeededRandomStream;
+	/** Random number scheme of the current run (RunRngVersion; replays use the one they were recorded with) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Seed")
+	int32 RngVersion = RunRngVersion::Current;
+
+	/** Seeded random stream for RunRngVersion::Legacy runs, re-initialised wherever the seed or track changes */
+	FRandomStream LegacyRandomStream;
 
 	/** Current tier (1, 2, or 3) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Track Progression")
@@ -489,9 +581,48 @@ protected:
 	/** Is the player in endless mode */
 	bool bIsEndlessMode = false;
 
+	/** Is the current run a local practice run (no server seed, never submitted) */
+	bool bIsPracticeRun = false;
+
+	/** Practice run or ghost race requested before content finished streaming */
+	bool bLocalRunStartPending = false;
+
+	/** Replay of a ghost race, raced once tier 1's track starts */
+	TArray<FReplayEvent> PendingGhostReplay;
+
+	/** Start a locally generated, unsubmitted run of TrackSeed with the selected class from tier 1 */
+	void StartLocalRun();
+
+	/** Sequence waiting on its content to stream in */
+	FTrackSequenceData PendingTrackSequence;
+
+	/** Incremented per received sequence so stale streaming completions are ignored */
+	int32 PendingTrackSequenceRequestId = 0;
+
+	/** Called when all content definitions have streamed in */
+	void OnContentLoaded();
+
+	/** Called when the content referenced by PendingTrackSequence is resident */
+	void OnTrackSequenceContentReady(int32 RequestId);
+
+	/** Release every tier content bundle except KeepTier's (INDEX_NONE releases all) */
+	void ReleaseTierContent(int32 KeepTier);
+
+	/** Content registry bundle name for a tier */
+	static FName GetTierBundleName(int32 Tier);
+
+	/** Tiers whose content bundle is currently held */
+	TSet<int32> LoadedContentTiers;
+
+	/** Can tracks for the current run be generated locally instead of asking the server */
+	bool CanGenerateLocally() const;
+
 protected:
-	/** Set up Enhanced Input Mapping Context */
-	void SetupEnhancedInput();
+	/** Stream in and apply the Enhanced Input Mapping Context, OnComplete fires once it is applied */
+	void SetupEnhancedInput(FSimpleDelegate OnComplete = FSimpleDelegate());
+
+	/** Create the web server interface and bind its callbacks (first call only) */
+	void EnsureWebServerInterface();
 
 	/** Update score based on distance */
 	void UpdateScore(float DeltaTime);
@@ -533,6 +664,10 @@ protected:
 
 	void UpdateReplay(float DeltaTime);
 
+	/** Ghosts racing the current run, advanced to GameTime each frame */
+	UPROPERTY()
+	TArray<AGhostRunner*> Ghosts;
+
 private:
 	/** Timer handle for respawn delay */
 	FTimerHandle RespawnTimerHandle;
@@ -0,0 +1,186 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GhostRunner.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/ConstructorHelpers.h"
+#include "RabbitCharacter.h"
+
+AGhostRunner::AGhostRunner()
+{
+	// Driven by the game mode, never ticks itself
+	PrimaryActorTick.bCanEverTick = false;
+
+	GhostMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("GhostMesh"));
+	RootComponent = GhostMesh;
+	GhostMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	GhostMesh->SetGenerateOverlapEvents(false);
+	GhostMesh->SetCastShadow(false);
+	GhostMesh->SetCanEverAffectNavigation(false);
+	GhostMesh->SetMobility(EComponentMobility::Movable);
+
+	// Placeholder shape; Blueprint subclasses can swap in a proper ghost mesh and material
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> DefaultMesh(TEXT("/Engine/BasicShapes/Cylinder.Cylinder"));
+	if (DefaultMesh.Succeeded())
+	{
+		GhostMesh->SetStaticMesh(DefaultMesh.Object);
+	}
+
+	SetActorEnableCollision(false);
+}
+
+void AGhostRunner::Initialize(const TArray<FReplayEvent>& ReplayData)
+{
+	Samples.Reset();
+	Actions.Reset();
+	SampleCursor = 0;
+	ActionCursor = 0;
+	LastTime = 0.0f;
+	LastLaneActionTime = -LaneSettleTime;
+	JumpStartTime = -1.0f;
+	bSliding = false;
+	bFinished = false;
+
+	// Split the stream once so playback only walks forward through two flat arrays
+	for (const FReplayEvent& Event : ReplayData)
+	{
+		if (Event.EventType == EReplayEventType::PositionSync)
+		{
+			Samples.Add({ Event.Timestamp, Event.Position });
+		}
+		else
+		{
+			Actions.Add({ Event.Timestamp, Event.EventType });
+		}
+	}
+
+	// Recorded in time order, but don't rely on it
+	Samples.StableSort([](const FPositionSample& A, const FPositionSample& B) { return A.Time < B.Time; });
+	Actions.StableSort([](const FActionEvent& A, const FActionEvent& B) { return A.Time < B.Time; });
+
+	if (Samples.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GhostRunner: Replay has no position samples, ghost stays hidden"));
+		bFinished = true;
+		SetActorHiddenInGame(true);
+		return;
+	}
+
+	Lane = LaneFromY(Samples[0].Position.Y);
+	CurrentY = Samples[0].Position.Y;
+	SetActorLocation(Samples[0].Position);
+}
+
+int32 AGhostRunner::LaneFromY(float Y)
+{
+	const float LaneWidth = ARabbitCharacter::LANE_RIGHT_Y - ARabbitCharacter::LANE_CENTER_Y;
+	return FMath::Clamp(FMath::RoundToInt((Y - ARabbitCharacter::LANE_CENTER_Y) / LaneWidth), -1, 1);
+}
+
+void AGhostRunner::ApplyAction(const FActionEvent& Action)
+{
+	switch (Action.Type)
+	{
+	case EReplayEventType::MoveLeft:
+		Lane = FMath::Max(Lane - 1, -1);
+		LastLaneActionTime = Action.Time;
+		break;
+	case EReplayEventType::MoveRight:
+		Lane = FMath::Min(Lane + 1, 1);
+		LastLaneActionTime = Action.Time;
+		break;
+	case EReplayEventType::Jump:
+		JumpStartTime = Action.Time;
+		break;
+	case EReplayEventType::Slide:
+		bSliding = true;
+		break;
+	case EReplayEventType::SlideReleased:
+		bSliding = false;
+		break;
+	default:
+		break;
+	}
+}
+
+void AGhostRunner::AdvanceTo(float ReplayTime)
+{
+	if (bFinished) return;
+
+	const float DeltaTime = FMath::Max(ReplayTime - LastTime, 0.0f);
+	LastTime = ReplayTime;
+
+	// Walk samples and actions that are now behind us in time order. Lane inputs are recorded even when the
+	// character throttled them, so a sample taken once the lane has settled corrects the lane
+	const bool bSlidingBefore = bSliding;
+	for (;;)
+	{
+		const bool bHasSample = SampleCursor + 1 < Samples.Num() && Samples[SampleCursor + 1].Time <= ReplayTime;
+		const bool bHasAction = ActionCursor < Actions.Num() && Actions[ActionCursor].Time <= ReplayTime;
+		if (bHasSample && (!bHasAction || Samples[SampleCursor + 1].Time < Actions[ActionCursor].Time))
+		{
+			++SampleCursor;
+			if (Samples[SampleCursor].Time - LastLaneActionTime > LaneSettleTime)
+			{
+				Lane = LaneFromY(Samples[SampleCursor].Position.Y);
+			}
+		}
+		else if (bHasAction)
+		{
+			ApplyAction(Actions[ActionCursor++]);
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	// Forward and vertical position from the samples, lerped between neighbours or extrapolated past the last one
+	const FPositionSample& From = Samples[SampleCursor];
+	FVector Position = From.Position;
+	if (SampleCursor + 1 < Samples.Num())
+	{
+		const FPositionSample& To = Samples[SampleCursor + 1];
+		const float Alpha = To.Time > From.Time ? FMath::Clamp((ReplayTime - From.Time) / (To.Time - From.Time), 0.0f, 1.0f) : 1.0f;
+		Position = FMath::Lerp(From.Position, To.Position, Alpha);
+	}
+	else if (SampleCursor > 0)
+	{
+		const FPositionSample& Prev = Samples[SampleCursor - 1];
+		const float Overrun = ReplayTime - From.Time;
+		if (Overrun > MaxExtrapolationTime && ActionCursor >= Actions.Num())
+		{
+			bFinished = true;
+			return;
+		}
+		if (From.Time > Prev.Time)
+		{
+			const float VelocityX = (From.Position.X - Prev.Position.X) / (From.Time - Prev.Time);
+			Position.X += VelocityX * FMath::Min(Overrun, MaxExtrapolationTime);
+		}
+	}
+
+	// Lanes are tracked from the input events rather than the (sparse) samples
+	CurrentY = FMath::FInterpTo(CurrentY, ARabbitCharacter::LANE_CENTER_Y + Lane * (ARabbitCharacter::LANE_RIGHT_Y - ARabbitCharacter::LANE_CENTER_Y), DeltaTime, LaneTransitionSpeed);
+	Position.Y = CurrentY;
+
+	if (JumpStartTime >= 0.0f)
+	{
+		const float JumpAlpha = (ReplayTime - JumpStartTime) / JumpDuration;
+		if (JumpAlpha < 1.0f)
+		{
+			Position.Z += JumpHeight * 4.0f * JumpAlpha * (1.0f - JumpAlpha);
+		}
+		else
+		{
+			JumpStartTime = -1.0f;
+		}
+	}
+
+	if (bSliding != bSlidingBefore)
+	{
+		GhostMesh->SetRelativeScale3D(FVector(1.0f, 1.0f, bSliding ? SlideHeightScale : 1.0f));
+	}
+
+	SetActorLocation(Position, false, nullptr, ETeleportType::TeleportPhysics);
+}
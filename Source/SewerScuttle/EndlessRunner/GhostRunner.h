@@ -0,0 +1,103 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ReplayModels.h"
+#include "GhostRunner.generated.h"
+
+class UStaticMeshComponent;
+
+/**
+ * Visual-only runner that plays back a recorded run next to the live player
+ * Has no movement component, physics or collision and doesn't tick on its own: the game mode advances it
+ * to the run time each frame. Position comes from interpolating the replay's PositionSync samples, with lane
+ * changes, jumps and slides layered on from the input events, so a frame costs O(1) amortized per ghost.
+ */
+UCLASS()
+class SEWERSCUTTLE_API AGhostRunner : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AGhostRunner();
+
+	/** Decode a replay stream; the ghost is placed at its first sample */
+	void Initialize(const TArray<FReplayEvent>& ReplayData);
+
+	/** Move the ghost to where the recorded run was at ReplayTime (seconds since the run started, non-decreasing) */
+	void AdvanceTo(float ReplayTime);
+
+	/** Check if the recorded run has ended */
+	UFUNCTION(BlueprintPure, Category = "Ghost")
+	bool IsFinished() const { return bFinished; }
+
+protected:
+	/** Ghost mesh (no collision, no shadows) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	UStaticMeshComponent* GhostMesh;
+
+	/** Lane change interpolation speed (matches the character's base lane transition speed) */
+	UPROPERTY(EditDefaultsOnly, Category = "Ghost")
+	float LaneTransitionSpeed = 10.0f;
+
+	/** Peak height of a jump arc */
+	UPROPERTY(EditDefaultsOnly, Category = "Ghost")
+	float JumpHeight = 300.0f;
+
+	/** Time from take-off to landing */
+	UPROPERTY(EditDefaultsOnly, Category = "Ghost")
+	float JumpDuration = 0.8f;
+
+	/** Vertical mesh scale while sliding */
+	UPROPERTY(EditDefaultsOnly, Category = "Ghost")
+	float SlideHeightScale = 0.5f;
+
+	/** Time after a lane input before a position sample is trusted to correct the lane */
+	UPROPERTY(EditDefaultsOnly, Category = "Ghost")
+	float LaneSettleTime = 0.5f;
+
+	/** How long to keep extrapolating forward after the last position sample */
+	UPROPERTY(EditDefaultsOnly, Category = "Ghost")
+	float MaxExtrapolationTime = 2.0f;
+
+private:
+	struct FPositionSample
+	{
+		float Time;
+		FVector Position;
+	};
+
+	struct FActionEvent
+	{
+		float Time;
+		EReplayEventType Type;
+	};
+
+	/** Lane index (-1 left, 0 center, 1 right) nearest a Y coordinate */
+	static int32 LaneFromY(float Y);
+
+	/** Apply an input event to the lane / jump / slide state */
+	void ApplyAction(const FActionEvent& Action);
+
+	/** PositionSync samples in time order */
+	TArray<FPositionSample> Samples;
+
+	/** Lane, jump and slide events in time order */
+	TArray<FActionEvent> Actions;
+
+	/** Sample at or before the current time */
+	int32 SampleCursor = 0;
+
+	/** Next action to apply */
+	int32 ActionCursor = 0;
+
+	float LastTime = 0.0f;
+	float LastLaneActionTime = 0.0f;
+	int32 Lane = 0;
+	float CurrentY = 0.0f;
+	float JumpStartTime = -1.0f;
+	bool bSliding = false;
+	bool bFinished = false;
+};
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Random number scheme a run was generated with, submitted with the run and returned with leaderboard entries.
+ * A replay or ghost race regenerates the track with the scheme its run was recorded under, so the same seed
+ * produces the same pieces and spawns the inputs were recorded against.
+ */
+namespace RunRngVersion
+{
+	/** One shared FRandomStream drawn in spawn order, cumulative-weight selection (runs that carry no version) */
+	constexpr int32 Legacy = 1;
+
+	/** FKeyedRandom keyed by (seed, stream, tier, piece, slot), alias table selection */
+	constexpr int32 Keyed = 2;
+
+	/** Scheme new runs are generated with */
+	constexpr int32 Current = Keyed;
+}
+
+/** Independent random streams of a run, one per kind of generation decision */
+enum class ERunRandomStream : uint32
+{
+	TrackPieceSelection = 1,
+	SpawnRoll = 2
+};
+
+/**
+ * Counter-based random numbers keyed by (seed, stream, track, keys).
+ * Each decision hashes its own key (e.g. piece index and spawn slot) instead of advancing a shared stream,
+ * so results do not depend on the order decisions are made in and pieces can be planned in any order or in parallel.
+ * Piece indices restart with every track, so the track (the run's tier) is part of the key.
+ */
+struct SEWERSCUTTLE_API FKeyedRandom
+{
+	FKeyedRandom(int32 Seed, ERunRandomStream Stream, int32 Track, int32 KeyA, int32 KeyB = 0)
+		: Key(Mix(Mix(Mix(Mix(static_cast<uint64>(static_cast<uint32>(Seed)) << 32 | static_cast<uint32>(Stream)) ^ static_cast<uint32>(Track)) ^ static_cast<uint32>(KeyA)) ^ static_cast<uint32>(KeyB)))
+	{
+	}
+
+	/** Next 32 random bits */
+	uint32 NextUInt()
+	{
+		return static_cast<uint32>(Mix(Key + ++Counter * 0x9E3779B97F4A7C15ull) >> 32);
+	}
+
+	/** Random float in [0, 1) */
+	float FRand()
+	{
+		return (NextUInt() >> 8) * (1.0f / 16777216.0f);
+	}
+
+	/** Random float in [Min, Max) */
+	float FRandRange(float Min, float Max)
+	{
+		return Min + (Max - Min) * FRand();
+	}
+
+	/** Random integer in [Min, Max] */
+	int32 RandRange(int32 Min, int32 Max)
+	{
+		const uint64 Range = static_cast<uint64>(static_cast<int64>(Max) - Min + 1);
+		return Max <= Min ? Min : static_cast<int32>(Min + static_cast<int64>((NextUInt() * Range) >> 32));
+	}
+
+private:
+	/** SplitMix64 finalizer */
+	static uint64 Mix(uint64 Value)
+	{
+		Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+		return Value ^ (Value >> 31);
+	}
+
+	uint64 Key;
+	uint64 Counter = 0;
+};
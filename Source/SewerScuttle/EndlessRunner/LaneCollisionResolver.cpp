@@ -0,0 +1,198 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LaneCollisionResolver.h"
+#include "EndlessRunnerGameMode.h"
+#include "RabbitCharacter.h"
+#include "RabbitJumpComponent.h"
+#include "RabbitSlideComponent.h"
+#include "CollectibleCoin.h"
+#include "PowerUp.h"
+#include "MultiCollectible.h"
+#include "CoinField.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+
+ULaneCollisionResolver* ULaneCollisionResolver::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	AEndlessRunnerGameMode* GameMode = World ? Cast<AEndlessRunnerGameMode>(World->GetAuthGameMode()) : nullptr;
+	return GameMode ? GameMode->GetLaneCollisionResolver() : nullptr;
+}
+
+ULaneCollisionResolver::FLaneBand ULaneCollisionResolver::MakeBand(const FBox& Bounds)
+{
+	FLaneBand Band;
+	Band.MinX = Bounds.Min.X;
+	Band.MaxX = Bounds.Max.X;
+	Band.MinY = Bounds.Min.Y;
+	Band.MaxY = Bounds.Max.Y;
+	Band.MinZ = Bounds.Min.Z;
+	Band.MaxZ = Bounds.Max.Z;
+	return Band;
+}
+
+int32 ULaneCollisionResolver::Register(AActor* Actor, ELaneContentKind Kind, const FBox& Bounds, int32 ItemIndex)
+{
+	if (!Actor || !Bounds.IsValid) return INDEX_NONE;
+
+	int32 RecordId;
+	if (FreeIds.Num() > 0)
+	{
+		RecordId = FreeIds.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		RecordId = Bands.AddDefaulted();
+		Refs.AddDefaulted();
+	}
+
+	Bands[RecordId] = MakeBand(Bounds);
+
+	FLaneContentRef& Ref = Refs[RecordId];
+	Ref = FLaneContentRef();
+	Ref.Actor = Actor;
+	Ref.ItemIndex = ItemIndex;
+	Ref.Kind = Kind;
+	Ref.bActive = true;
+	return RecordId;
+}
+
+void ULaneCollisionResolver::Unregister(int32 RecordId)
+{
+	if (!Refs.IsValidIndex(RecordId) || !Refs[RecordId].bActive) return;
+
+	// An empty band (Max < Min) never overlaps, so the loop needs no active check
+	Bands[RecordId] = FLaneBand();
+	Refs[RecordId] = FLaneContentRef();
+	FreeIds.Add(RecordId);
+}
+
+void ULaneCollisionResolver::UpdateBounds(int32 RecordId, const FBox& Bounds)
+{
+	if (!Refs.IsValidIndex(RecordId) || !Refs[RecordId].bActive) return;
+	Bands[RecordId] = MakeBand(Bounds);
+}
+
+void ULaneCollisionResolver::SetObstacleRules(int32 RecordId, EObstacleType Type, bool bBreakable)
+{
+	if (!Refs.IsValidIndex(RecordId) || !Refs[RecordId].bActive) return;
+	Refs[RecordId].ObstacleType = Type;
+	Refs[RecordId].bBreakable = bBreakable;
+}
+
+void ULaneCollisionResolver::Resolve(ARabbitCharacter* Player)
+{
+	if (!Player) return;
+
+	UCapsuleComponent* Capsule = Player->GetCapsuleComponent();
+	if (!Capsule) return;
+
+	// Player box: capsule around the actor, swept along X from last frame
+	const FVector Location = Player->GetActorLocation();
+	const float Radius = Capsule->GetScaledCapsuleRadius();
+	const float HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+
+	float SweepStartX = Location.X;
+	if (bHasLastPlayerX && FMath::Abs(Location.X - LastPlayerX) <= MaxSweepDistance)
+	{
+		SweepStartX = LastPlayerX;
+	}
+	LastPlayerX = Location.X;
+	bHasLastPlayerX = true;
+
+	const float PlayerMinX = FMath::Min(SweepStartX, Location.X) - Radius;
+	const float PlayerMaxX = FMath::Max(SweepStartX, Location.X) + Radius;
+	const float PlayerMinY = Location.Y - Radius;
+	const float PlayerMaxY = Location.Y + Radius;
+	const float PlayerMinZ = Location.Z - HalfHeight;
+	const float PlayerMaxZ = Location.Z + HalfHeight;
+
+	// Player state read once per frame for all obstacle rules
+	const bool bSliding = Player->GetSlideComponent() && Player->GetSlideComponent()->IsSliding();
+	const bool bJumping = Player->GetJumpComponent() && Player->GetJumpComponent()->IsJumping();
+	const bool bNeverNeedsCrouch = Player->GetNeverNeedsCrouch();
+	const bool bCanBreak = Player->GetCanBreakObstacles();
+	const bool bInvincible = Player->IsInvincible();
+
+	PendingContacts.Reset();
+
+	const int32 NumRecords = Bands.Num();
+	FLaneBand* BandData = Bands.GetData();
+	for (int32 Index = 0; Index < NumRecords; ++Index)
+	{
+		FLaneBand& Band = BandData[Index];
+		const bool bOverlaps = Band.MinX <= PlayerMaxX && Band.MaxX >= PlayerMinX
+			&& Band.MinY <= PlayerMaxY && Band.MaxY >= PlayerMinY
+			&& Band.MinZ <= PlayerMaxZ && Band.MaxZ >= PlayerMinZ;
+
+		const bool bWasTouching = Band.bTouching;
+		Band.bTouching = bOverlaps;
+		if (!bOverlaps || bWasTouching) continue;
+
+		// Only entering records reach the references
+		const FLaneContentRef& Ref = Refs[Index];
+
+		if (Ref.Kind != ELaneContentKind::Obstacle)
+		{
+			PendingContacts.Emplace(Index, EContact::Collect);
+			continue;
+		}
+
+		// Enforcer breaks breakable obstacles regardless of avoidance state
+		if (Ref.bBreakable && bCanBreak)
+		{
+			PendingContacts.Emplace(Index, EContact::BreakObstacle);
+			continue;
+		}
+
+		const bool bAvoided = (Ref.ObstacleType == EObstacleType::Low && (bSliding || bNeverNeedsCrouch))
+			|| (Ref.ObstacleType == EObstacleType::High && bJumping);
+		if (!bAvoided && !bInvincible)
+		{
+			PendingContacts.Emplace(Index, EContact::HitObstacle);
+		}
+	}
+
+	for (const TPair<int32, EContact>& Contact : PendingContacts)
+	{
+		// Copy out: handlers unregister (and may free) the record
+		const FLaneContentRef Ref = Refs[Contact.Key];
+		AActor* Actor = Ref.Actor.Get();
+		if (!IsValid(Actor)) continue;
+
+		switch (Ref.Kind)
+		{
+		case ELaneContentKind::Obstacle:
+			if (AObstacle* Obstacle = Cast<AObstacle>(Actor))
+			{
+				if (Contact.Value == EContact::BreakObstacle) Obstacle->BreakObstacle();
+				else Obstacle->HitPlayer(Player);
+			}
+			break;
+		case ELaneContentKind::Coin:
+			if (ACollectibleCoin* Coin = Cast<ACollectibleCoin>(Actor))
+			{
+				if (!Coin->IsCollected()) Coin->Collect();
+			}
+			break;
+		case ELaneContentKind::PowerUp:
+			if (APowerUp* PowerUp = Cast<APowerUp>(Actor))
+			{
+				PowerUp->Collect(Player);
+			}
+			break;
+		case ELaneContentKind::MultiCollectibleItem:
+			if (AMultiCollectible* Multi = Cast<AMultiCollectible>(Actor))
+			{
+				Multi->CollectItem(Ref.ItemIndex);
+			}
+			break;
+		case ELaneContentKind::CoinFieldItem:
+			if (ACoinField* Field = Cast<ACoinField>(Actor))
+			{
+				Field->CollectItem(Ref.ItemIndex);
+			}
+			break;
+		}
+	}
+}
@@ -0,0 +1,103 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Obstacle.h"
+#include "LaneCollisionResolver.generated.h"
+
+class ARabbitCharacter;
+
+/** What a lane content record stands for */
+enum class ELaneContentKind : uint8
+{
+	Obstacle,
+	Coin,
+	PowerUp,
+	MultiCollectibleItem,
+	CoinFieldItem
+};
+
+/**
+ * Resolves player contact with runner content (obstacles, coins, power-ups, multi-collectible items) without
+ * physics overlaps. Content registers its world bounds once; each frame the player's lane band, swept X
+ * interval and vertical band are tested against the compact band array, and the obstacle avoidance rules
+ * (slide under Low, jump over High, Full, breakable, never-crouch, invincible) are applied in the same loop.
+ * Like an overlap begin event, a record only reacts on the frame the player enters it.
+ */
+UCLASS()
+class SEWERSCUTTLE_API ULaneCollisionResolver : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Resolver of the current game mode (null outside the runner game mode) */
+	static ULaneCollisionResolver* Get(const UObject* WorldContextObject);
+
+	/** Add a content record, returns its ID */
+	int32 Register(AActor* Actor, ELaneContentKind Kind, const FBox& Bounds, int32 ItemIndex = INDEX_NONE);
+
+	/** Remove a record (safe to call with INDEX_NONE or an already removed ID) */
+	void Unregister(int32 RecordId);
+
+	/** Move a record (content that moves after registering, e.g. magnet-pulled coins) */
+	void UpdateBounds(int32 RecordId, const FBox& Bounds);
+
+	/** Update an obstacle record's avoidance rules */
+	void SetObstacleRules(int32 RecordId, EObstacleType Type, bool bBreakable);
+
+	/** Test the player against all records and dispatch contacts */
+	void Resolve(ARabbitCharacter* Player);
+
+	/** Number of live records */
+	int32 GetNumRecords() const { return Bands.Num() - FreeIds.Num(); }
+
+private:
+	/** World-space box of a record, kept apart from the references so the test loop stays in a dense array */
+	struct FLaneBand
+	{
+		float MinX = 0.0f;
+		float MaxX = -1.0f;
+		float MinY = 0.0f;
+		float MaxY = -1.0f;
+		float MinZ = 0.0f;
+		float MaxZ = -1.0f;
+
+		/** Player was inside last frame */
+		bool bTouching = false;
+	};
+
+	struct FLaneContentRef
+	{
+		TWeakObjectPtr<AActor> Actor;
+		int32 ItemIndex = INDEX_NONE;
+		ELaneContentKind Kind = ELaneContentKind::Obstacle;
+		EObstacleType ObstacleType = EObstacleType::Full;
+		bool bBreakable = false;
+		bool bActive = false;
+	};
+
+	enum class EContact : uint8
+	{
+		Collect,
+		BreakObstacle,
+		HitObstacle
+	};
+
+	static FLaneBand MakeBand(const FBox& Bounds);
+
+	TArray<FLaneBand> Bands;
+	TArray<FLaneContentRef> Refs;
+	TArray<int32> FreeIds;
+
+	/** Contacts found this frame; dispatched after the loop since handlers unregister records */
+	TArray<TPair<int32, EContact>> PendingContacts;
+
+	/** Player X last frame, so fast movement sweeps through thin content instead of skipping it */
+	float LastPlayerX = 0.0f;
+	bool bHasLastPlayerX = false;
+
+	/** Moves longer than this in one frame are teleports (respawn, new run) and aren't swept */
+	static constexpr float MaxSweepDistance = 1000.0f;
+};
@@ -0,0 +1,470 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LocalRunGenerator.h"
+#include "ContentRegistry.h"
+#include "ContentExporter.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace LocalRunRules
+{
+	// Mirrors Backend/config/game.php ('tracks' and 'difficulty')
+	static constexpr int32 TierCount = 3;
+	static constexpr int32 TracksPerTier = 3;
+	static constexpr int32 TierLengthMin[] = { 500, 500, 600, 1000 };
+	static constexpr int32 TierLengthMax[] = { 600, 600, 800, 1500 };
+	static constexpr int32 ShopCountMin = 1;
+	static constexpr int32 ShopCountMax = 2;
+	static constexpr double ShopPositionMin = 0.5;
+	static constexpr double ShopPositionMax = 0.7;
+	static constexpr int32 ShopItemCountMin = 3;
+	static constexpr int32 ShopItemCountMax = 5;
+	static constexpr int32 BossRewardCountMin = 3;
+	static constexpr int32 BossRewardCountMax = 5;
+
+	/** Seed offset RunSeedService uses for boss rewards */
+	static constexpr int64 BossRewardSeedOffset = 100;
+
+	/** Game units per meter (track lengths are in meters) */
+	static constexpr double UnitsPerMeter = 800.0;
+}
+
+// ---------------------------------------------------------------------------
+// FPhpMtRand (ext/standard/mt_rand.c)
+// ---------------------------------------------------------------------------
+
+void FPhpMtRand::Seed(uint32 InSeed)
+{
+	State[0] = InSeed;
+	for (int32 i = 1; i < N; ++i)
+	{
+		State[i] = 1812433253U * (State[i - 1] ^ (State[i - 1] >> 30)) + static_cast<uint32>(i);
+	}
+	Reload();
+}
+
+void FPhpMtRand::Reload()
+{
+	auto Twist = [](uint32 Mv, uint32 U, uint32 V) -> uint32
+	{
+		const uint32 Mixed = (U & 0x80000000U) | (V & 0x7FFFFFFFU);
+		return Mv ^ (Mixed >> 1) ^ (static_cast<uint32>(-static_cast<int32>(V & 0x1U)) & 0x9908B0DFU);
+	};
+
+	int32 i = 0;
+	for (; i < N - M; ++i) State[i] = Twist(State[i + M], State[i], State[i + 1]);
+	for (; i < N - 1; ++i) State[i] = Twist(State[i + M - N], State[i], State[i + 1]);
+	State[N - 1] = Twist(State[M - 1], State[N - 1], State[0]);
+
+	Left = N;
+	NextIndex = 0;
+}
+
+uint32 FPhpMtRand::Next()
+{
+	if (Left == 0) Reload();
+	--Left;
+
+	uint32 S1 = State[NextIndex++];
+	S1 ^= (S1 >> 11);
+	S1 ^= (S1 << 7) & 0x9D2C5680U;
+	S1 ^= (S1 << 15) & 0xEFC60000U;
+	return S1 ^ (S1 >> 18);
+}
+
+uint32 FPhpMtRand::RandRange32(uint32 UMax)
+{
+	uint32 Result = Next();
+	if (UMax == MAX_uint32) return Result;
+
+	// Power of two ranges mask directly; everything else rejects the biased tail
+	UMax++;
+	if ((UMax & (UMax - 1)) == 0) return Result & (UMax - 1);
+
+	const uint32 Limit = MAX_uint32 - (MAX_uint32 % UMax) - 1;
+	while (Result > Limit) Result = Next();
+	return Result % UMax;
+}
+
+int64 FPhpMtRand::RandRange(int64 Min, int64 Max)
+{
+	// RunSeedService never asks for ranges wider than 32 bits
+	const uint64 UMax = static_cast<uint64>(Max) - static_cast<uint64>(Min);
+	return static_cast<int64>(RandRange32(static_cast<uint32>(FMath::Min<uint64>(UMax, MAX_uint32)))) + Min;
+}
+
+// ---------------------------------------------------------------------------
+// ULocalRunGenerator
+// ---------------------------------------------------------------------------
+
+bool ULocalRunGenerator::BuildFromRegistry(UContentRegistry* Registry, const FString& Version)
+{
+	if (!Registry) return false;
+
+	UContentExporter* Exporter = NewObject<UContentExporter>(this);
+	return LoadFromJson(Exporter->ExportToJson(Registry, Version));
+}
+
+bool ULocalRunGenerator::LoadFromJson(const FString& JsonString)
+{
+	Definitions.Empty();
+	DefinitionIndexById.Empty();
+	ContentVersion.Empty();
+
+	TSharedPtr<FJsonObject> RootObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("LocalRunGenerator: Failed to parse content JSON"));
+		return false;
+	}
+
+	ContentVersion = RootObject->GetStringField(TEXT("version"));
+
+	const TArray<TSharedPtr<FJsonValue>>* DefinitionsArray;
+	if (!RootObject->TryGetArrayField(TEXT("definitions"), DefinitionsArray)) return false;
+
+	for (const TSharedPtr<FJsonValue>& DefValue : *DefinitionsArray)
+	{
+		if (DefValue->Type != EJson::Object) continue;
+		TSharedPtr<FJsonObject> DefObj = DefValue->AsObject();
+
+		FContentEntry Entry;
+		Entry.ContentId = DefObj->GetStringField(TEXT("content_id"));
+		Entry.Name = DefObj->GetStringField(TEXT("name"));
+		Entry.Type = DefObj->GetStringField(TEXT("type"));
+
+		const TSharedPtr<FJsonObject>* PropsObj;
+		if (DefObj->TryGetObjectField(TEXT("properties"), PropsObj) && PropsObj->IsValid())
+		{
+			const TSharedPtr<FJsonObject>& Props = *PropsObj;
+
+			FString PieceType = TEXT("normal");
+			Props->TryGetStringField(TEXT("piece_type"), PieceType);
+			Entry.PieceType = PieceType.TrimStartAndEnd().ToLower();
+
+			Props->TryGetNumberField(TEXT("length"), Entry.Length);
+			Props->TryGetNumberField(TEXT("base_cost"), Entry.BaseCost);
+			Props->TryGetBoolField(TEXT("can_be_boss_reward"), Entry.bCanBeBossReward);
+			Props->TryGetStringArrayField(TEXT("allowed_classes"), Entry.AllowedClasses);
+			Props->TryGetStringArrayField(TEXT("difficulty_availability"), Entry.DifficultyAvailability);
+
+			const TArray<TSharedPtr<FJsonValue>>* SpawnConfigsArray;
+			if (Props->TryGetArrayField(TEXT("spawn_configs"), SpawnConfigsArray))
+			{
+				for (const TSharedPtr<FJsonValue>& ConfigValue : *SpawnConfigsArray)
+				{
+					if (ConfigValue->Type != EJson::Object) continue;
+					TSharedPtr<FJsonObject> ConfigObj = ConfigValue->AsObject();
+
+					FSpawnConfigEntry Config;
+					ConfigObj->TryGetStringField(TEXT("component_name"), Config.ComponentName);
+					ConfigObj->TryGetNumberField(TEXT("probability"), Config.Probability);
+
+					const TArray<TSharedPtr<FJsonValue>>* WeightedArray;
+					if (ConfigObj->TryGetArrayField(TEXT("weighted_definitions"), WeightedArray))
+					{
+						for (const TSharedPtr<FJsonValue>& WValue : *WeightedArray)
+						{
+							if (WValue->Type != EJson::Object) continue;
+							TSharedPtr<FJsonObject> WObj = WValue->AsObject();
+							double Weight = 1.0;
+							WObj->TryGetNumberField(TEXT("weight"), Weight);
+							Config.WeightedDefinitions.Emplace(WObj->GetStringField(TEXT("id")), Weight);
+						}
+					}
+					Entry.SpawnConfigs.Add(MoveTemp(Config));
+				}
+			}
+
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Prop : Props->Values)
+			{
+				if (Prop.Value->Type == EJson::String) Entry.Properties.Add(Prop.Key, Prop.Value->AsString());
+				else if (Prop.Value->Type == EJson::Number) Entry.Properties.Add(Prop.Key, FString::Printf(TEXT("%f"), Prop.Value->AsNumber()));
+				else if (Prop.Value->Type == EJson::Boolean) Entry.Properties.Add(Prop.Key, Prop.Value->AsBool() ? TEXT("true") : TEXT("false"));
+			}
+		}
+
+		if (!DefinitionIndexById.Contains(Entry.ContentId))
+		{
+			DefinitionIndexById.Add(Entry.ContentId, Definitions.Num());
+		}
+		Definitions.Add(MoveTemp(Entry));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("LocalRunGenerator: Loaded %d definitions (content version %s)"), Definitions.Num(), *ContentVersion);
+	return Definitions.Num() > 0;
+}
+
+void ULocalRunGenerator::BeginRun(int32 InSeed, EPlayerClass InPlayerClass, const FString& InSeedId)
+{
+	Seed = InSeed;
+	SeedId = InSeedId;
+	PlayerClassName = FPlayerClassData::PlayerClassToString(InPlayerClass);
+	bRunActive = true;
+
+	TierTracks.Empty();
+	for (int32 Tier = 1; Tier <= LocalRunRules::TierCount; ++Tier)
+	{
+		TierTracks.Add(Tier, GenerateTierTrackInfos(Tier));
+	}
+}
+
+FTrackSelectionData ULocalRunGenerator::GetTierTracks(int32 Tier) const
+{
+	FTrackSelectionData SelectionData;
+	SelectionData.SeedId = SeedId;
+	SelectionData.Seed = Seed;
+	SelectionData.ContentVersion = ContentVersion;
+	SelectionData.Tier = Tier;
+	if (const TArray<FTrackInfo>* Tracks = TierTracks.Find(Tier)) SelectionData.Tracks = *Tracks;
+	return SelectionData;
+}
+
+const ULocalRunGenerator::FContentEntry* ULocalRunGenerator::FindDefinition(const FString& ContentId) const
+{
+	const int32* Index = DefinitionIndexById.Find(ContentId);
+	return Index ? &Definitions[*Index] : nullptr;
+}
+
+bool ULocalRunGenerator::IsAllowedForClass(const FContentEntry& Entry) const
+{
+	return Entry.AllowedClasses.Num() == 0 || Entry.AllowedClasses.Contains(PlayerClassName);
+}
+
+void ULocalRunGenerator::CollectTrackPieces(const FString& PieceType, TArray<const FContentEntry*>& OutPieces) const
+{
+	OutPieces.Reset();
+	for (const FContentEntry& Entry : Definitions)
+	{
+		if (Entry.Type == TEXT("track_piece") && Entry.PieceType == PieceType) OutPieces.Add(&Entry);
+	}
+}
+
+TArray<FTrackInfo> ULocalRunGenerator::GenerateTierTrackInfos(int32 Tier) const
+{
+	FPhpMtRand Rng(static_cast<uint32>(static_cast<int64>(Seed) + Tier));
+
+	const int32 LengthIndex = (Tier >= 1 && Tier <= LocalRunRules::TierCount) ? Tier : 0;
+
+	TArray<const FContentEntry*> Bosses;
+	CollectTrackPieces(TEXT("boss"), Bosses);
+
+	FString BossId = TEXT("Boss_Generic");
+	if (Bosses.Num() > 0)
+	{
+		BossId = Bosses[Rng.RandRange(0, Bosses.Num() - 1)]->ContentId;
+	}
+
+	TArray<FTrackInfo> Tracks;
+	for (int32 i = 0; i < LocalRunRules::TracksPerTier; ++i)
+	{
+		FTrackInfo TrackInfo;
+		TrackInfo.Id = i;
+		TrackInfo.Length = static_cast<int32>(Rng.RandRange(LocalRunRules::TierLengthMin[LengthIndex], LocalRunRules::TierLengthMax[LengthIndex]));
+		TrackInfo.ShopCount = static_cast<int32>(Rng.RandRange(LocalRunRules::ShopCountMin, LocalRunRules::ShopCountMax));
+		TrackInfo.BossId = BossId;
+		Tracks.Add(TrackInfo);
+	}
+	return Tracks;
+}
+
+FTrackPiecePrescription ULocalRunGenerator::PrescribeSpawns(const FContentEntry& Piece, FTrackSequenceData& SequenceData, FPhpMtRand& Rng) const
+{
+	FTrackPiecePrescription Prescription;
+	Prescription.PieceId = FName(*Piece.ContentId);
+
+	for (const FSpawnConfigEntry& Config : Piece.SpawnConfigs)
+	{
+		if (Config.ComponentName.IsEmpty()) continue;
+
+		// Probability roll (empty slot is sent as null, which the client parser drops)
+		if (Rng.RandRange(0, 1000) / 1000.0 > Config.Probability) continue;
+
+		TArray<const TPair<FString, double>*> Valid;
+		double TotalWeight = 0.0;
+		for (const TPair<FString, double>& WD : Config.WeightedDefinitions)
+		{
+			const FContentEntry* Def = FindDefinition(WD.Key);
+			if (!Def || !IsAllowedForClass(*Def)) continue;
+			Valid.Add(&WD);
+			TotalWeight += WD.Value;
+		}
+
+		if (TotalWeight > 0.0)
+		{
+			const double Roll = Rng.RandRange(0, static_cast<int64>(TotalWeight * 1000)) / 1000.0;
+			double Current = 0.0;
+			for (const TPair<FString, double>* WD : Valid)
+			{
+				Current += WD->Value;
+				if (Roll <= Current)
+				{
+					SequenceData.AddSpawn(Prescription, Config.ComponentName, WD->Key);
+					break;
+				}
+			}
+		}
+	}
+
+	return Prescription;
+}
+
+FTrackSequenceData ULocalRunGenerator::GenerateTrackSequence(int32 Tier, int32 TrackIndex) const
+{
+	FTrackSequenceData SequenceData;
+
+	const TArray<FTrackInfo>* Tracks = TierTracks.Find(Tier);
+	if (!bRunActive || !Tracks || !Tracks->IsValidIndex(TrackIndex))
+	{
+		UE_LOG(LogTemp, Error, TEXT("LocalRunGenerator: Invalid track selection (Tier %d, Track %d)"), Tier, TrackIndex);
+		return SequenceData;
+	}
+
+	const FTrackInfo& Track = (*Tracks)[TrackIndex];
+	SequenceData.BossId = Track.BossId;
+	SequenceData.Length = Track.Length;
+	SequenceData.ShopCount = Track.ShopCount;
+
+	FPhpMtRand Rng(static_cast<uint32>(static_cast<int64>(Seed) + Tier + TrackIndex));
+	double CurrentLength = 0.0;
+
+	TArray<const FContentEntry*> Pool;
+	CollectTrackPieces(TEXT("start"), Pool);
+	if (Pool.Num() > 0)
+	{
+		const FContentEntry* Piece = Pool[Rng.RandRange(0, Pool.Num() - 1)];
+		SequenceData.Pieces.Add(PrescribeSpawns(*Piece, SequenceData, Rng));
+		CurrentLength += Piece->Length / LocalRunRules::UnitsPerMeter;
+	}
+
+	CollectTrackPieces(TEXT("normal"), Pool);
+	if (Pool.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LocalRunGenerator: No normal pieces found! Sequence will be empty."));
+		SequenceData.Pieces.Empty();
+		return SequenceData;
+	}
+
+	while (CurrentLength < Track.Length)
+	{
+		const FContentEntry* Piece = Pool[Rng.RandRange(0, Pool.Num() - 1)];
+		SequenceData.Pieces.Add(PrescribeSpawns(*Piece, SequenceData, Rng));
+		CurrentLength += Piece->Length / LocalRunRules::UnitsPerMeter;
+	}
+
+	CollectTrackPieces(TEXT("shop"), Pool);
+	if (Pool.Num() > 0)
+	{
+		for (int32 s = 0; s < Track.ShopCount; ++s)
+		{
+			const double Progress = LocalRunRules::ShopPositionMin + ((LocalRunRules::ShopPositionMax - LocalRunRules::ShopPositionMin) * (static_cast<double>(s) / FMath::Max(1, Track.ShopCount - 1)));
+			int32 Pos = static_cast<int32>(SequenceData.Pieces.Num() * Progress);
+
+			// Don't overwrite the very first (Start) or very last (Normal) piece if possible
+			if (Pos <= 0) Pos = 1;
+			if (Pos >= SequenceData.Pieces.Num()) Pos = SequenceData.Pieces.Num() - 1;
+
+			while (SequenceData.ShopPositions.Contains(Pos)) Pos++;
+
+			if (Pos < SequenceData.Pieces.Num())
+			{
+				SequenceData.ShopPositions.Add(Pos);
+				const FContentEntry* Piece = Pool[Rng.RandRange(0, Pool.Num() - 1)];
+				SequenceData.Pieces[Pos] = PrescribeSpawns(*Piece, SequenceData, Rng);
+			}
+		}
+	}
+
+	if (const FContentEntry* BossPiece = FindDefinition(Track.BossId))
+	{
+		SequenceData.Pieces.Add(PrescribeSpawns(*BossPiece, SequenceData, Rng));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LocalRunGenerator: Boss piece %s not found!"), *Track.BossId);
+	}
+
+	for (int32 s = 0; s < Track.ShopCount; ++s)
+	{
+		SequenceData.AllShopsData.Add(GenerateShopItems(Tier, TrackIndex, s));
+	}
+	SequenceData.BossRewards = GenerateBossRewards(Tier);
+
+	UE_LOG(LogTemp, Log, TEXT("LocalRunGenerator: Generated sequence with %d pieces (Tier %d, Track %d)"), SequenceData.Pieces.Num(), Tier, TrackIndex);
+	return SequenceData;
+}
+
+TArray<const ULocalRunGenerator::FContentEntry*> ULocalRunGenerator::PickWithoutReplacement(TArray<const FContentEntry*> Candidates, int32 Count, FPhpMtRand& Rng) const
+{
+	if (Candidates.Num() <= Count) return Candidates;
+
+	TArray<const FContentEntry*> Selected;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const int32 Index = static_cast<int32>(Rng.RandRange(0, Candidates.Num() - 1));
+		Selected.Add(Candidates[Index]);
+		Candidates.RemoveAt(Index);
+	}
+	return Selected;
+}
+
+FShopData ULocalRunGenerator::GenerateShopItems(int32 Tier, int32 TrackIndex, int32 ShopIndex) const
+{
+	FShopData ShopData;
+	FPhpMtRand Rng(static_cast<uint32>(static_cast<int64>(Seed) + Tier + TrackIndex + ShopIndex));
+	const int32 ItemCount = static_cast<int32>(Rng.RandRange(LocalRunRules::ShopItemCountMin, LocalRunRules::ShopItemCountMax));
+
+	const FString TierName = FString::Printf(TEXT("T%d"), Tier);
+	TArray<const FContentEntry*> Available;
+	for (const FContentEntry& Entry : Definitions)
+	{
+		if (Entry.Type == TEXT("shop_item") && Entry.DifficultyAvailability.Contains(TierName) && IsAllowedForClass(Entry)) Available.Add(&Entry);
+	}
+
+	if (Available.Num() == 0)
+	{
+		for (const FContentEntry& Entry : Definitions) if (Entry.Type == TEXT("shop_item")) Available.Add(&Entry);
+	}
+
+	for (const FContentEntry* Item : PickWithoutReplacement(Available, ItemCount, Rng))
+	{
+		FShopItemData ItemData;
+		ItemData.Id = Item->ContentId;
+		ItemData.Name = Item->Name;
+		ItemData.Cost = static_cast<int32>(Item->BaseCost * (1 + (Tier - 1) * 0.5));
+		ItemData.Properties = Item->Properties;
+		ShopData.Items.Add(ItemData);
+	}
+	return ShopData;
+}
+
+TArray<FBossRewardData> ULocalRunGenerator::GenerateBossRewards(int32 Tier) const
+{
+	TArray<FBossRewardData> Rewards;
+	FPhpMtRand Rng(static_cast<uint32>(static_cast<int64>(Seed) + Tier + LocalRunRules::BossRewardSeedOffset));
+	const int32 RewardCount = static_cast<int32>(Rng.RandRange(LocalRunRules::BossRewardCountMin, LocalRunRules::BossRewardCountMax));
+
+	const FString TierName = FString::Printf(TEXT("T%d"), Tier);
+	TArray<const FContentEntry*> Available;
+	for (const FContentEntry& Entry : Definitions)
+	{
+		if (Entry.Type == TEXT("shop_item") && Entry.bCanBeBossReward && Entry.DifficultyAvailability.Contains(TierName) && IsAllowedForClass(Entry)) Available.Add(&Entry);
+	}
+
+	if (Available.Num() == 0)
+	{
+		for (const FContentEntry& Entry : Definitions) if (Entry.Type == TEXT("shop_item") && Entry.bCanBeBossReward) Available.Add(&Entry);
+	}
+
+	for (const FContentEntry* Item : PickWithoutReplacement(Available, RewardCount, Rng))
+	{
+		FBossRewardData Reward;
+		Reward.Id = Item->ContentId;
+		Reward.Name = Item->Name;
+		Reward.Properties = Item->Properties;
+		Rewards.Add(Reward);
+	}
+	return Rewards;
+}
@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "PlayerClass.h"
+#include "WebServerInterface.h"
+#include "LocalRunGenerator.generated.h"
+
+class UContentRegistry;
+
+/**
+ * Bit-exact port of PHP's mt_srand()/mt_rand() (MT19937, MT_RAND_MT19937 mode).
+ * RunSeedService draws every decision from this generator, so matching it is what
+ * lets the client reproduce a server run from its seed.
+ */
+struct SEWERSCUTTLE_API FPhpMtRand
+{
+public:
+	FPhpMtRand() { Seed(0); }
+	explicit FPhpMtRand(uint32 InSeed) { Seed(InSeed); }
+
+	/** Equivalent of mt_srand($Seed) (PHP truncates the seed to 32 bits) */
+	void Seed(uint32 InSeed);
+
+	/** Equivalent of mt_rand($Min, $Max) */
+	int64 RandRange(int64 Min, int64 Max);
+
+private:
+	static constexpr int32 N = 624;
+	static constexpr int32 M = 397;
+
+	uint32 Next();
+	uint32 RandRange32(uint32 UMax);
+	void Reload();
+
+	uint32 State[N];
+	int32 Left = 0;
+	int32 NextIndex = 0;
+};
+
+/**
+ * Generates tier tracks, piece sequences, shops and boss rewards on the client
+ * Mirrors the rules in Backend/app/Services/RunSeedService.php, fed from the same JSON that UContentExporter produces
+ */
+UCLASS()
+class SEWERSCUTTLE_API ULocalRunGenerator : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Build the content tables from the registry (exported exactly as the backend would import it) */
+	bool BuildFromRegistry(UContentRegistry* Registry, const FString& Version);
+
+	/** Build the content tables from an exported content JSON string */
+	bool LoadFromJson(const FString& JsonString);
+
+	/** Check if content has been loaded */
+	bool HasContent() const { return Definitions.Num() > 0; }
+
+	/** Content version of the loaded content (compare against the server's content_version) */
+	const FString& GetContentVersion() const { return ContentVersion; }
+
+	/** Begin a run with a known seed (e.g. the one returned by /runs/start, or a local one for practice runs) */
+	void BeginRun(int32 InSeed, EPlayerClass InPlayerClass, const FString& InSeedId = FString());
+
+	/** Check if a run is active */
+	bool IsRunActive() const { return bRunActive; }
+
+	/** Get track choices for a tier (equivalent of GET /runs/{seed}/tier/{tier}) */
+	FTrackSelectionData GetTierTracks(int32 Tier) const;
+
+	/** Generate the sequence for a selected track (equivalent of POST /runs/{seed}/select-track) */
+	FTrackSequenceData GenerateTrackSequence(int32 Tier, int32 TrackIndex) const;
+
+	/** Generate shop items for one shop on a track */
+	FShopData GenerateShopItems(int32 Tier, int32 TrackIndex, int32 ShopIndex) const;
+
+	/** Generate boss reward options for a tier */
+	TArray<FBossRewardData> GenerateBossRewards(int32 Tier) const;
+
+private:
+	struct FSpawnConfigEntry
+	{
+		FString ComponentName;
+		double Probability = 1.0;
+		TArray<TPair<FString, double>> WeightedDefinitions;
+	};
+
+	struct FContentEntry
+	{
+		FString ContentId;
+		FString Name;
+		FString Type;
+
+		/** Lowercased, trimmed piece_type (track pieces only) */
+		FString PieceType;
+		double Length = 1600.0;
+		TArray<FSpawnConfigEntry> SpawnConfigs;
+
+		TArray<FString> AllowedClasses;
+		TArray<FString> DifficultyAvailability;
+		bool bCanBeBossReward = false;
+		double BaseCost = 100.0;
+
+		/** Scalar properties flattened the way UWebServerInterface parses them */
+		TMap<FString, FString> Properties;
+	};
+
+	const FContentEntry* FindDefinition(const FString& ContentId) const;
+	bool IsAllowedForClass(const FContentEntry& Entry) const;
+	void CollectTrackPieces(const FString& PieceType, TArray<const FContentEntry*>& OutPieces) const;
+
+	TArray<FTrackInfo> GenerateTierTrackInfos(int32 Tier) const;
+	FTrackPiecePrescription PrescribeSpawns(const FContentEntry& Piece, FTrackSequenceData& SequenceData, FPhpMtRand& Rng) const;
+	TArray<const FContentEntry*> PickWithoutReplacement(TArray<const FContentEntry*> Candidates, int32 Count, FPhpMtRand& Rng) const;
+
+	/** Definitions in export order (the backend's row order after import) */
+	TArray<FContentEntry> Definitions;
+
+	/** First definition index per content_id */
+	TMap<FString, int32> DefinitionIndexById;
+
+	FString ContentVersion;
+
+	int32 Seed = 0;
+	FString SeedId;
+	FString PlayerClassName = TEXT("Vanilla");
+	bool bRunActive = false;
+
+	/** Tracks per tier, generated once in BeginRun */
+	TMap<int32, TArray<FTrackInfo>> TierTracks;
+};
@@ -0,0 +1,585 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MockBackendServer.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "ConfigManager.h"
+#include "ContentRegistry.h"
+#include "HttpServerModule.h"
+#include "HttpServerConstants.h"
+#include "HttpPath.h"
+#include "IHttpRouter.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Guid.h"
+#include "Modules/ModuleManager.h"
+#include "HAL/IConsoleManager.h"
+
+FMockBackendServer* FMockBackendServer::Instance = nullptr;
+
+/** Laravel's validation failure status; EHttpServerResponseCodes has no entry for it */
+static constexpr EHttpServerResponseCodes UnprocessableEntity = static_cast<EHttpServerResponseCodes>(422);
+
+static FAutoConsoleCommand MockBackendStartCommand(
+	TEXT("SewerScuttle.MockBackend.Start"),
+	TEXT("Start the in-process mock backend"),
+	FConsoleCommandDelegate::CreateLambda([]() { FMockBackendServer::Get().StartServer(); }));
+
+static FAutoConsoleCommand MockBackendStopCommand(
+	TEXT("SewerScuttle.MockBackend.Stop"),
+	TEXT("Stop the in-process mock backend"),
+	FConsoleCommandDelegate::CreateLambda([]() { FMockBackendServer::Get().StopServer(); }));
+
+static FAutoConsoleCommand MockBackendFaultsCommand(
+	TEXT("SewerScuttle.MockBackend.Faults"),
+	TEXT("Set mock backend fault injection: <LatencyMs> <JitterMs> <FailureRate 0-1>"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Latency = Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 0;
+		const int32 Jitter = Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 0;
+		const float Failure = Args.IsValidIndex(2) ? FCString::Atof(*Args[2]) : 0.0f;
+		FMockBackendServer::Get().SetFaultProfile(Latency, Jitter, Failure);
+	}));
+
+FMockBackendServer::FMockBackendServer()
+{
+	FaultStream.GenerateNewSeed();
+}
+
+FMockBackendServer::~FMockBackendServer()
+{
+	StopServer();
+}
+
+FMockBackendServer& FMockBackendServer::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FMockBackendServer();
+	}
+	return *Instance;
+}
+
+bool FMockBackendServer::StartServer()
+{
+	if (bIsRunning)
+	{
+		return true;
+	}
+
+	const UConfigManager* Config = UConfigManager::Get();
+	ServerPort = Config->GetMockBackendPort();
+	SetFaultProfile(Config->GetMockLatencyMs(), Config->GetMockJitterMs(), Config->GetMockFailureRate());
+
+	if (!LoadContent())
+	{
+		UE_LOG(LogTemp, Error, TEXT("MockBackend: No content available, cannot start"));
+		return false;
+	}
+
+	if (!FModuleManager::Get().ModuleExists(TEXT("HTTPServer")))
+	{
+		UE_LOG(LogTemp, Error, TEXT("MockBackend: HTTPServer module not available"));
+		return false;
+	}
+	FHttpServerModule& HttpServerModule = FModuleManager::LoadModuleChecked<FHttpServerModule>(TEXT("HTTPServer"));
+
+	HttpRouter = HttpServerModule.GetHttpRouter(ServerPort);
+	if (!HttpRouter)
+	{
+		UE_LOG(LogTemp, Error, TEXT("MockBackend: Failed to create HTTP router on port %d"), ServerPort);
+		return false;
+	}
+
+	RegisterRoutes();
+	HttpServerModule.StartAllListeners();
+
+	RequestCount = 0;
+	InjectedFailureCount = 0;
+	bIsRunning = true;
+	UE_LOG(LogTemp, Log, TEXT("MockBackend: Listening on http://localhost:%d/api (content %s)"), ServerPort, *Generator->GetContentVersion());
+	return true;
+}
+
+void FMockBackendServer::StopServer()
+{
+	if (!bIsRunning)
+	{
+		return;
+	}
+
+	UnregisterRoutes();
+	HttpRouter.Reset();
+	bIsRunning = false;
+
+	UE_LOG(LogTemp, Log, TEXT("MockBackend: Stopped after %d requests (%d injected failures)"), RequestCount, InjectedFailureCount);
+}
+
+void FMockBackendServer::SetFaultProfile(int32 InLatencyMs, int32 InJitterMs, float InFailureRate)
+{
+	LatencyMs = FMath::Max(0, InLatencyMs);
+	JitterMs = FMath::Max(0, InJitterMs);
+	FailureRate = FMath::Clamp(InFailureRate, 0.0f, 1.0f);
+	UE_LOG(LogTemp, Log, TEXT("MockBackend: Latency %dms +/- %dms, failure rate %.2f"), LatencyMs, JitterMs, FailureRate);
+}
+
+bool FMockBackendServer::LoadContent()
+{
+	if (!Generator.IsValid())
+	{
+		Generator.Reset(NewObject<ULocalRunGenerator>());
+	}
+
+	// Prefer the recorded export the backend imports, so the mock serves exactly what the server would
+	FString RecordedJson;
+	const FString RecordedPath = FPaths::ProjectDir() / TEXT("Backend/storage/app/content/latest.json");
+	if (FFileHelper::LoadFileToString(RecordedJson, *RecordedPath) && Generator->LoadFromJson(RecordedJson))
+	{
+		return true;
+	}
+
+	UContentRegistry* Registry = NewObject<UContentRegistry>();
+	Registry->GatherContent();
+	return Generator->BuildFromRegistry(Registry, UConfigManager::Get()->GetContentVersion());
+}
+
+bool FMockBackendServer::BeginRun(const FString& SeedId)
+{
+	const FMockRun* Run = Runs.Find(SeedId);
+	if (!Run)
+	{
+		return false;
+	}
+	Generator->BeginRun(Run->Seed, Run->PlayerClass, SeedId);
+	return true;
+}
+
+void FMockBackendServer::RegisterRoutes()
+{
+	auto Bind = [this](const TCHAR* Path, EHttpServerRequestVerbs Verb, bool (FMockBackendServer::*Handler)(const FHttpServerRequest&, const FHttpResultCallback&))
+	{
+		RouteHandles.Add(HttpRouter->BindRoute(FHttpPath(Path), Verb, FHttpRequestHandler::CreateRaw(this, Handler)));
+	};
+
+	Bind(TEXT("/api/runs/start"), EHttpServerRequestVerbs::VERB_POST, &FMockBackendServer::HandleStartRun);
+	Bind(TEXT("/api/runs/:seed_id/tier/:tier"), EHttpServerRequestVerbs::VERB_GET, &FMockBackendServer::HandleGetTierTracks);
+	Bind(TEXT("/api/runs/:seed_id/select-track"), EHttpServerRequestVerbs::VERB_POST, &FMockBackendServer::HandleSelectTrack);
+	Bind(TEXT("/api/runs/:seed_id/shop/:tier/:track_index/:shop_index"), EHttpServerRequestVerbs::VERB_GET, &FMockBackendServer::HandleGetShopItems);
+	Bind(TEXT("/api/runs/:seed_id/boss-rewards/:tier"), EHttpServerRequestVerbs::VERB_GET, &FMockBackendServer::HandleGetBossRewards);
+	Bind(TEXT("/api/runs"), EHttpServerRequestVerbs::VERB_POST, &FMockBackendServer::HandleSubmitRun);
+	Bind(TEXT("/api/runs/:run/replay"), EHttpServerRequestVerbs::VERB_GET, &FMockBackendServer::HandleGetReplay);
+	Bind(TEXT("/api/leaderboard"), EHttpServerRequestVerbs::VERB_GET, &FMockBackendServer::HandleGetLeaderboard);
+	Bind(TEXT("/api/me"), EHttpServerRequestVerbs::VERB_GET, &FMockBackendServer::HandleGetMe);
+}
+
+void FMockBackendServer::UnregisterRoutes()
+{
+	if (HttpRouter)
+	{
+		for (const FHttpRouteHandle& Handle : RouteHandles)
+		{
+			HttpRouter->UnbindRoute(Handle);
+		}
+	}
+	RouteHandles.Empty();
+}
+
+// ============================================================================
+// Route Handlers
+// ============================================================================
+
+bool FMockBackendServer::HandleStartRun(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TSharedPtr<FJsonObject> Body;
+	FString PlayerClass = TEXT("Vanilla");
+	if (ParseRequestBody(Request, Body)) Body->TryGetStringField(TEXT("player_class"), PlayerClass);
+
+	FMockRun Run;
+	Run.Seed = FMath::RandRange(1, 2147483647);
+	Run.PlayerClass = FPlayerClassData::StringToPlayerClass(PlayerClass);
+
+	const FString SeedId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+	Runs.Add(SeedId, Run);
+	BeginRun(SeedId);
+
+	Respond(OnComplete, MakeShared<FJsonValueObject>(TrackSelectionToJson(Generator->GetTierTracks(1))));
+	return true;
+}
+
+bool FMockBackendServer::HandleGetTierTracks(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	const int32 Tier = GetIntPathParameter(Request, TEXT("tier"));
+	if (!BeginRun(GetPathParameter(Request, TEXT("seed_id"))) || !IsValidTier(Tier))
+	{
+		RespondError(OnComplete, TEXT("Invalid seed_id or tier"), EHttpServerResponseCodes::NotFound);
+		return true;
+	}
+
+	Respond(OnComplete, MakeShared<FJsonValueObject>(TrackSelectionToJson(Generator->GetTierTracks(Tier))));
+	return true;
+}
+
+bool FMockBackendServer::HandleSelectTrack(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TSharedPtr<FJsonObject> Body;
+	if (!ParseRequestBody(Request, Body) || !Body->HasField(TEXT("tier")) || !Body->HasField(TEXT("track_index")))
+	{
+		RespondError(OnComplete, TEXT("The tier and track_index fields are required."), EHttpServerResponseCodes::BadRequest);
+		return true;
+	}
+
+	const int32 Tier = Body->GetIntegerField(TEXT("tier"));
+	const int32 TrackIndex = Body->GetIntegerField(TEXT("track_index"));
+	if (!BeginRun(GetPathParameter(Request, TEXT("seed_id"))) || Generator->GetTierTracks(Tier).Tracks.Num() <= TrackIndex || TrackIndex < 0)
+	{
+		RespondError(OnComplete, TEXT("Invalid selection"), EHttpServerResponseCodes::NotFound);
+		return true;
+	}
+
+	const FTrackSequenceData Sequence = Generator->GenerateTrackSequence(Tier, TrackIndex);
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+
+	TArray<TSharedPtr<FJsonValue>> PiecesJson;
+	for (const FTrackPiecePrescription& Piece : Sequence.Pieces)
+	{
+		TSharedPtr<FJsonObject> PieceObj = MakeShared<FJsonObject>();
+		PieceObj->SetStringField(TEXT("id"), Piece.PieceId.ToString());
+		TSharedPtr<FJsonObject> SpawnsObj = MakeShared<FJsonObject>();
+		for (const FPrescribedSpawn& Spawn : Piece.Spawns) SpawnsObj->SetStringField(Spawn.SlotName.ToString(), Sequence.DefinitionIds[Spawn.DefinitionIndex].ToString());
+		PieceObj->SetObjectField(TEXT("spawns"), SpawnsObj);
+		PiecesJson.Add(MakeShared<FJsonValueObject>(PieceObj));
+	}
+	JsonObject->SetArrayField(TEXT("pieces"), PiecesJson);
+
+	TArray<TSharedPtr<FJsonValue>> ShopPositionsJson;
+	for (int32 Pos : Sequence.ShopPositions) ShopPositionsJson.Add(MakeShared<FJsonValueNumber>(Pos));
+	JsonObject->SetArrayField(TEXT("shop_positions"), ShopPositionsJson);
+
+	JsonObject->SetStringField(TEXT("boss_id"), Sequence.BossId);
+	JsonObject->SetNumberField(TEXT("length"), Sequence.Length);
+	JsonObject->SetNumberField(TEXT("shop_count"), Sequence.ShopCount);
+
+	TArray<TSharedPtr<FJsonValue>> AllShopsJson;
+	for (const FShopData& Shop : Sequence.AllShopsData) AllShopsJson.Add(MakeShared<FJsonValueObject>(ShopToJson(Shop)));
+	JsonObject->SetArrayField(TEXT("all_shop_items"), AllShopsJson);
+	JsonObject->SetArrayField(TEXT("boss_rewards"), BossRewardsToJson(Sequence.BossRewards));
+
+	Respond(OnComplete, MakeShared<FJsonValueObject>(JsonObject));
+	return true;
+}
+
+bool FMockBackendServer::HandleGetShopItems(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	const int32 Tier = GetIntPathParameter(Request, TEXT("tier"));
+	if (!BeginRun(GetPathParameter(Request, TEXT("seed_id"))) || !IsValidTier(Tier))
+	{
+		RespondError(OnComplete, TEXT("Invalid seed_id or tier"), EHttpServerResponseCodes::NotFound);
+		return true;
+	}
+
+	const FShopData Shop = Generator->GenerateShopItems(Tier, GetIntPathParameter(Request, TEXT("track_index")), GetIntPathParameter(Request, TEXT("shop_index")));
+	Respond(OnComplete, MakeShared<FJsonValueObject>(ShopToJson(Shop)));
+	return true;
+}
+
+bool FMockBackendServer::HandleGetBossRewards(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	const int32 Tier = GetIntPathParameter(Request, TEXT("tier"));
+	if (!BeginRun(GetPathParameter(Request, TEXT("seed_id"))) || !IsValidTier(Tier))
+	{
+		RespondError(OnComplete, TEXT("Invalid seed_id or tier"), EHttpServerResponseCodes::NotFound);
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetArrayField(TEXT("rewards"), BossRewardsToJson(Generator->GenerateBossRewards(Tier)));
+	Respond(OnComplete, MakeShared<FJsonValueObject>(JsonObject));
+	return true;
+}
+
+bool FMockBackendServer::HandleSubmitRun(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	// Mirrors the required fields of RunController::store so the mock rejects what the backend rejects
+	TSharedPtr<FJsonObject> Body;
+	if (!ParseRequestBody(Request, Body))
+	{
+		RespondError(OnComplete, TEXT("The seed_id field is required."), UnprocessableEntity);
+		return true;
+	}
+
+	FMockSubmittedRun Submitted;
+	if (!Body->TryGetStringField(TEXT("seed_id"), Submitted.SeedId) || Submitted.SeedId.IsEmpty())
+	{
+		RespondError(OnComplete, TEXT("The seed_id field is required."), UnprocessableEntity);
+		return true;
+	}
+
+	for (const TCHAR* Field : { TEXT("score"), TEXT("distance"), TEXT("duration_seconds") })
+	{
+		double Value = 0.0;
+		if (!Body->TryGetNumberField(Field, Value) || Value != FMath::FloorToDouble(Value))
+		{
+			RespondError(OnComplete, FString::Printf(TEXT("The %s field must be an integer."), Field), UnprocessableEntity);
+			return true;
+		}
+	}
+
+	const FMockRun* Run = Runs.Find(Submitted.SeedId);
+	if (!Run)
+	{
+		RespondError(OnComplete, TEXT("The selected seed_id is invalid."), UnprocessableEntity);
+		return true;
+	}
+
+	Submitted.RunId = NextRunId++;
+	Submitted.Seed = Run->Seed;
+	Submitted.Score = Body->GetIntegerField(TEXT("score"));
+	if (!Body->TryGetStringField(TEXT("player_class"), Submitted.PlayerClass))
+	{
+		Submitted.PlayerClass = TEXT("Vanilla");
+	}
+	Body->TryGetNumberField(TEXT("rng_version"), Submitted.RngVersion);
+	Submitted.SubmittedAt = FDateTime::UtcNow();
+	Submitted.ReplayData = Body->TryGetField(TEXT("replay_data"));
+	SubmittedRuns.Add(Submitted);
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetStringField(TEXT("message"), TEXT("Run saved"));
+	JsonObject->SetNumberField(TEXT("id"), Submitted.RunId);
+	JsonObject->SetBoolField(TEXT("is_suspicious"), false);
+	Respond(OnComplete, MakeShared<FJsonValueObject>(JsonObject), EHttpServerResponseCodes::Created);
+	return true;
+}
+
+bool FMockBackendServer::HandleGetReplay(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	const int32 RunId = GetIntPathParameter(Request, TEXT("run"));
+	const FMockSubmittedRun* Run = SubmittedRuns.FindByPredicate([RunId](const FMockSubmittedRun& R) { return R.RunId == RunId; });
+	if (!Run || !Run->ReplayData.IsValid())
+	{
+		RespondError(OnComplete, TEXT("Replay not found"), EHttpServerResponseCodes::NotFound);
+		return true;
+	}
+
+	Respond(OnComplete, Run->ReplayData);
+	return true;
+}
+
+bool FMockBackendServer::HandleGetLeaderboard(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	const FString* ClassFilter = Request.QueryParams.Find(TEXT("class"));
+	const FString* Timeframe = Request.QueryParams.Find(TEXT("timeframe"));
+
+	FTimespan MaxAge = FTimespan::MaxValue();
+	if (Timeframe && *Timeframe == TEXT("daily")) MaxAge = FTimespan::FromDays(1);
+	else if (Timeframe && *Timeframe == TEXT("weekly")) MaxAge = FTimespan::FromDays(7);
+
+	const FDateTime Now = FDateTime::UtcNow();
+	TArray<const FMockSubmittedRun*> Entries;
+	for (const FMockSubmittedRun& Run : SubmittedRuns)
+	{
+		if (ClassFilter && !ClassFilter->IsEmpty() && Run.PlayerClass != *ClassFilter) continue;
+		if (Now - Run.SubmittedAt > MaxAge) continue;
+		Entries.Add(&Run);
+	}
+	// Ties go to the earlier run, as on the real backend, so offset pages don't overlap or skip
+	Entries.Sort([](const FMockSubmittedRun& A, const FMockSubmittedRun& B) { return A.Score != B.Score ? A.Score > B.Score : A.RunId < B.RunId; });
+
+	const FString* OffsetParam = Request.QueryParams.Find(TEXT("offset"));
+	const FString* LimitParam = Request.QueryParams.Find(TEXT("limit"));
+	const int32 Offset = OffsetParam ? FMath::Max(FCString::Atoi(**OffsetParam), 0) : 0;
+	const int32 Limit = LimitParam ? FMath::Clamp(FCString::Atoi(**LimitParam), 1, 100) : 100;
+	const int32 End = FMath::Min(Offset + Limit, Entries.Num());
+
+	TArray<TSharedPtr<FJsonValue>> EntriesJson;
+	for (int32 Index = Offset; Index < End; ++Index)
+	{
+		const FMockSubmittedRun* Run = Entries[Index];
+		TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+		EntryObj->SetNumberField(TEXT("rank"), Index + 1);
+		EntryObj->SetNumberField(TEXT("run_id"), Run->RunId);
+		EntryObj->SetStringField(TEXT("player_name"), TEXT("Mock Player"));
+		EntryObj->SetNumberField(TEXT("score"), Run->Score);
+		EntryObj->SetStringField(TEXT("seed_id"), Run->SeedId);
+		EntryObj->SetNumberField(TEXT("track_seed"), Run->Seed);
+		EntryObj->SetBoolField(TEXT("has_replay"), Run->ReplayData.IsValid());
+		EntryObj->SetNumberField(TEXT("rng_version"), Run->RngVersion);
+		EntryObj->SetStringField(TEXT("player_class"), Run->PlayerClass);
+		EntriesJson.Add(MakeShared<FJsonValueObject>(EntryObj));
+	}
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetArrayField(TEXT("entries"), EntriesJson);
+	JsonObject->SetNumberField(TEXT("offset"), Offset);
+	JsonObject->SetNumberField(TEXT("limit"), Limit);
+	JsonObject->SetBoolField(TEXT("has_more"), End < Entries.Num());
+	Respond(OnComplete, MakeShared<FJsonValueObject>(JsonObject));
+	return true;
+}
+
+bool FMockBackendServer::HandleGetMe(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	// Any bearer token is accepted; the mock has a single player
+	const TArray<FString>* Authorization = Request.Headers.Find(TEXT("Authorization"));
+	if (!Authorization || !Authorization->ContainsByPredicate([](const FString& Value) { return Value.StartsWith(TEXT("Bearer ")); }))
+	{
+		RespondError(OnComplete, TEXT("Unauthenticated."), EHttpServerResponseCodes::Denied);
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> PlayerObj = MakeShared<FJsonObject>();
+	PlayerObj->SetNumberField(TEXT("id"), 1);
+	PlayerObj->SetNumberField(TEXT("user_id"), 1);
+	PlayerObj->SetStringField(TEXT("username"), TEXT("mock_player"));
+	PlayerObj->SetStringField(TEXT("display_name"), TEXT("Mock Player"));
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetNumberField(TEXT("id"), 1);
+	JsonObject->SetStringField(TEXT("name"), TEXT("Mock Player"));
+	JsonObject->SetStringField(TEXT("email"), TEXT("mock@device.local"));
+	JsonObject->SetObjectField(TEXT("player"), PlayerObj);
+	Respond(OnComplete, MakeShared<FJsonValueObject>(JsonObject));
+	return true;
+}
+
+// ============================================================================
+// Utility Functions
+// ============================================================================
+
+void FMockBackendServer::Respond(const FHttpResultCallback& OnComplete, const TSharedPtr<FJsonValue>& Body, EHttpServerResponseCodes ResponseCode)
+{
+	RequestCount++;
+
+	FString ResponseBody;
+	if (FailureRate > 0.0f && FaultStream.FRand() < FailureRate)
+	{
+		InjectedFailureCount++;
+		ResponseCode = EHttpServerResponseCodes::ServiceUnavail;
+		ResponseBody = TEXT("{\"message\":\"Injected failure\"}");
+	}
+	else
+	{
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseBody);
+		FJsonSerializer::Serialize(Body, FString(), Writer);
+	}
+
+	auto Send = [OnComplete, ResponseBody, ResponseCode]()
+	{
+		TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(ResponseBody, TEXT("application/json"));
+		Response->Code = ResponseCode;
+		OnComplete(MoveTemp(Response));
+	};
+
+	const int32 DelayMs = FMath::Max(0, LatencyMs + (JitterMs > 0 ? FaultStream.RandRange(-JitterMs, JitterMs) : 0));
+	if (DelayMs == 0)
+	{
+		Send();
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Send](float)
+	{
+		Send();
+		return false;
+	}), DelayMs / 1000.0f);
+}
+
+void FMockBackendServer::RespondError(const FHttpResultCallback& OnComplete, const FString& Message, EHttpServerResponseCodes ResponseCode)
+{
+	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetStringField(TEXT("message"), Message);
+	Respond(OnComplete, MakeShared<FJsonValueObject>(JsonObject), ResponseCode);
+}
+
+bool FMockBackendServer::ParseRequestBody(const FHttpServerRequest& Request, TSharedPtr<FJsonObject>& OutJson) const
+{
+	if (Request.Body.Num() == 0)
+	{
+		return false;
+	}
+
+	FString BodyString;
+	FFileHelper::BufferToString(BodyString, Request.Body.GetData(), Request.Body.Num());
+
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BodyString);
+	return FJsonSerializer::Deserialize(Reader, OutJson) && OutJson.IsValid();
+}
+
+FString FMockBackendServer::GetPathParameter(const FHttpServerRequest& Request, const FString& ParamName) const
+{
+	const FString* Value = Request.PathParams.Find(ParamName);
+	return Value ? *Value : FString();
+}
+
+int32 FMockBackendServer::GetIntPathParameter(const FHttpServerRequest& Request, const FString& ParamName) const
+{
+	return FCString::Atoi(*GetPathParameter(Request, ParamName));
+}
+
+TSharedPtr<FJsonObject> FMockBackendServer::TrackSelectionToJson(const FTrackSelectionData& Selection) const
+{
+	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetStringField(TEXT("seed_id"), Selection.SeedId);
+	JsonObject->SetNumberField(TEXT("seed"), Selection.Seed);
+	JsonObject->SetStringField(TEXT("content_version"), Selection.ContentVersion);
+	JsonObject->SetNumberField(TEXT("tier"), Selection.Tier);
+
+	TArray<TSharedPtr<FJsonValue>> TracksJson;
+	for (const FTrackInfo& Track : Selection.Tracks)
+	{
+		TSharedPtr<FJsonObject> TrackObj = MakeShared<FJsonObject>();
+		TrackObj->SetNumberField(TEXT("id"), Track.Id);
+		TrackObj->SetNumberField(TEXT("length"), Track.Length);
+		TrackObj->SetNumberField(TEXT("shop_count"), Track.ShopCount);
+		TrackObj->SetStringField(TEXT("boss_id"), Track.BossId);
+		TracksJson.Add(MakeShared<FJsonValueObject>(TrackObj));
+	}
+	JsonObject->SetArrayField(TEXT("tracks"), TracksJson);
+	return JsonObject;
+}
+
+TSharedPtr<FJsonObject> FMockBackendServer::ShopToJson(const FShopData& Shop) const
+{
+	TArray<TSharedPtr<FJsonValue>> ItemsJson;
+	for (const FShopItemData& Item : Shop.Items)
+	{
+		TSharedPtr<FJsonObject> ItemObj = MakeShared<FJsonObject>();
+		ItemObj->SetStringField(TEXT("id"), Item.Id);
+		ItemObj->SetStringField(TEXT("name"), Item.Name);
+		ItemObj->SetNumberField(TEXT("cost"), Item.Cost);
+		TSharedPtr<FJsonObject> PropsObj = MakeShared<FJsonObject>();
+		for (const TPair<FString, FString>& Prop : Item.Properties) PropsObj->SetStringField(Prop.Key, Prop.Value);
+		ItemObj->SetObjectField(TEXT("properties"), PropsObj);
+		ItemsJson.Add(MakeShared<FJsonValueObject>(ItemObj));
+	}
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetArrayField(TEXT("items"), ItemsJson);
+	return JsonObject;
+}
+
+TArray<TSharedPtr<FJsonValue>> FMockBackendServer::BossRewardsToJson(const TArray<FBossRewardData>& Rewards) const
+{
+	TArray<TSharedPtr<FJsonValue>> RewardsJson;
+	for (const FBossRewardData& Reward : Rewards)
+	{
+		TSharedPtr<FJsonObject> RewardObj = MakeShared<FJsonObject>();
+		RewardObj->SetStringField(TEXT("id"), Reward.Id);
+		RewardObj->SetStringField(TEXT("name"), Reward.Name);
+		TSharedPtr<FJsonObject> PropsObj = MakeShared<FJsonObject>();
+		for (const TPair<FString, FString>& Prop : Reward.Properties) PropsObj->SetStringField(Prop.Key, Prop.Value);
+		RewardObj->SetObjectField(TEXT("properties"), PropsObj);
+		RewardsJson.Add(MakeShared<FJsonValueObject>(RewardObj));
+	}
+	return RewardsJson;
+}
+
+#endif // !UE_BUILD_SHIPPING
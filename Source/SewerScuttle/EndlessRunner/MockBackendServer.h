@@ -0,0 +1,165 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "PlayerClass.h"
+#include "WebServerInterface.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "HttpResultCallback.h"
+#include "HttpRouteHandle.h"
+#include "LocalRunGenerator.h"
+
+class IHttpRouter;
+class FJsonObject;
+class FJsonValue;
+
+/**
+ * In-process stand-in for the Laravel backend (development builds only)
+ * Serves the run, leaderboard and replay endpoints from ULocalRunGenerator so the client can be
+ * exercised with no network. Latency, jitter and failure rate are injected per request.
+ * Enable with bUseMockBackend in Project Settings -> Game -> Sewer Scuttle Config, or the
+ * SewerScuttle.MockBackend.* console commands.
+ */
+class SEWERSCUTTLE_API FMockBackendServer
+{
+public:
+	/** Get singleton instance */
+	static FMockBackendServer& Get();
+
+	/** Start listening on the configured port */
+	bool StartServer();
+
+	/** Stop listening */
+	void StopServer();
+
+	/** Check if server is running */
+	bool IsServerRunning() const { return bIsRunning; }
+
+	/** Get the server port */
+	int32 GetServerPort() const { return ServerPort; }
+
+	/** Override the injected fault profile at runtime (defaults come from UConfigManager) */
+	void SetFaultProfile(int32 InLatencyMs, int32 InJitterMs, float InFailureRate);
+
+private:
+	/** A run started through /runs/start */
+	struct FMockRun
+	{
+		int32 Seed = 0;
+		EPlayerClass PlayerClass = EPlayerClass::Vanilla;
+	};
+
+	/** A run submitted through POST /runs */
+	struct FMockSubmittedRun
+	{
+		int32 RunId = 0;
+		FString SeedId;
+		int32 Seed = 0;
+		int32 Score = 0;
+		FString PlayerClass;
+		int32 RngVersion = RunRngVersion::Legacy;
+		FDateTime SubmittedAt;
+		TSharedPtr<FJsonValue> ReplayData;
+	};
+
+	FMockBackendServer();
+	~FMockBackendServer();
+
+	/** Register all API routes */
+	void RegisterRoutes();
+
+	/** Unregister all API routes */
+	void UnregisterRoutes();
+
+	/** Load content for the generator (recorded export if present, otherwise the live registry) */
+	bool LoadContent();
+
+	/** Prepare the generator for a known run, returns false if the seed_id is unknown */
+	bool BeginRun(const FString& SeedId);
+
+	/** Whether a run has this tier (the backend generates tiers 1-3) */
+	static bool IsValidTier(int32 Tier) { return Tier >= 1 && Tier <= 3; }
+
+	// ========================================================================
+	// Route Handlers
+	// ========================================================================
+
+	/** POST /api/runs/start */
+	bool HandleStartRun(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** GET /api/runs/{seed_id}/tier/{tier} */
+	bool HandleGetTierTracks(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** POST /api/runs/{seed_id}/select-track */
+	bool HandleSelectTrack(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** GET /api/runs/{seed_id}/shop/{tier}/{track_index}/{shop_index} */
+	bool HandleGetShopItems(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** GET /api/runs/{seed_id}/boss-rewards/{tier} */
+	bool HandleGetBossRewards(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** POST /api/runs */
+	bool HandleSubmitRun(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** GET /api/runs/{run}/replay */
+	bool HandleGetReplay(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** GET /api/leaderboard */
+	bool HandleGetLeaderboard(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** GET /api/me (401 without a bearer token, as behind the auth middleware) */
+	bool HandleGetMe(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	// ========================================================================
+	// Utility Functions
+	// ========================================================================
+
+	/** Send a JSON response after the injected delay, or a 503 if the failure roll hits */
+	void Respond(const FHttpResultCallback& OnComplete, const TSharedPtr<FJsonValue>& Body, EHttpServerResponseCodes ResponseCode = EHttpServerResponseCodes::Ok);
+
+	/** Send a {"message": ...} error response (still subject to injected delay) */
+	void RespondError(const FHttpResultCallback& OnComplete, const FString& Message, EHttpServerResponseCodes ResponseCode);
+
+	bool ParseRequestBody(const FHttpServerRequest& Request, TSharedPtr<FJsonObject>& OutJson) const;
+	FString GetPathParameter(const FHttpServerRequest& Request, const FString& ParamName) const;
+	int32 GetIntPathParameter(const FHttpServerRequest& Request, const FString& ParamName) const;
+
+	TSharedPtr<FJsonObject> TrackSelectionToJson(const FTrackSelectionData& Selection) const;
+	TSharedPtr<FJsonObject> ShopToJson(const FShopData& Shop) const;
+	TArray<TSharedPtr<FJsonValue>> BossRewardsToJson(const TArray<FBossRewardData>& Rewards) const;
+
+private:
+	static FMockBackendServer* Instance;
+
+	TSharedPtr<IHttpRouter> HttpRouter;
+	TArray<FHttpRouteHandle> RouteHandles;
+
+	/** Generator shared by all routes; re-seeded per request from the run's seed */
+	TStrongObjectPtr<ULocalRunGenerator> Generator;
+
+	TMap<FString, FMockRun> Runs;
+	TArray<FMockSubmittedRun> SubmittedRuns;
+	int32 NextRunId = 1;
+
+	/** Fault injection */
+	int32 LatencyMs = 0;
+	int32 JitterMs = 0;
+	float FailureRate = 0.0f;
+	FRandomStream FaultStream;
+
+	/** Request counters, logged on stop */
+	int32 RequestCount = 0;
+	int32 InjectedFailureCount = 0;
+
+	bool bIsRunning = false;
+	int32 ServerPort = 8090;
+};
+
+#endif // !UE_BUILD_SHIPPING
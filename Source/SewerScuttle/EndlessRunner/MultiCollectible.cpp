@@ -3,6 +3,7 @@
 #include "MultiCollectible.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Components/SceneComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Particles/ParticleSystemComponent.h"
@@ -11,6 +12,7 @@
 #include "RabbitCharacter.h"
 #include "CurrencyManager.h"
 #include "EndlessRunnerGameMode.h"
+#include "LaneCollisionResolver.h"
 
 AMultiCollectible::AMultiCollectible()
 {
@@ -35,10 +37,33 @@ void AMultiCollectible::BeginPlay()
 	SetupItems();
 }
 
+void AMultiCollectible::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterItems();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMultiCollectible::UnregisterItems()
+{
+	ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this);
+	for (FCollectibleItem& Item : CollectibleItems)
+	{
+		if (Resolver) Resolver->Unregister(Item.LaneRecordId);
+		Item.LaneRecordId = INDEX_NONE;
+	}
+}
+
 void AMultiCollectible::SetupItems()
 {
+	// Setup can be called again from Blueprint, drop records of the previous items
+	UnregisterItems();
 	CollectibleItems.Empty();
-	CollisionToItemMap.Empty();
+	if (ItemInstances)
+	{
+		ItemInstances->DestroyComponent();
+		ItemInstances = nullptr;
+	}
 
 	// Find all child static mesh components and sphere components
 	TArray<UActorComponent*> Components;
@@ -103,11 +128,9 @@ void AMultiCollectible::SetupItems()
 			{
 				SphereComp->SetSphereRadius(50.0f);
 			}
-			SphereComp->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-			SphereComp->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
-			SphereComp->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
-			SphereComp->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
-			SphereComp->OnComponentBeginOverlap.AddDynamic(this, &AMultiCollectible::OnItemOverlapBegin);
+			// Shape only - pickup is resolved by the lane collision resolver
+			SphereComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			SphereComp->SetGenerateOverlapEvents(false);
 
 			// Add to item or create new
 			if (ItemMap.Contains(ItemIndex))
@@ -120,12 +143,11 @@ void AMultiCollectible::SetupItems()
 				NewItem.CollisionSphere = SphereComp;
 				ItemMap.Add(ItemIndex, NewItem);
 			}
-
-			// Map collision to item index
-			CollisionToItemMap.Add(SphereComp, ItemIndex);
 		}
 	}
 
+	ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this);
+
 	// Convert map to array (sorted by index)
 	TArray<int32> Indices;
 	ItemMap.GetKeys(Indices);
@@ -156,10 +178,77 @@ void AMultiCollectible::SetupItems()
 			Item.InitialZ = Item.CollisionSphere->GetComponentLocation().Z;
 		}
 
+		// Register the sphere, grown in Z to cover the bob
+		if (Resolver && Item.CollisionSphere)
+		{
+			const FBox Bounds = Item.CollisionSphere->CalcBounds(Item.CollisionSphere->GetComponentTransform()).GetBox();
+			Item.LaneRecordId = Resolver->Register(this, ELaneContentKind::MultiCollectibleItem, Bounds.ExpandBy(FVector(0.0f, 0.0f, BobAmplitude)), CollectibleItems.Num());
+		}
+
 		CollectibleItems.Add(Item);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("MultiCollectible: Setup %d collectible items"), CollectibleItems.Num());
+	if (bInstanceItems)
+	{
+		ConvertItemsToInstances();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("MultiCollectible: Setup %d collectible items%s"), CollectibleItems.Num(), ItemInstances ? TEXT(" (instanced)") : TEXT(""));
+}
+
+void AMultiCollectible::ConvertItemsToInstances()
+{
+	// One instanced component can only draw one mesh
+	UStaticMeshComponent* TemplateMesh = nullptr;
+	for (const FCollectibleItem& Item : CollectibleItems)
+	{
+		if (!Item.MeshComponent || !Item.MeshComponent->GetStaticMesh()) return;
+		if (!TemplateMesh) TemplateMesh = Item.MeshComponent;
+		else if (Item.MeshComponent->GetStaticMesh() != TemplateMesh->GetStaticMesh()) return;
+	}
+	if (!TemplateMesh) return;
+
+	if (!ItemInstances)
+	{
+		ItemInstances = NewObject<UInstancedStaticMeshComponent>(this);
+		ItemInstances->SetupAttachment(RootComponent);
+		ItemInstances->SetMobility(EComponentMobility::Movable);
+		ItemInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		ItemInstances->SetGenerateOverlapEvents(false);
+		ItemInstances->SetCanEverAffectNavigation(false);
+		ItemInstances->RegisterComponent();
+	}
+	ItemInstances->ClearInstances();
+	ItemInstances->SetStaticMesh(TemplateMesh->GetStaticMesh());
+	for (int32 MaterialIndex = 0; MaterialIndex < TemplateMesh->GetNumOverrideMaterials(); ++MaterialIndex)
+	{
+		ItemInstances->SetMaterial(MaterialIndex, TemplateMesh->OverrideMaterials[MaterialIndex]);
+	}
+	ItemInstances->SetCastShadow(TemplateMesh->CastShadow);
+
+	// Pickup records were registered from the spheres already, so both components can go
+	for (FCollectibleItem& Item : CollectibleItems)
+	{
+		Item.InitialTransform = Item.MeshComponent->GetComponentTransform();
+		Item.InstanceIndex = ItemInstances->AddInstance(Item.InitialTransform, true);
+		Item.MeshComponent->DestroyComponent();
+		Item.MeshComponent = nullptr;
+		if (Item.CollisionSphere)
+		{
+			Item.CollisionSphere->DestroyComponent();
+			Item.CollisionSphere = nullptr;
+		}
+	}
+}
+
+FVector AMultiCollectible::GetItemLocation(int32 ItemIndex) const
+{
+	if (!CollectibleItems.IsValidIndex(ItemIndex)) return GetActorLocation();
+
+	const FCollectibleItem& Item = CollectibleItems[ItemIndex];
+	if (Item.MeshComponent) return Item.MeshComponent->GetComponentLocation();
+	if (Item.InstanceIndex != INDEX_NONE) return Item.InitialTransform.GetLocation();
+	return GetActorLocation();
 }
 
 void AMultiCollectible::Tick(float DeltaTime)
@@ -171,6 +260,25 @@ void AMultiCollectible::Tick(float DeltaTime)
 		return;
 	}
 
+	// Instanced items all spin and bob in phase, written in one batch update
+	if (ItemInstances)
+	{
+		const float Time = GetGameTimeSinceCreation();
+		const FQuat Spin(FRotator(0.0f, FMath::Fmod(Time * RotationSpeed, 360.0f), 0.0f));
+		const FVector Bob(0.0f, 0.0f, FMath::Sin(Time * BobSpeed) * BobAmplitude);
+
+		InstanceTransforms.SetNumUninitialized(CollectibleItems.Num(), EAllowShrinking::No);
+		for (const FCollectibleItem& Item : CollectibleItems)
+		{
+			const FTransform& Initial = Item.InitialTransform;
+			InstanceTransforms[Item.InstanceIndex] = Item.bCollected
+				? FTransform(FQuat::Identity, Initial.GetLocation(), FVector::ZeroVector)
+				: FTransform(Spin * Initial.GetRotation(), Initial.GetLocation() + Bob, Initial.GetScale3D());
+		}
+		ItemInstances->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true);
+		return;
+	}
+
 	// Animate all uncollected items
 	for (FCollectibleItem& Item : CollectibleItems)
 	{
@@ -192,51 +300,6 @@ void AMultiCollectible::Tick(float DeltaTime)
 	}
 }
 
-void AMultiCollectible::OnItemOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
-{
-	ARabbitCharacter* Player = Cast<ARabbitCharacter>(OtherActor);
-	if (!Player)
-	{
-		return;
-	}
-
-	// Only respond to the player's capsule component to prevent multiple overlap events
-	// The character's capsule is the main collision component
-	if (OtherComp != Player->GetCapsuleComponent())
-	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("MultiCollectible: Ignoring overlap - not capsule component (Component: %s)"), *OtherComp->GetName());
-		return;
-	}
-
-	// Find which item was overlapped
-	if (USphereComponent* SphereComp = Cast<USphereComponent>(OverlappedComp))
-	{
-		if (int32* ItemIndexPtr = CollisionToItemMap.Find(SphereComp))
-		{
-			int32 ItemIndex = *ItemIndexPtr;
-			// Check if already collected before calling CollectItem
-			if (ItemIndex >= 0 && ItemIndex < CollectibleItems.Num() && !CollectibleItems[ItemIndex].bCollected)
-			{
-				// Disable collision IMMEDIATELY to prevent multiple overlap events
-				// This must happen before CollectItem() to prevent race conditions
-				if (CollectibleItems[ItemIndex].CollisionSphere)
-				{
-					CollectibleItems[ItemIndex].CollisionSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-					// Also remove the overlap delegate to be extra safe
-					CollectibleItems[ItemIndex].CollisionSphere->OnComponentBeginOverlap.RemoveAll(this);
-				}
-				
-				UE_LOG(LogTemp, Log, TEXT("MultiCollectible: Collecting item %d (Value: %d, Actor: %s)"), ItemIndex, CollectibleItems[ItemIndex].Value, *GetName());
-				CollectItem(ItemIndex);
-			}
-			else if (ItemIndex >= 0 && ItemIndex < CollectibleItems.Num() && CollectibleItems[ItemIndex].bCollected)
-			{
-				UE_LOG(LogTemp, VeryVerbose, TEXT("MultiCollectible: Ignoring overlap - item %d already collected"), ItemIndex);
-			}
-		}
-	}
-}
-
 void AMultiCollectible::CollectItem(int32 ItemIndex)
 {
 	if (ItemIndex < 0 || ItemIndex >= CollectibleItems.Num())
@@ -252,22 +315,27 @@ void AMultiCollectible::CollectItem(int32 ItemIndex)
 
 	Item.bCollected = true;
 
-	// Hide mesh
+	// Hide mesh (instances are collapsed, removing one would renumber the others)
 	if (Item.MeshComponent)
 	{
 		Item.MeshComponent->SetVisibility(false);
 	}
+	else if (ItemInstances && Item.InstanceIndex != INDEX_NONE)
+	{
+		ItemInstances->UpdateInstanceTransform(Item.InstanceIndex, FTransform(FQuat::Identity, Item.InitialTransform.GetLocation(), FVector::ZeroVector), true, true);
+	}
 
-	// Disable collision
-	if (Item.CollisionSphere)
+	// Remove from the lane collision resolver
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
 	{
-		Item.CollisionSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Resolver->Unregister(Item.LaneRecordId);
 	}
+	Item.LaneRecordId = INDEX_NONE;
 
 	// Play collection effect
 	if (CollectionEffect)
 	{
-		FVector EffectLocation = Item.MeshComponent ? Item.MeshComponent->GetComponentLocation() : GetActorLocation();
+		FVector EffectLocation = GetItemLocation(ItemIndex);
 		if (UParticleSystemComponent* EffectComp = UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), CollectionEffect, EffectLocation))
 		{
 			// Effect will auto-destroy
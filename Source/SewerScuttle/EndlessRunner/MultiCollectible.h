@@ -11,6 +11,7 @@
 class USphereComponent;
 class UStaticMeshComponent;
 class UParticleSystemComponent;
+class UInstancedStaticMeshComponent;
 
 /**
  * Structure defining a single collectible item within a multi-collectible actor
@@ -41,6 +42,15 @@ struct FCollectibleItem
 
 	/** Initial rotation for rotation animation */
 	FRotator InitialRotation = FRotator::ZeroRotator;
+
+	/** Record in the lane collision resolver */
+	int32 LaneRecordId = INDEX_NONE;
+
+	/** Instance drawing this item (when items are instanced, MeshComponent is null) */
+	int32 InstanceIndex = INDEX_NONE;
+
+	/** World transform of the item's mesh at setup (instanced items) */
+	FTransform InitialTransform;
 };
 
 /**
@@ -56,6 +66,7 @@ public:
 	AMultiCollectible();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 	/** Get total value of all uncollected items */
@@ -81,6 +92,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "!Collectible")
 	void CollectItem(int32 ItemIndex);
 
+	/** World location of an item (for magnet system) */
+	FVector GetItemLocation(int32 ItemIndex) const;
+
 protected:
 	/** Root scene component */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -129,6 +143,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
 	bool bAnimateItems = true;
 
+	/** Draw items through one instanced mesh component instead of a mesh and sphere component each (items must share a mesh) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "!Collectible")
+	bool bInstanceItems = true;
+
+	/** Instanced component drawing the items when bInstanceItems is set */
+	UPROPERTY()
+	UInstancedStaticMeshComponent* ItemInstances = nullptr;
+
 	/** Particle effect to play when an item is collected */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
 	UParticleSystem* CollectionEffect = nullptr;
@@ -137,12 +159,14 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "!Collectible")
 	void SetupItems();
 
-	/** Handle overlap for a specific item */
-	UFUNCTION()
-	void OnItemOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
 private:
-	/** Map of collision components to item indices for overlap handling */
-	TMap<USphereComponent*, int32> CollisionToItemMap;
+	/** Remove all item records from the lane collision resolver */
+	void UnregisterItems();
+
+	/** Move the items' meshes into ItemInstances and destroy their components */
+	void ConvertItemsToInstances();
+
+	/** Scratch transforms for the per-frame batch update */
+	TArray<FTransform> InstanceTransforms;
 };
 
@@ -4,9 +4,8 @@
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "RabbitCharacter.h"
-#include "RabbitJumpComponent.h"
-#include "RabbitSlideComponent.h"
 #include "EndlessRunnerGameMode.h"
+#include "LaneCollisionResolver.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/GameModeBase.h"
 #include "Kismet/GameplayStatics.h"
@@ -20,10 +19,9 @@ AObstacle::AObstacle()
 	CollisionBox = CreateDefaultSubobject<UBoxComponent>(TEXT("CollisionBox"));
 	RootComponent = CollisionBox;
 	CollisionBox->SetBoxExtent(FVector(50.0f, 50.0f, 50.0f));
-	CollisionBox->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	CollisionBox->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
-	CollisionBox->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
-	CollisionBox->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
+	// Shape only - contact is resolved by the lane collision resolver
+	CollisionBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	CollisionBox->SetGenerateOverlapEvents(false);
 
 	// Create mesh component
 	MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent"));
@@ -35,9 +33,6 @@ void AObstacle::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Set up overlap event
-	CollisionBox->OnComponentBeginOverlap.AddDynamic(this, &AObstacle::OnOverlapBegin);
-
 	// Only adjust collision box based on obstacle type if it's still at default values
 	// This allows Blueprint customization to persist
 	FVector CurrentExtent = CollisionBox->GetUnscaledBoxExtent();
@@ -67,116 +62,94 @@ void AObstacle::BeginPlay()
 		}
 	}
 	// If extents have been customized in Blueprint, don't override them
+
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		LaneRecordId = Resolver->Register(this, ELaneContentKind::Obstacle, CollisionBox->CalcBounds(CollisionBox->GetComponentTransform()).GetBox());
+		Resolver->SetObstacleRules(LaneRecordId, ObstacleType, bIsBreakable);
+	}
 }
 
-void AObstacle::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void AObstacle::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	ARabbitCharacter* Player = Cast<ARabbitCharacter>(OtherActor);
-	if (Player)
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
 	{
-		// Check if Enforcer can break this obstacle FIRST (before any other checks)
-		// This allows Enforcer to break obstacles regardless of avoidance state
-		if (bIsBreakable && Player->GetCanBreakObstacles())
-		{
-			// Enforcer breaks through breakable obstacle
-			UE_LOG(LogTemp, Warning, TEXT("Obstacle: ENFORCER BREAKING breakable obstacle '%s'"), *GetName());
-			
-			// Play break effect if available
-			if (BreakEffect && GetWorld())
-			{
-				FVector EffectLocation = GetActorLocation();
-				UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), BreakEffect, EffectLocation);
-			}
-			
-			// Destroy obstacle (no damage to player)
-			Destroy();
-			return;
-		}
+		Resolver->Unregister(LaneRecordId);
+	}
+	LaneRecordId = INDEX_NONE;
 
-		// LOG for non-breakable or non-enforcer
-		if (bIsBreakable)
-		{
-			UE_LOG(LogTemp, Log, TEXT("Obstacle: Breakable obstacle '%s' hit but player cannot break (Enforcer: %d)"), 
-				*GetName(), Player->GetCanBreakObstacles() ? 1 : 0);
-		}
+	Super::EndPlay(EndPlayReason);
+}
 
-		// Check if player can avoid this obstacle
-		bool bCanAvoid = false;
+void AObstacle::SetObstacleType(EObstacleType NewType)
+{
+	ObstacleType = NewType;
 
-		if (ObstacleType == EObstacleType::Low)
-		{
-			// Check if player is sliding OR if Scout class (never needs crouch)
-			if (Player->GetSlideComponent() && Player->GetSlideComponent()->IsSliding())
-			{
-				bCanAvoid = true;
-			}
-			else if (Player->GetNeverNeedsCrouch())
-			{
-				// Scout class can pass under low obstacles without sliding
-				bCanAvoid = true;
-				UE_LOG(LogTemp, Log, TEXT("Obstacle: Scout class passing under low obstacle without sliding"));
-			}
-		}
-		else if (ObstacleType == EObstacleType::High)
-		{
-			// Check if player is jumping
-			if (Player->GetJumpComponent() && Player->GetJumpComponent()->IsJumping())
-			{
-				bCanAvoid = true;
-			}
-		}
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		Resolver->SetObstacleRules(LaneRecordId, ObstacleType, bIsBreakable);
+	}
+}
+
+void AObstacle::BreakObstacle()
+{
+	// Enforcer breaks through breakable obstacle
+	UE_LOG(LogTemp, Warning, TEXT("Obstacle: ENFORCER BREAKING breakable obstacle '%s'"), *GetName());
+	
+	// Play break effect if available
+	if (BreakEffect && GetWorld())
+	{
+		FVector EffectLocation = GetActorLocation();
+		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), BreakEffect, EffectLocation);
+	}
+	
+	// Destroy obstacle (no damage to player)
+	Destroy();
+}
+
+void AObstacle::HitPlayer(ARabbitCharacter* Player)
+{
+	if (!Player) return;
 
-		if (!bCanAvoid)
+	// Check if this obstacle should force instant death
+	bool bShouldInstantKill = false;
+	if (bIgnoreLastStand)
+	{
+		// Get current lives from GameMode
+		if (UWorld* World = GetWorld())
 		{
-			// Check if player is invincible
-			if (Player->IsInvincible())
-			{
-				UE_LOG(LogTemp, Log, TEXT("Obstacle: Player is invincible, ignoring collision from obstacle '%s'"), *GetName());
-				return;
-			}
-			
-			// Check if this obstacle should force instant death
-			bool bShouldInstantKill = false;
-			if (bIgnoreLastStand)
+			if (AEndlessRunnerGameMode* GameMode = Cast<AEndlessRunnerGameMode>(World->GetAuthGameMode()))
 			{
-				// Get current lives from GameMode
-				if (UWorld* World = GetWorld())
+				int32 CurrentLives = GameMode->GetLives();
+				if (LivesLost >= CurrentLives)
 				{
-					if (AEndlessRunnerGameMode* GameMode = Cast<AEndlessRunnerGameMode>(World->GetAuthGameMode()))
-					{
-						int32 CurrentLives = GameMode->GetLives();
-						if (LivesLost >= CurrentLives)
-						{
-							bShouldInstantKill = true;
-							UE_LOG(LogTemp, Warning, TEXT("Obstacle: Instant death obstacle '%s' - LivesLost (%d) >= CurrentLives (%d)"), 
-								*GetName(), LivesLost, CurrentLives);
-						}
-					}
-				}
-			}
-			
-			// Notify GameMode about obstacle hit
-			UE_LOG(LogTemp, Warning, TEXT("Obstacle: Player hit obstacle '%s' (Type=%d, LivesLost=%d, InstantDeath=%d)"), 
-				*GetName(), (int32)ObstacleType, LivesLost, bShouldInstantKill ? 1 : 0);
-			if (UWorld* World = GetWorld())
-			{
-				if (AEndlessRunnerGameMode* GameMode = Cast<AEndlessRunnerGameMode>(World->GetAuthGameMode()))
-				{
-					GameMode->OnPlayerHitObstacle(LivesLost, bShouldInstantKill);
+					bShouldInstantKill = true;
+					UE_LOG(LogTemp, Warning, TEXT("Obstacle: Instant death obstacle '%s' - LivesLost (%d) >= CurrentLives (%d)"), 
+						*GetName(), LivesLost, CurrentLives);
 				}
 			}
+		}
+	}
+	
+	// Notify GameMode about obstacle hit
+	UE_LOG(LogTemp, Warning, TEXT("Obstacle: Player hit obstacle '%s' (Type=%d, LivesLost=%d, InstantDeath=%d)"), 
+		*GetName(), (int32)ObstacleType, LivesLost, bShouldInstantKill ? 1 : 0);
+	if (UWorld* World = GetWorld())
+	{
+		if (AEndlessRunnerGameMode* GameMode = Cast<AEndlessRunnerGameMode>(World->GetAuthGameMode()))
+		{
+			GameMode->OnPlayerHitObstacle(LivesLost, bShouldInstantKill);
+		}
+	}
 
-			// Apply damage and knockback (Blueprint event)
-			OnPlayerCollision(Player);
+	// Apply damage and knockback (Blueprint event)
+	OnPlayerCollision(Player);
 
-			// Apply knockback
-			UCharacterMovementComponent* MovementComp = Player->GetCharacterMovement();
-			if (MovementComp)
-			{
-				FVector KnockbackDirection = -Player->GetActorForwardVector();
-				MovementComp->AddImpulse(KnockbackDirection * KnockbackForce);
-			}
-		}
+	// Apply knockback
+	UCharacterMovementComponent* MovementComp = Player->GetCharacterMovement();
+	if (MovementComp)
+	{
+		FVector KnockbackDirection = -Player->GetActorForwardVector();
+		MovementComp->AddImpulse(KnockbackDirection * KnockbackForce);
 	}
 }
-
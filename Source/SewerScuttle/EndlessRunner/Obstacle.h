@@ -42,7 +42,8 @@ namespace ObstacleUtils
 
 /**
  * Base obstacle actor
- * Blocks player path and causes damage/knockback on collision
+ * Blocks player path and causes damage/knockback on collision. The collision box only describes the
+ * obstacle's shape: contact is resolved by ULaneCollisionResolver, not physics overlaps.
  */
 UCLASS()
 class SEWERSCUTTLE_API AObstacle : public AActor
@@ -53,6 +54,7 @@ public:
 	AObstacle();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Get obstacle type */
 	UFUNCTION(BlueprintPure, Category = "!Obstacle")
@@ -60,7 +62,7 @@ public:
 
 	/** Set obstacle type */
 	UFUNCTION(BlueprintCallable, Category = "!Obstacle")
-	void SetObstacleType(EObstacleType NewType) { ObstacleType = NewType; }
+	void SetObstacleType(EObstacleType NewType);
 
 	/** Get damage amount */
 	UFUNCTION(BlueprintPure, Category = "!Obstacle")
@@ -70,6 +72,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "!Obstacle")
 	void SetDamage(float NewDamage) { Damage = NewDamage; }
 
+	/** Player ran into the obstacle without avoiding it */
+	void HitPlayer(ARabbitCharacter* Player);
+
+	/** Player broke through the obstacle (Enforcer) */
+	void BreakObstacle();
+
 protected:
 	/** Collision box */
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Components")
@@ -107,12 +115,12 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "!Obstacle", meta = (ToolTip = "If true and LivesLost >= player's current lives, instantly kills player (bypasses last stand)"))
 	bool bIgnoreLastStand = false;
 
-	/** Handle overlap */
-	UFUNCTION()
-	void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
 	/** Handle collision with player */
 	UFUNCTION(BlueprintImplementableEvent, Category = "!Obstacle")
 	void OnPlayerCollision(ARabbitCharacter* Player);
+
+private:
+	/** Record in the lane collision resolver */
+	int32 LaneRecordId = INDEX_NONE;
 };
 
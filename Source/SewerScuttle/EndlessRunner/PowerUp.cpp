@@ -2,6 +2,7 @@
 
 #include "PowerUp.h"
 #include "EndlessRunnerGameMode.h"
+#include "LaneCollisionResolver.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "RabbitCharacter.h"
@@ -17,10 +18,9 @@ APowerUp::APowerUp()
 	CollisionSphere = CreateDefaultSubobject<USphereComponent>(TEXT("CollisionSphere"));
 	RootComponent = CollisionSphere;
 	CollisionSphere->SetSphereRadius(50.0f);
-	CollisionSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	CollisionSphere->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
-	CollisionSphere->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
-	CollisionSphere->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
+	// Shape only - pickup is resolved by the lane collision resolver
+	CollisionSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	CollisionSphere->SetGenerateOverlapEvents(false);
 
 	// Create mesh component
 	MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent"));
@@ -32,8 +32,21 @@ void APowerUp::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Set up overlap event
-	CollisionSphere->OnComponentBeginOverlap.AddDynamic(this, &APowerUp::OnOverlapBegin);
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		LaneRecordId = Resolver->Register(this, ELaneContentKind::PowerUp, CollisionSphere->CalcBounds(CollisionSphere->GetComponentTransform()).GetBox());
+	}
+}
+
+void APowerUp::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		Resolver->Unregister(LaneRecordId);
+	}
+	LaneRecordId = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void APowerUp::Tick(float DeltaTime)
@@ -51,15 +64,6 @@ void APowerUp::Tick(float DeltaTime)
 	SetActorRotation(CurrentRotation);
 }
 
-void APowerUp::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
-{
-	ARabbitCharacter* Player = Cast<ARabbitCharacter>(OtherActor);
-	if (Player && !bCollected)
-	{
-		Collect(Player);
-	}
-}
-
 void APowerUp::Collect(ARabbitCharacter* Player)
 {
 	if (bCollected || !Player)
@@ -69,6 +73,12 @@ void APowerUp::Collect(ARabbitCharacter* Player)
 
 	bCollected = true;
 
+	if (ULaneCollisionResolver* Resolver = ULaneCollisionResolver::Get(this))
+	{
+		Resolver->Unregister(LaneRecordId);
+	}
+	LaneRecordId = INDEX_NONE;
+
 	// Apply GAS effects
 	ApplyGASPowerUp(Player);
 
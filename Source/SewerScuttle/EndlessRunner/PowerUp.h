@@ -27,6 +27,7 @@ public:
 	APowerUp();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 	/** Get duration */
@@ -65,10 +66,6 @@ protected:
 	/** Whether powerup has been collected */
 	bool bCollected = false;
 
-	/** Handle overlap */
-	UFUNCTION()
-	void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
 	/** Apply powerup effect to player */
 	UFUNCTION(BlueprintImplementableEvent, Category = "!PowerUp")
 	void OnPowerUpCollected(ARabbitCharacter* Player);
@@ -92,5 +89,9 @@ protected:
 protected:
 	/** Apply powerup via GAS */
 	void ApplyGASPowerUp(ARabbitCharacter* Player);
+
+private:
+	/** Record in the lane collision resolver */
+	int32 LaneRecordId = INDEX_NONE;
 };
 
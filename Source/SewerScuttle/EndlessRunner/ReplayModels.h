@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "PlayerClass.h"
+#include "KeyedRandom.h"
 #include "ReplayModels.generated.h"
 
 UENUM(BlueprintType)
@@ -58,4 +59,40 @@ struct FLeaderboardEntryData
 
     UPROPERTY(BlueprintReadWrite)
     bool bHasReplay = false;
+
+	/** Random number scheme the run was generated with (RunRngVersion) */
+	UPROPERTY(BlueprintReadWrite)
+	int32 RngVersion = RunRngVersion::Legacy;
+
+	/** 1-based position on the board */
+	UPROPERTY(BlueprintReadWrite)
+	int32 Rank = 0;
+};
+
+/** One page of a leaderboard query */
+USTRUCT(BlueprintType)
+struct FLeaderboardPageData
+{
+	GENERATED_BODY()
+
+	/** Query the page belongs to */
+	UPROPERTY(BlueprintReadWrite)
+	FString Timeframe;
+
+	UPROPERTY(BlueprintReadWrite)
+	FString PlayerClass;
+
+	/** Rank offset of the first entry */
+	UPROPERTY(BlueprintReadWrite)
+	int32 Offset = 0;
+
+	UPROPERTY(BlueprintReadWrite)
+	TArray<FLeaderboardEntryData> Entries;
+
+	/** Whether more entries follow this page */
+	UPROPERTY(BlueprintReadWrite)
+	bool bHasMore = false;
+
+	UPROPERTY(BlueprintReadWrite)
+	int32 PlayerRank = 0;
 };
@@ -5,6 +5,7 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFilemanager.h"
+#include "Async/Async.h"
 
 USecureStorage* USecureStorage::Get()
 {
@@ -30,12 +31,25 @@ void USecureStorage::Save(const FString& Key, const FString& Value)
 	// In a real production app, you'd use platform-specific secure storage (Keychain/EncryptedFile)
 	FString Encoded = FBase64::Encode(Value);
 	FFileHelper::SaveStringToFile(Encoded, *GetStoragePath());
+
+	CachedValue = Value;
+	bCacheValid = true;
 }
 
 FString USecureStorage::Load(const FString& Key) const
+{
+	if (!bCacheValid)
+	{
+		CachedValue = ReadFromDisk(GetStoragePath());
+		bCacheValid = true;
+	}
+	return CachedValue;
+}
+
+FString USecureStorage::ReadFromDisk(const FString& Path)
 {
 	FString Encoded;
-	if (FFileHelper::LoadFileToString(Encoded, *GetStoragePath()))
+	if (FFileHelper::LoadFileToString(Encoded, *Path))
 	{
 		FString Decoded;
 		if (FBase64::Decode(Encoded, Decoded))
@@ -46,6 +60,32 @@ FString USecureStorage::Load(const FString& Key) const
 	return TEXT("");
 }
 
+void USecureStorage::PreloadAsync(FSimpleDelegate OnLoaded)
+{
+	if (bCacheValid)
+	{
+		OnLoaded.ExecuteIfBound();
+		return;
+	}
+
+	const FString Path = GetStoragePath();
+	Async(EAsyncExecution::ThreadPool, [Path, OnLoaded]()
+	{
+		FString Value = ReadFromDisk(Path);
+		AsyncTask(ENamedThreads::GameThread, [Value = MoveTemp(Value), OnLoaded]()
+		{
+			// A Save or Load on the game thread in the meantime wins
+			USecureStorage* Storage = USecureStorage::Get();
+			if (!Storage->bCacheValid)
+			{
+				Storage->CachedValue = Value;
+				Storage->bCacheValid = true;
+			}
+			OnLoaded.ExecuteIfBound();
+		});
+	});
+}
+
 void USecureStorage::Remove(const FString& Key)
 {
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
@@ -53,5 +93,8 @@ void USecureStorage::Remove(const FString& Key)
 	{
 		PlatformFile.DeleteFile(*GetStoragePath());
 	}
+
+	CachedValue.Reset();
+	bCacheValid = true;
 }
 
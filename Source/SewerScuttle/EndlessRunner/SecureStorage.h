@@ -18,7 +18,17 @@ public:
 	FString Load(const FString& Key) const;
 	void Remove(const FString& Key);
 
+	/** Read the stored value on a worker thread so the first Load doesn't hit the disk on the game thread */
+	void PreloadAsync(FSimpleDelegate OnLoaded);
+
 private:
 	FString GetStoragePath() const;
+
+	/** Read and decode the storage file */
+	static FString ReadFromDisk(const FString& Path);
+
+	/** Value as last read or written; storage is only touched on the first Load */
+	mutable FString CachedValue;
+	mutable bool bCacheValid = false;
 };
 
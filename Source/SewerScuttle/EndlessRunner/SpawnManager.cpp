@@ -3,17 +3,45 @@
 #include "SpawnManager.h"
 #include "EndlessRunnerGameMode.h"
 #include "TrackPiece.h"
-#include "ContentRegistry.h"
 #include "ObstacleDefinition.h"
 #include "PowerUpDefinition.h"
 #include "CollectibleDefinition.h"
 #include "RabbitCharacter.h"
 #include "CollectibleCoin.h"
+#include "CoinField.h"
 #include "PowerUp.h"
 #include "Obstacle.h"
 #include "GameplayManager.h"
 #include "Engine/World.h"
 
+/** Pick a spawn point definition the way legacy runs did: a cumulative-weight walk on the shared stream */
+static UBaseContentDefinition* SelectLegacySpawn(const FSpawnPoint& SpawnPoint, EPlayerClass PlayerClass, FRandomStream& RandomStream)
+{
+	TArray<FWeightedDefinition> ValidDefs;
+	float TotalWeight = 0.0f;
+
+	for (const FWeightedDefinition& WD : SpawnPoint.WeightedDefinitions)
+	{
+		if (!WD.Definition) continue;
+		if (WD.Definition->AllowedClasses.Num() == 0 || WD.Definition->AllowedClasses.Contains(PlayerClass))
+		{
+			ValidDefs.Add(WD);
+			TotalWeight += WD.Weight;
+		}
+	}
+
+	if (ValidDefs.Num() == 0 || TotalWeight <= 0.0f) return nullptr;
+
+	float SelectionRV = RandomStream.FRandRange(0.0f, TotalWeight);
+	float CurrentWeightSum = 0.0f;
+	for (const FWeightedDefinition& WD : ValidDefs)
+	{
+		CurrentWeightSum += WD.Weight;
+		if (SelectionRV <= CurrentWeightSum) return WD.Definition;
+	}
+	return nullptr;
+}
+
 USpawnManager::USpawnManager()
 {
 	GameMode = nullptr;
@@ -45,21 +73,15 @@ void USpawnManager::SpawnOnTrackPiece(ATrackPiece* TrackPiece)
 	const TArray<FSpawnPoint>& SpawnPoints = TrackPiece->GetSpawnPoints();
 	FVector TrackPieceLocation = TrackPiece->GetActorLocation();
 
-	for (const FSpawnPoint& SpawnPoint : SpawnPoints)
+	// Replays of legacy runs draw from the shared stream in spawn order, as they were recorded
+	FRandomStream* LegacyStream = GameMode->GetRngVersion() == RunRngVersion::Legacy ? &GameMode->GetLegacyRandomStream() : nullptr;
+
+	for (int32 SpawnPointIndex = 0; SpawnPointIndex < SpawnPoints.Num(); ++SpawnPointIndex)
 	{
+		const FSpawnPoint& SpawnPoint = SpawnPoints[SpawnPointIndex];
 		FVector SpawnLocation;
-		bool bUseComponent = false;
-
-		if (!SpawnPoint.SpawnPositionComponentName.IsEmpty())
-		{
-			if (USceneComponent* SpawnComp = TrackPiece->FindComponentByName(SpawnPoint.SpawnPositionComponentName))
-			{
-				SpawnLocation = SpawnComp->GetComponentLocation();
-				bUseComponent = true;
-			}
-		}
 
-		if (!bUseComponent)
+		if (!TrackPiece->GetSpawnPointLocation(SpawnPointIndex, SpawnLocation))
 		{
 			float LaneY = 0.0f;
 			switch (SpawnPoint.Lane)
@@ -72,17 +94,18 @@ void USpawnManager::SpawnOnTrackPiece(ATrackPiece* TrackPiece)
 			SpawnLocation = TrackPieceLocation + FVector(SpawnPoint.ForwardPosition, LaneY, 0.0f);
 		}
 
-		FRandomStream* RandomStream = &GameMode->GetSeededRandomStream();
-		float RandomValue = RandomStream->FRand();
+		// Each slot draws from its own keyed stream, so pieces can be planned in any order
+		FKeyedRandom Random = GameMode->MakeKeyedRandom(ERunRandomStream::SpawnRoll, TrackPiece->GetPieceIndex(), SpawnPointIndex);
+		float RandomValue = LegacyStream ? LegacyStream->FRand() : Random.FRand();
 		bool bShouldSpawn = false;
-		FString PrescribedId = TEXT("");
+		UBaseContentDefinition* PrescribedDef = nullptr;
 
 		// SEEDED RUN: Strictly obey server
 		if (TrackPiece->HasPrescribedSpawns())
 		{
-			PrescribedId = TrackPiece->GetPrescribedSpawn(SpawnPoint.SpawnPositionComponentName);
-			// Only spawn if server explicitly provided a Definition ID in the map
-			bShouldSpawn = !PrescribedId.IsEmpty();
+			PrescribedDef = TrackPiece->GetPrescribedSpawn(SpawnPointIndex);
+			// Only spawn if server explicitly prescribed a definition for this slot
+			bShouldSpawn = PrescribedDef != nullptr;
 		}
 		// ENDLESS MODE: Local deterministic roll
 		else
@@ -98,38 +121,25 @@ void USpawnManager::SpawnOnTrackPiece(ATrackPiece* TrackPiece)
 
             if (TrackPiece->HasPrescribedSpawns())
             {
-                if (UContentRegistry* Registry = GameMode->GetContentRegistry())
-                {
-                    // Search all registries since the spawn point is polymorphic
-					SelectedDef = Registry->FindObstacleById(PrescribedId);
-					if (!SelectedDef) SelectedDef = Registry->FindPowerUpById(PrescribedId);
-					if (!SelectedDef) SelectedDef = Registry->FindCollectibleById(PrescribedId);
-                }
+                // Resolved against the registry once when the sequence was loaded
+				SelectedDef = PrescribedDef;
             }
+			else if (LegacyStream)
+			{
+				SelectedDef = SelectLegacySpawn(SpawnPoint, CurrentClass, *LegacyStream);
+			}
 			else if (SpawnPoint.WeightedDefinitions.Num() > 0)
 			{
-				TArray<FWeightedDefinition> ValidDefs;
-				float TotalWeight = 0.0f;
-
-				for (const FWeightedDefinition& WD : SpawnPoint.WeightedDefinitions)
+				// Pieces sharing a layout reuse its per-class candidate tables
+				if (const FTrackPieceLayout* Layout = TrackPiece->GetLayout())
 				{
-					if (!WD.Definition) continue;
-					if (WD.Definition->AllowedClasses.Num() == 0 || WD.Definition->AllowedClasses.Contains(CurrentClass))
-					{
-						ValidDefs.Add(WD);
-						TotalWeight += WD.Weight;
-					}
+					SelectedDef = Layout->GetSpawnCandidates(SpawnPointIndex, CurrentClass).Sample(Random);
 				}
-
-				if (ValidDefs.Num() > 0 && TotalWeight > 0.0f)
+				else
 				{
-					float SelectionRV = RandomStream->FRandRange(0.0f, TotalWeight);
-					float CurrentWeightSum = 0.0f;
-					for (const FWeightedDefinition& WD : ValidDefs)
-					{
-						CurrentWeightSum += WD.Weight;
-						if (SelectionRV <= CurrentWeightSum) { SelectedDef = WD.Definition; break; }
-					}
+					FSpawnCandidates Candidates;
+					Candidates.Build(SpawnPoint, CurrentClass);
+					SelectedDef = Candidates.Sample(Random);
 				}
 			}
 
@@ -140,6 +150,28 @@ void USpawnManager::SpawnOnTrackPiece(ATrackPiece* TrackPiece)
 				else if (UCollectibleDefinition* CD = Cast<UCollectibleDefinition>(SelectedDef)) ClassToSpawn = CD->CollectibleClass;
 			}
 
+			// Plain coins go into the piece's instanced coin field instead of becoming actors
+			if (ClassToSpawn && ClassToSpawn->IsChildOf(ACollectibleCoin::StaticClass()))
+			{
+				ACoinField* CoinField = TrackPiece->GetCoinField();
+				if (!CoinField)
+				{
+					FActorSpawnParameters SpawnParams;
+					SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+					UClass* FieldClass = GameMode->CoinFieldClass ? GameMode->CoinFieldClass.Get() : ACoinField::StaticClass();
+					CoinField = World->SpawnActor<ACoinField>(FieldClass, TrackPieceLocation, FRotator::ZeroRotator, SpawnParams);
+					if (CoinField) TrackPiece->SetCoinField(CoinField);
+				}
+
+				if (CoinField)
+				{
+					const UCollectibleDefinition* CD = Cast<UCollectibleDefinition>(SelectedDef);
+					TSubclassOf<ACollectibleCoin> CoinClass = ClassToSpawn.Get();
+					CoinField->AddCoin(CoinClass, SpawnLocation, CD ? CD->Value : CoinClass->GetDefaultObject<ACollectibleCoin>()->GetValue());
+					continue;
+				}
+			}
+
 			if (ClassToSpawn)
 			{
 				FActorSpawnParameters SpawnParams;
@@ -4,6 +4,9 @@
 #include "TrackPiece.h"
 #include "TrackPieceDefinition.h"
 #include "ContentRegistry.h"
+#include "ObstacleDefinition.h"
+#include "PowerUpDefinition.h"
+#include "CollectibleDefinition.h"
 #include "RabbitCharacter.h"
 #include "EndlessRunnerGameMode.h"
 #include "GameplayManager.h"
@@ -104,6 +107,7 @@ void ATrackGenerator::Initialize(ARabbitCharacter* InPlayerCharacter)
 
 	FVector FirstConnectionPoint(0.0f, 0.0f, 0.0f);
 	LastSpawnPosition = 0.0f;
+	NextPieceIndex = 0;
 	UTrackPieceDefinition* FirstPieceDefinition = FindFirstPieceDefinition();
 	
 	for (int32 i = 0; i < PiecesAhead; ++i)
@@ -134,6 +138,9 @@ void ATrackGenerator::Reset()
 	for (ATrackPiece* P : ActiveTrackPieces) if (IsValid(P)) { P->ClearSpawnedActors(); P->Destroy(); }
 	ActiveTrackPieces.Empty(); 
 	PieceIdMap.Empty(); 
+	ResolvedPieces.Empty();
+	NextPieceIndex = 0;
+	CandidatesDifficulty = INDEX_NONE;
 	TotalTrackPiecesSpawned = 0; 
 	LastSpawnPosition = 0.0f; 
 	DistanceTraveled = 0.0f; 
@@ -149,12 +156,13 @@ void ATrackGenerator::LoadTrackSequence(const FTrackSequenceData& SequenceData)
 	bTrackSequenceLoaded = true; 
 	bEndlessMode = false; 
 	LastSpawnPosition = 0.0f;
+	ResolveTrackSequence();
 
 	UE_LOG(LogTemp, Warning, TEXT("=================================================="));
 	UE_LOG(LogTemp, Warning, TEXT("TRACK SEQUENCE RECEIVED: %d PIECES"), TrackSequenceData.Pieces.Num());
 	for (int32 i = 0; i < TrackSequenceData.Pieces.Num(); ++i)
 	{
-		UE_LOG(LogTemp, Log, TEXT("  [%d]: %s"), i, *TrackSequenceData.Pieces[i].PieceId);
+		UE_LOG(LogTemp, Log, TEXT("  [%d]: %s"), i, *TrackSequenceData.Pieces[i].PieceId.ToString());
 	}
 	UE_LOG(LogTemp, Warning, TEXT("=================================================="));
 
@@ -174,7 +182,7 @@ int32 ATrackGenerator::GetRemainingPieces() const { return bTrackSequenceLoaded
 TArray<FString> ATrackGenerator::GetCurrentPieceIds() const
 {
     TArray<FString> Ids;
-    for (const FTrackPiecePrescription& P : TrackSequenceData.Pieces) Ids.Add(P.PieceId);
+    for (const FTrackPiecePrescription& P : TrackSequenceData.Pieces) Ids.Add(P.PieceId.ToString());
     return Ids;
 }
 
@@ -196,13 +204,73 @@ UTrackPieceDefinition* ATrackGenerator::FindTrackPieceDefinitionById(const FStri
 	return nullptr;
 }
 
+void ATrackGenerator::ResolveTrackSequence()
+{
+	UContentRegistry* Registry = nullptr;
+	if (UWorld* World = GetWorld())
+	{
+		if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(World->GetAuthGameMode()))
+		{
+			Registry = GM->GetContentRegistry();
+		}
+	}
+
+	// Each distinct definition ID is looked up once, whatever number of slots it fills
+	TArray<UBaseContentDefinition*> Definitions;
+	Definitions.Reserve(TrackSequenceData.DefinitionIds.Num());
+	for (const FName& DefinitionId : TrackSequenceData.DefinitionIds)
+	{
+		UBaseContentDefinition* Definition = nullptr;
+		if (Registry)
+		{
+			// Search all registries since the spawn point is polymorphic
+			const FString Id = DefinitionId.ToString();
+			Definition = Registry->FindObstacleById(Id);
+			if (!Definition) Definition = Registry->FindPowerUpById(Id);
+			if (!Definition) Definition = Registry->FindCollectibleById(Id);
+		}
+		if (!Definition)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("TrackGenerator: Unknown prescribed definition %s"), *DefinitionId.ToString());
+		}
+		Definitions.Add(Definition);
+	}
+
+	ResolvedPieces.Reset(TrackSequenceData.Pieces.Num());
+	for (const FTrackPiecePrescription& Piece : TrackSequenceData.Pieces)
+	{
+		FResolvedSequencePiece& Resolved = ResolvedPieces.AddDefaulted_GetRef();
+		Resolved.Definition = FindTrackPieceDefinitionById(Piece.PieceId.ToString());
+		if (!Resolved.Definition) continue;
+
+		// Slot names map to indices in the definition's shared layout, which is what the spawned piece will use
+		TSharedRef<const FTrackPieceLayout> Layout = Resolved.Definition->GetLayout(TrackPieceClass);
+		Resolved.Spawns.Reserve(Piece.Spawns.Num());
+		for (const FPrescribedSpawn& Spawn : Piece.Spawns)
+		{
+			const int32 SpawnSlot = Layout->FindSpawnSlot(Spawn.SlotName);
+			UBaseContentDefinition* Definition = Definitions.IsValidIndex(Spawn.DefinitionIndex) ? Definitions[Spawn.DefinitionIndex] : nullptr;
+			if (SpawnSlot == INDEX_NONE || !Definition)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("TrackGenerator: Dropping prescribed spawn %s on piece %s"), *Spawn.SlotName.ToString(), *Piece.PieceId.ToString());
+				continue;
+			}
+			FPrescribedSlot& Slot = Resolved.Spawns.AddDefaulted_GetRef();
+			Slot.SpawnSlot = SpawnSlot;
+			Slot.Definition = Definition;
+		}
+		Resolved.Spawns.Sort([](const FPrescribedSlot& A, const FPrescribedSlot& B) { return A.SpawnSlot < B.SpawnSlot; });
+	}
+}
+
 void ATrackGenerator::SpawnNextSequencePiece()
 {
 	if (!bTrackSequenceLoaded || CurrentPieceIndex >= TrackSequenceData.Pieces.Num()) return;
-	FString PieceId = TrackSequenceData.Pieces[CurrentPieceIndex].PieceId;
-	UTrackPieceDefinition* D = FindTrackPieceDefinitionById(PieceId);
+	const FName PieceId = TrackSequenceData.Pieces[CurrentPieceIndex].PieceId;
+	const FResolvedSequencePiece& Resolved = ResolvedPieces[CurrentPieceIndex];
+	UTrackPieceDefinition* D = Resolved.Definition;
 	if (!D) { 
-		UE_LOG(LogTemp, Error, TEXT("TrackGenerator: Failed to find definition for PieceId: %s"), *PieceId);
+		UE_LOG(LogTemp, Error, TEXT("TrackGenerator: Failed to find definition for PieceId: %s"), *PieceId.ToString());
 		CurrentPieceIndex++; 
 		return; 
 	}
@@ -219,20 +287,16 @@ void ATrackGenerator::SpawnNextSequencePiece()
 		CP = FVector::ZeroVector;
 	}
 
-	ATrackPiece* NP = CreateTrackPieceFromDefinition(D, CP);
+	ATrackPiece* NP = CreateTrackPieceFromDefinition(D, CP, &Resolved.Spawns);
 	if (NP) { 
 		ActiveTrackPieces.Add(NP); 
 		TotalTrackPiecesSpawned++; 
 		LastSpawnPosition = NP->GetEndConnectionWorldPosition().X; 
 		PieceIdMap.Add(NP, PieceId); 
-        
-        // Pass prescribed spawns to the piece
-        NP->SetPrescribedSpawns(TrackSequenceData.Pieces[CurrentPieceIndex].PrescribedSpawns);
-        
 		CurrentPieceIndex++; 
 		
 		UE_LOG(LogTemp, Log, TEXT("TrackGenerator: Spawned sequence piece %d: %s at X=%.2f"), 
-			CurrentPieceIndex-1, *PieceId, CP.X);
+			CurrentPieceIndex-1, *PieceId.ToString(), CP.X);
 	}
 	else {
 		CurrentPieceIndex++;
@@ -269,9 +333,10 @@ UTrackPieceDefinition* ATrackGenerator::FindFirstPieceDefinition() const
 	return nullptr;
 }
 
-UTrackPieceDefinition* ATrackGenerator::SelectTrackPieceDefinition()
+void ATrackGenerator::RebuildPieceCandidates()
 {
-	TArray<UTrackPieceDefinition*> Valid; int32 TW = 0;
+	PieceCandidates.Reset();
+	TArray<float, TInlineAllocator<32>> Weights;
 	for (UTrackPieceDefinition* D : TrackPieceDefinitions)
 	{
 		if (!D) continue;
@@ -283,63 +348,63 @@ UTrackPieceDefinition* ATrackGenerator::SelectTrackPieceDefinition()
 		if (bEndlessMode && D->PieceType == ETrackPieceType::Boss) bValidType = true;
 		
 		if (bValidType && D->MinDifficulty <= CurrentDifficulty && (D->MaxDifficulty < 0 || D->MaxDifficulty >= CurrentDifficulty))
-		{ Valid.Add(D); TW += D->SelectionWeight; }
+		{ PieceCandidates.Add(D); Weights.Add(D->SelectionWeight); }
 	}
-	if (Valid.Num() == 0) 
+	PieceCandidateTable.Build(Weights);
+	CandidatesDifficulty = CurrentDifficulty;
+	bCandidatesEndless = bEndlessMode;
+}
+
+UTrackPieceDefinition* ATrackGenerator::SelectTrackPieceDefinition()
+{
+	if (CandidatesDifficulty != CurrentDifficulty || bCandidatesEndless != bEndlessMode) RebuildPieceCandidates();
+	if (PieceCandidates.Num() == 0) 
 	{
 		// Fallback logic
 		if (TrackPieceDefinitions.Num() > 0) return TrackPieceDefinitions[0];
 		return nullptr;
 	}
-	if (TW <= 0) return Valid[0];
-	FRandomStream* RS = nullptr;
-	if (UWorld* W = GetWorld()) if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(W->GetAuthGameMode())) RS = &GM->GetSeededRandomStream();
-	int32 RW = RS ? RS->RandRange(0, TW - 1) : FMath::RandRange(0, TW - 1);
-	int32 CW = 0;
-	for (UTrackPieceDefinition* D : Valid) { CW += D->SelectionWeight; if (RW < CW) return D; }
-	return Valid[0];
+	if (PieceCandidateTable.IsEmpty()) return PieceCandidates[0];
+
+	AEndlessRunnerGameMode* GM = GetWorld() ? Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()) : nullptr;
+	if (GM && GM->GetRngVersion() == RunRngVersion::Legacy)
+	{
+		// Replays of legacy runs walk the cumulative weights with the shared stream, as they were recorded
+		int32 TW = 0;
+		for (UTrackPieceDefinition* D : PieceCandidates) TW += D->SelectionWeight;
+		int32 RW = GM->GetLegacyRandomStream().RandRange(0, TW - 1);
+		int32 CW = 0;
+		for (UTrackPieceDefinition* D : PieceCandidates) { CW += D->SelectionWeight; if (RW < CW) return D; }
+		return PieceCandidates[0];
+	}
+
+	// Keyed by the piece's position in the track, not by how many numbers were drawn before it
+	FKeyedRandom Random = GM ? GM->MakeKeyedRandom(ERunRandomStream::TrackPieceSelection, NextPieceIndex) : FKeyedRandom(FMath::Rand(), ERunRandomStream::TrackPieceSelection, 0, NextPieceIndex);
+	return PieceCandidates[PieceCandidateTable.Sample(Random)];
 }
 
-ATrackPiece* ATrackGenerator::CreateTrackPieceFromDefinition(UTrackPieceDefinition* D, const FVector& CP)
+ATrackPiece* ATrackGenerator::CreateTrackPieceFromDefinition(UTrackPieceDefinition* D, const FVector& CP, const TArray<FPrescribedSlot>* PrescribedSpawns)
 {
 	if (!D || !TrackPieceClass) return nullptr;
 	UWorld* W = GetWorld(); if (!W) return nullptr;
-	FRotator SR(0.0f, 90.0f, 0.0f); FActorSpawnParameters SP; SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	ATrackPiece* NP = nullptr;
+	FRotator SR(0.0f, 90.0f, 0.0f);
 
-	if (D->bUseBlueprintActor && D->BlueprintActorClass)
-	{
-		NP = W->SpawnActor<ATrackPiece>(D->BlueprintActorClass, CP, SR, SP);
-		if (!NP) return nullptr;
-		NP->BuildComponentCache();
-		NP->SetStartConnectionByName(D->StartConnectionComponentName.IsEmpty() ? TEXT("StartConnection") : D->StartConnectionComponentName);
-		NP->SetEndConnectionsByNames(D->EndConnectionComponentNames.Num() > 0 ? D->EndConnectionComponentNames : TArray<FString>{TEXT("EndConnection")});
-		if (USceneComponent* SC = NP->GetStartConnection())
-		{
-			FVector SCP = SC->GetComponentLocation(), ACP = NP->GetActorLocation(), ATC = SCP - ACP;
-			FVector AL = FVector(CP.X, 0.0f, CP.Z == 0.0f ? ACP.Z : CP.Z) - ATC;
-			AL.Y = 0.0f - ATC.Y; if (CP.Z != 0.0f) AL.Z = CP.Z - ATC.Z;
-			NP->SetActorLocation(AL);
-		}
-	}
-	else
-	{
-		NP = W->SpawnActor<ATrackPiece>(TrackPieceClass, CP, SR, SP);
-		if (!NP) return nullptr;
-		if (USceneComponent* SC = NP->GetStartConnection())
-		{
-			FVector SCP = SC->GetComponentLocation(), ACP = NP->GetActorLocation(), ATC = SCP - ACP;
-			FVector AL = FVector(CP.X, 0.0f, ACP.Z) - ATC; AL.Y = 0.0f - ATC.Y;
-			NP->SetActorLocation(AL);
-		}
-	}
+	// The layout is read from the class defaults once per definition, so the piece can be placed with its start
+	// connection on CP before it is even constructed and never has to scan its own components
+	TSharedRef<const FTrackPieceLayout> Layout = D->GetLayout(TrackPieceClass);
+	FVector ATC = FTransform(SR).TransformVector(Layout->StartConnectionOffset);
+	FTransform ST(SR, FVector(CP.X, 0.0f, CP.Z) - ATC);
 
-	if (NP)
-	{
-		NP->SetLength(D->Length);
-		NP->SetLaneWidth(D->LaneWidth);
-		if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(W->GetAuthGameMode())) if (UGameplayManager* GPM = GM->GetGameplayManager()) if (USpawnManager* SPM = GPM->GetSpawnManager()) SPM->SpawnOnTrackPiece(NP);
-	}
+	ATrackPiece* NP = W->SpawnActorDeferred<ATrackPiece>(D->GetPieceClass(TrackPieceClass), ST, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!NP) return nullptr;
+	NP->ApplyLayout(Layout);
+	NP->SetLength(D->Length);
+	NP->SetLaneWidth(D->LaneWidth);
+	NP->SetPieceIndex(NextPieceIndex++);
+	if (PrescribedSpawns) NP->SetPrescribedSpawns(*PrescribedSpawns);
+	NP->FinishSpawning(ST);
+
+	if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(W->GetAuthGameMode())) if (UGameplayManager* GPM = GM->GetGameplayManager()) if (USpawnManager* SPM = GPM->GetSpawnManager()) SPM->SpawnOnTrackPiece(NP);
 	return NP;
 }
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "WebServerInterface.h"
+#include "TrackPiece.h"
 #include "TrackGenerator.generated.h"
 
 class ATrackPiece;
@@ -14,6 +15,20 @@ class ARabbitCharacter;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnShopPieceReached);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBossPieceReached);
 
+/** A sequence piece resolved against the content registry when the sequence is loaded */
+USTRUCT()
+struct FResolvedSequencePiece
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UTrackPieceDefinition> Definition = nullptr;
+
+	/** Prescribed spawns, sorted by spawn slot */
+	UPROPERTY()
+	TArray<FPrescribedSlot> Spawns;
+};
+
 /**
  * Manages track generation (finite tracks with shops and bosses)
  * Spawns track pieces from a predefined sequence
@@ -91,6 +106,9 @@ private:
 	/** Select a track piece definition based on difficulty and weight (legacy - for endless mode) */
 	UTrackPieceDefinition* SelectTrackPieceDefinition();
 
+	/** Rebuild the endless-mode candidates for the current difficulty and mode */
+	void RebuildPieceCandidates();
+
 	/** Find the first piece definition (type Start) */
 	UTrackPieceDefinition* FindFirstPieceDefinition() const;
 
@@ -155,6 +173,20 @@ protected:
 	UPROPERTY()
 	FTrackSequenceData TrackSequenceData;
 
+	/** Resolved pieces (parallel to TrackSequenceData.Pieces); holding them keeps their definitions alive across bundle releases */
+	UPROPERTY()
+	TArray<FResolvedSequencePiece> ResolvedPieces;
+
+	/** Definitions endless mode can pick at CandidatesDifficulty/bCandidatesEndless, and an alias table over their weights */
+	UPROPERTY()
+	TArray<UTrackPieceDefinition*> PieceCandidates;
+	FAliasTable PieceCandidateTable;
+	int32 CandidatesDifficulty = INDEX_NONE;
+	bool bCandidatesEndless = false;
+
+	/** Index the next created piece gets in the track (keys its random numbers) */
+	int32 NextPieceIndex = 0;
+
 	/** Current piece index in sequence */
 	int32 CurrentPieceIndex = 0;
 
@@ -165,7 +197,7 @@ protected:
 	bool bEndlessMode = false;
 
 	/** Map of spawned pieces to their content IDs (for shop/boss detection) */
-	TMap<ATrackPiece*, FString> PieceIdMap;
+	TMap<ATrackPiece*, FName> PieceIdMap;
 
 	/** Spawn a new track piece (from sequence or random for endless) */
 	void SpawnTrackPiece(float Position);
@@ -176,8 +208,11 @@ protected:
 	/** Destroy track pieces that are too far behind */
 	void CleanupOldPieces();
 
-	/** Create track piece from definition */
-	ATrackPiece* CreateTrackPieceFromDefinition(UTrackPieceDefinition* Definition, const FVector& ConnectionPoint);
+	/** Resolve the loaded sequence's piece and content IDs once, up front */
+	void ResolveTrackSequence();
+
+	/** Create track piece from definition (prescribed spawns are handed to the piece before its content spawns) */
+	ATrackPiece* CreateTrackPieceFromDefinition(UTrackPieceDefinition* Definition, const FVector& ConnectionPoint, const TArray<FPrescribedSlot>* PrescribedSpawns = nullptr);
 
 	/** Draw debug visualization for lanes */
 	void DrawLaneDebugVisualization();
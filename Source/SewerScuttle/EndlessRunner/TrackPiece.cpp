@@ -4,8 +4,13 @@
 #include "Obstacle.h"
 #include "PowerUp.h"
 #include "CollectibleCoin.h"
+#include "CoinField.h"
 #include "Components/SceneComponent.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
 #include "DrawDebugHelpers.h"
+#include "Algo/BinarySearch.h"
 #include "Engine/World.h"
 
 USmartSpawnComponent::USmartSpawnComponent()
@@ -14,6 +19,147 @@ USmartSpawnComponent::USmartSpawnComponent()
 	bAutoActivate = true;
 }
 
+void FSpawnCandidates::Build(const FSpawnPoint& SpawnPoint, EPlayerClass PlayerClass)
+{
+	Definitions.Reset();
+	TArray<float, TInlineAllocator<16>> Weights;
+	for (const FWeightedDefinition& WD : SpawnPoint.WeightedDefinitions)
+	{
+		if (!WD.Definition) continue;
+		if (WD.Definition->AllowedClasses.Num() == 0 || WD.Definition->AllowedClasses.Contains(PlayerClass))
+		{
+			Definitions.Add(WD.Definition);
+			Weights.Add(WD.Weight);
+		}
+	}
+	Table.Build(Weights);
+}
+
+const FSpawnCandidates& FTrackPieceLayout::GetSpawnCandidates(int32 SpawnSlot, EPlayerClass PlayerClass) const
+{
+	if (CandidatesClass != PlayerClass)
+	{
+		SpawnCandidates.SetNum(SpawnPoints.Num());
+		for (int32 Slot = 0; Slot < SpawnPoints.Num(); ++Slot)
+		{
+			SpawnCandidates[Slot].Build(SpawnPoints[Slot], PlayerClass);
+		}
+		CandidatesClass = PlayerClass;
+	}
+	return SpawnCandidates[SpawnSlot];
+}
+
+TSharedRef<const FTrackPieceLayout> FTrackPieceLayout::Build(TSubclassOf<ATrackPiece> PieceClass, const FString& StartConnectionName, const TArray<FString>& EndConnectionNames)
+{
+	TSharedRef<FTrackPieceLayout> Layout = MakeShared<FTrackPieceLayout>();
+	if (!PieceClass) return Layout;
+
+	struct FTemplate
+	{
+		const USceneComponent* Component;
+		FString ParentName;
+	};
+
+	// Pieces are static scenery: clearing tick on the templates means spawned pieces register no component ticks
+	auto DisableTemplateTick = [](UActorComponent* Component) { Component->PrimaryComponentTick.bCanEverTick = false; };
+	TMap<FString, FTemplate> Templates;
+	TArray<FString> Order;
+
+	// Native components live on the class default object, attached as in the constructor
+	ATrackPiece* Defaults = PieceClass->GetDefaultObject<ATrackPiece>();
+	const USceneComponent* NativeRoot = Defaults->GetRootComponent();
+	TArray<UActorComponent*> NativeComponents;
+	Defaults->GetComponents(NativeComponents);
+	for (UActorComponent* ActorComponent : NativeComponents)
+	{
+		DisableTemplateTick(ActorComponent);
+		const USceneComponent* Component = Cast<USceneComponent>(ActorComponent);
+		if (!Component) continue;
+
+		const FString Name = Component->GetName();
+		const USceneComponent* Parent = Component->GetAttachParent();
+		Templates.Add(Name, { Component, (Component != NativeRoot && Parent) ? Parent->GetName() : FString() });
+		Order.Add(Name);
+	}
+
+	// Blueprint components only exist as construction script templates (instances are named after the variable)
+	TArray<const UBlueprintGeneratedClass*> BlueprintClasses;
+	UBlueprintGeneratedClass::GetGeneratedClassesHierarchy(PieceClass, BlueprintClasses);
+	UBlueprintGeneratedClass* MostDerived = Cast<UBlueprintGeneratedClass>(PieceClass.Get());
+	for (int32 ClassIndex = BlueprintClasses.Num() - 1; ClassIndex >= 0; --ClassIndex)
+	{
+		const USimpleConstructionScript* SCS = BlueprintClasses[ClassIndex]->SimpleConstructionScript;
+		if (!SCS) continue;
+
+		for (USCS_Node* Node : SCS->GetAllNodes())
+		{
+			UActorComponent* ComponentTemplate = Node->GetActualComponentTemplate(MostDerived);
+			if (!ComponentTemplate) continue;
+			DisableTemplateTick(ComponentTemplate);
+
+			const USceneComponent* Component = Cast<USceneComponent>(ComponentTemplate);
+			if (!Component) continue;
+
+			FString ParentName;
+			if (const USCS_Node* ParentNode = SCS->FindParentNode(Node)) ParentName = ParentNode->GetVariableName().ToString();
+			else if (Node->ParentComponentOrVariableName != NAME_None) ParentName = Node->ParentComponentOrVariableName.ToString();
+			else if (NativeRoot) ParentName = NativeRoot->GetName();
+
+			const FString Name = Node->GetVariableName().ToString();
+			Templates.Add(Name, { Component, ParentName });
+			Order.Add(Name);
+		}
+	}
+
+	// Compose relative transforms up to the root (the root's own transform is the actor's)
+	TFunction<FTransform(const FString&, int32)> Resolve = [&](const FString& Name, int32 Depth) -> FTransform
+	{
+		if (const FTransform* Known = Layout->ComponentTransforms.Find(Name)) return *Known;
+		const FTemplate* Template = Templates.Find(Name);
+		if (!Template || Template->ParentName.IsEmpty() || Depth > 32) return FTransform::Identity;
+		const FTransform Result = Template->Component->GetRelativeTransform() * Resolve(Template->ParentName, Depth + 1);
+		Layout->ComponentTransforms.Add(Name, Result);
+		return Result;
+	};
+
+	TSet<FString> SeenSpawnNames;
+	for (const FString& Name : Order)
+	{
+		const FTransform ActorRelative = Resolve(Name, 0);
+		Layout->ComponentTransforms.Add(Name, ActorRelative);
+
+		const USmartSpawnComponent* SmartComp = Cast<USmartSpawnComponent>(Templates[Name].Component);
+		if (!SmartComp || SeenSpawnNames.Contains(Name)) continue;
+		SeenSpawnNames.Add(Name);
+
+		FSpawnPoint NewPoint;
+		NewPoint.SpawnPositionComponentName = Name;
+		NewPoint.WeightedDefinitions = SmartComp->Definitions;
+		NewPoint.SpawnProbability = SmartComp->SpawnProbability;
+
+		const FVector Location = ActorRelative.GetLocation();
+		NewPoint.Lane = (Location.Y < -100.0f) ? 0 : ((Location.Y > 100.0f) ? 2 : 1);
+		NewPoint.ForwardPosition = Location.X;
+		Layout->SpawnPoints.Add(NewPoint);
+		Layout->SpawnPointOffsets.Add(Location);
+		Layout->SpawnPointNames.Add(FName(*Name));
+	}
+
+	if (const FTransform* Start = Layout->ComponentTransforms.Find(StartConnectionName))
+	{
+		Layout->StartConnectionOffset = Start->GetLocation();
+	}
+	for (const FString& EndName : EndConnectionNames)
+	{
+		if (const FTransform* End = Layout->ComponentTransforms.Find(EndName))
+		{
+			Layout->EndConnectionOffsets.Add(End->GetLocation());
+		}
+	}
+
+	return Layout;
+}
+
 ATrackPiece::ATrackPiece()
 {
 	PrimaryActorTick.bCanEverTick = false;
@@ -21,6 +167,7 @@ ATrackPiece::ATrackPiece()
 	// Create root scene component
 	RootSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootScene"));
 	RootComponent = RootSceneComponent;
+	RootSceneComponent->PrimaryComponentTick.bCanEverTick = false;
 
 	// Create start connection point
 	StartConnection = CreateDefaultSubobject<USceneComponent>(TEXT("StartConnection"));
@@ -39,7 +186,34 @@ ATrackPiece::ATrackPiece()
 void ATrackPiece::BeginPlay()
 {
 	Super::BeginPlay();
-	BuildComponentCache();
+
+	// Pieces spawned from a definition already have their layout, only stand-alone pieces scan their components
+	if (!Layout.IsValid())
+	{
+		BuildComponentCache();
+	}
+}
+
+UBaseContentDefinition* ATrackPiece::GetPrescribedSpawn(int32 SpawnSlot) const
+{
+	const int32 Index = Algo::BinarySearchBy(PrescribedSlots, SpawnSlot, &FPrescribedSlot::SpawnSlot);
+	return Index != INDEX_NONE ? PrescribedSlots[Index].Definition : nullptr;
+}
+
+bool ATrackPiece::GetSpawnPointLocation(int32 SpawnPointIndex, FVector& OutLocation) const
+{
+	if (Layout.IsValid())
+	{
+		if (!Layout->SpawnPointOffsets.IsValidIndex(SpawnPointIndex)) return false;
+		OutLocation = GetActorTransform().TransformPosition(Layout->SpawnPointOffsets[SpawnPointIndex]);
+		return true;
+	}
+
+	if (!SpawnPoints.IsValidIndex(SpawnPointIndex) || SpawnPoints[SpawnPointIndex].SpawnPositionComponentName.IsEmpty()) return false;
+	USceneComponent* SpawnComp = FindComponentByName(SpawnPoints[SpawnPointIndex].SpawnPositionComponentName);
+	if (!SpawnComp) return false;
+	OutLocation = SpawnComp->GetComponentLocation();
+	return true;
 }
 
 void ATrackPiece::AddSpawnPoint(const FSpawnPoint& SpawnPoint)
@@ -83,17 +257,20 @@ void ATrackPiece::SetEndConnectionsByNames(const TArray<FString>& ComponentNames
 
 FVector ATrackPiece::GetStartConnectionWorldPosition() const
 {
+	if (Layout.IsValid()) return GetActorTransform().TransformPosition(Layout->StartConnectionOffset);
 	return StartConnection ? StartConnection->GetComponentLocation() : GetActorLocation();
 }
 
 FVector ATrackPiece::GetEndConnectionWorldPosition() const
 {
+	if (Layout.IsValid() && Layout->EndConnectionOffsets.Num() > 0) return GetActorTransform().TransformPosition(Layout->EndConnectionOffsets[0]);
 	if (EndConnections.Num() > 0 && EndConnections[0]) return EndConnections[0]->GetComponentLocation();
 	return GetStartConnectionWorldPosition() + GetActorForwardVector() * Length;
 }
 
 FVector ATrackPiece::GetEndConnectionWorldPositionByIndex(int32 Index) const
 {
+	if (Layout.IsValid() && Layout->EndConnectionOffsets.IsValidIndex(Index)) return GetActorTransform().TransformPosition(Layout->EndConnectionOffsets[Index]);
 	if (EndConnections.IsValidIndex(Index) && EndConnections[Index]) return EndConnections[Index]->GetComponentLocation();
 	return GetEndConnectionWorldPosition();
 }
@@ -104,6 +281,9 @@ void ATrackPiece::BuildComponentCache()
 	TArray<USceneComponent*> Components;
 	GetComponents(USceneComponent::StaticClass(), Components);
 
+	TSet<FString> RegisteredSpawnNames;
+	for (const FSpawnPoint& P : SpawnPoints) RegisteredSpawnNames.Add(P.SpawnPositionComponentName);
+
 	for (USceneComponent* SceneComp : Components)
 	{
 		FString CompName = SceneComp->GetName();
@@ -122,22 +302,31 @@ void ATrackPiece::BuildComponentCache()
 			NewPoint.ForwardPosition = SceneComp->GetRelativeLocation().X;
 
 			// Add if unique
-			bool bAlreadyRegistered = false;
-			for (const FSpawnPoint& P : SpawnPoints)
+			if (!RegisteredSpawnNames.Contains(CompName))
 			{
-				if (P.SpawnPositionComponentName == CompName) { bAlreadyRegistered = true; break; }
+				RegisteredSpawnNames.Add(CompName);
+				SpawnPoints.Add(NewPoint);
 			}
-			if (!bAlreadyRegistered) SpawnPoints.Add(NewPoint);
 		}
-
-		SceneComp->SetComponentTickEnabled(false);
 	}
 }
 
 USceneComponent* ATrackPiece::FindComponentByName(const FString& ComponentName) const
 {
 	const USceneComponent* const* FoundComponent = ComponentCache.Find(ComponentName);
-	return FoundComponent ? const_cast<USceneComponent*>(*FoundComponent) : nullptr;
+	if (FoundComponent) return const_cast<USceneComponent*>(*FoundComponent);
+
+	// Pieces with a shared layout never build the cache; lookups by name are rare there, so just search
+	if (Layout.IsValid())
+	{
+		TArray<USceneComponent*> Components;
+		GetComponents(Components);
+		for (USceneComponent* SceneComp : Components)
+		{
+			if (SceneComp->GetName() == ComponentName) return SceneComp;
+		}
+	}
+	return nullptr;
 }
 
 void ATrackPiece::DrawLaneVisualization(float Duration, float Height)
@@ -169,10 +358,17 @@ void ATrackPiece::RegisterSpawnedActor(AActor* SpawnedActor)
 	if (SpawnedActor) SpawnedActors.AddUnique(SpawnedActor);
 }
 
+void ATrackPiece::SetCoinField(ACoinField* InCoinField)
+{
+	CoinField = InCoinField;
+	RegisterSpawnedActor(InCoinField);
+}
+
 void ATrackPiece::ClearSpawnedActors()
 {
 	for (AActor* Actor : SpawnedActors) if (IsValid(Actor)) Actor->Destroy();
 	SpawnedActors.Empty();
+	CoinField = nullptr;
 }
 
 void ATrackPiece::BeginDestroy()
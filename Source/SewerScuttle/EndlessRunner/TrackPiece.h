@@ -6,10 +6,13 @@
 #include "GameFramework/Actor.h"
 #include "PlayerClass.h"
 #include "BaseContentDefinition.h"
+#include "AliasTable.h"
 #include "TrackPiece.generated.h"
 
 class UStaticMeshComponent;
 class USceneComponent;
+class ACoinField;
+class ATrackPiece;
 
 UENUM(BlueprintType)
 enum class ESpawnPointType : uint8
@@ -66,6 +69,78 @@ struct FSpawnPoint
 	FString SpawnPositionComponentName;
 };
 
+/** Definitions a spawn point can pick for one player class, with an alias table over their weights */
+struct SEWERSCUTTLE_API FSpawnCandidates
+{
+	TArray<UBaseContentDefinition*> Definitions;
+	FAliasTable Table;
+
+	/** Collect the spawn point's definitions allowed for a class */
+	void Build(const FSpawnPoint& SpawnPoint, EPlayerClass PlayerClass);
+
+	/** Pick a definition by weight (null if none is allowed) */
+	UBaseContentDefinition* Sample(FKeyedRandom& Random) const
+	{
+		const int32 Index = Table.Sample(Random);
+		return Index != INDEX_NONE ? Definitions[Index] : nullptr;
+	}
+};
+
+/**
+ * Spawn and connection layout of a track piece class, read from its class defaults (native components and
+ * Blueprint construction script templates) once and shared by every piece spawned from the same definition.
+ * Offsets are relative to the piece's actor transform.
+ */
+struct SEWERSCUTTLE_API FTrackPieceLayout
+{
+	/** Spawn points from the class's smart spawn components */
+	TArray<FSpawnPoint> SpawnPoints;
+
+	/** Location of each spawn point's component (parallel to SpawnPoints) */
+	TArray<FVector> SpawnPointOffsets;
+
+	/** Component name of each spawn point (parallel to SpawnPoints) */
+	TArray<FName> SpawnPointNames;
+
+	/** Start connection location */
+	FVector StartConnectionOffset = FVector::ZeroVector;
+
+	/** End connection locations */
+	TArray<FVector> EndConnectionOffsets;
+
+	/** Actor-relative transform of every named scene component */
+	TMap<FString, FTransform> ComponentTransforms;
+
+	/** Index of the spawn point at a component (INDEX_NONE if there is none) */
+	int32 FindSpawnSlot(FName ComponentName) const { return SpawnPointNames.IndexOfByKey(ComponentName); }
+
+	/** Candidates of a spawn point for a class (all slots are rebuilt when the class changes) */
+	const FSpawnCandidates& GetSpawnCandidates(int32 SpawnSlot, EPlayerClass PlayerClass) const;
+
+	/** Build the layout of a piece class, resolving connections by component name */
+	static TSharedRef<const FTrackPieceLayout> Build(TSubclassOf<ATrackPiece> PieceClass, const FString& StartConnectionName, const TArray<FString>& EndConnectionNames);
+
+private:
+	/** Spawn candidates per slot for CandidatesClass */
+	mutable TArray<FSpawnCandidates> SpawnCandidates;
+	mutable TOptional<EPlayerClass> CandidatesClass;
+};
+
+/** A server-prescribed spawn resolved against a piece layout (referenced so releasing a content bundle can't collect it) */
+USTRUCT()
+struct FPrescribedSlot
+{
+	GENERATED_BODY()
+
+	/** Index into the piece's spawn points */
+	UPROPERTY()
+	int32 SpawnSlot = INDEX_NONE;
+
+	/** Definition to spawn there */
+	UPROPERTY()
+	TObjectPtr<UBaseContentDefinition> Definition = nullptr;
+};
+
 /**
  * Track piece actor for endless runner
  * Contains spawn points for collectibles and obstacles
@@ -94,11 +169,26 @@ public:
 	/** Set lane width (called by Generator from DA) */
 	void SetLaneWidth(float NewWidth) { LaneWidth = NewWidth; }
 
+	/** Position of this piece in the run's track (keys its spawn random numbers) */
+	int32 GetPieceIndex() const { return PieceIndex; }
+
+	/** Set the piece's position in the track (called by Generator before FinishSpawning) */
+	void SetPieceIndex(int32 NewPieceIndex) { PieceIndex = NewPieceIndex; }
+
 	/** Get spawn points */
 	UFUNCTION(BlueprintPure, Category = "!Track")
-	const TArray<FSpawnPoint>& GetSpawnPoints() const { return SpawnPoints; }
+	const TArray<FSpawnPoint>& GetSpawnPoints() const { return Layout.IsValid() ? Layout->SpawnPoints : SpawnPoints; }
 
-	/** Add spawn point */
+	/** World location of a spawn point's component (false if the point has no positional component) */
+	bool GetSpawnPointLocation(int32 SpawnPointIndex, FVector& OutLocation) const;
+
+	/** Use a shared layout instead of scanning components (call between deferred spawn and FinishSpawning) */
+	void ApplyLayout(const TSharedRef<const FTrackPieceLayout>& InLayout) { Layout = InLayout; }
+
+	/** Shared layout (null for pieces that scanned their own components) */
+	const FTrackPieceLayout* GetLayout() const { return Layout.Get(); }
+
+	/** Add spawn point (only used by pieces without a shared layout) */
 	UFUNCTION(BlueprintCallable, Category = "!Track")
 	void AddSpawnPoint(const FSpawnPoint& SpawnPoint);
 
@@ -130,11 +220,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "!Track")
 	void SetEndConnectionsByNames(const TArray<FString>& ComponentNames);
 
-	/** Set prescribed spawns from server */
-	void SetPrescribedSpawns(const TMap<FString, FString>& Spawns) { PrescribedSpawns = Spawns; bHasPrescribedSpawns = true; }
+	/** Set prescribed spawns from server, sorted by spawn slot (slots without one stay empty) */
+	void SetPrescribedSpawns(TConstArrayView<FPrescribedSlot> Spawns) { PrescribedSlots = Spawns; bHasPrescribedSpawns = true; }
 
-	/** Get prescribed spawn for a component */
-	FString GetPrescribedSpawn(const FString& ComponentName) const { const FString* S = PrescribedSpawns.Find(ComponentName); return S ? *S : TEXT(""); }
+	/** Get the prescribed definition for a spawn slot (null if the server left it empty) */
+	UBaseContentDefinition* GetPrescribedSpawn(int32 SpawnSlot) const;
 
 	/** Check if this piece has server-prescribed spawns */
 	bool HasPrescribedSpawns() const { return bHasPrescribedSpawns; }
@@ -158,6 +248,12 @@ public:
 	/** Clear all spawned actors (called when track piece is destroyed) */
 	void ClearSpawnedActors();
 
+	/** Instanced coins spawned on this piece (null until the first coin spawns) */
+	ACoinField* GetCoinField() const { return CoinField; }
+
+	/** Set the coin field (also registered as a spawned actor) */
+	void SetCoinField(ACoinField* InCoinField);
+
 	/** Find a Scene component by name (uses cached lookup for performance) */
 	UFUNCTION(BlueprintPure, Category = "!Track")
 	USceneComponent* FindComponentByName(const FString& ComponentName) const;
@@ -196,13 +292,21 @@ protected:
 	UPROPERTY(VisibleInstanceOnly, Category = "!Track")
 	float LaneWidth = 200.0f;
 
+	/** Position in the run's track (Applied by Generator) */
+	UPROPERTY(VisibleInstanceOnly, Category = "!Track")
+	int32 PieceIndex = INDEX_NONE;
+
 	/** Actors spawned on this track piece (coins, obstacles, powerups, etc.) */
 	UPROPERTY()
 	TArray<AActor*> SpawnedActors;
 
-	/** Prescribed spawns from server (ComponentName -> DefID) */
+	/** Coin field for plain coins spawned on this piece */
 	UPROPERTY()
-	TMap<FString, FString> PrescribedSpawns;
+	ACoinField* CoinField = nullptr;
+
+	/** Prescribed spawns from server, sorted by spawn slot */
+	UPROPERTY()
+	TArray<FPrescribedSlot> PrescribedSlots;
 
 	/** Flag indicating if this piece has prescribed spawns from the server */
 	UPROPERTY()
@@ -211,6 +315,9 @@ protected:
 	/** Cached component lookup map (name -> component) for fast access */
 	UPROPERTY()
 	TMap<FString, USceneComponent*> ComponentCache;
+
+	/** Layout shared with other pieces of the same definition */
+	TSharedPtr<const FTrackPieceLayout> Layout;
 };
 
 /**
@@ -5,3 +5,56 @@
 // UDataAsset constructors cannot initialize member variables
 // Initialize defaults in the header file instead
 
+TSharedRef<const FTrackPieceLayout> UTrackPieceDefinition::GetLayout(TSubclassOf<ATrackPiece> DefaultPieceClass) const
+{
+	const TSubclassOf<ATrackPiece> PieceClass = GetPieceClass(DefaultPieceClass);
+	if (!CachedLayout.IsValid() || CachedLayoutClass != PieceClass)
+	{
+		const FString StartName = (bUseBlueprintActor && !StartConnectionComponentName.IsEmpty()) ? StartConnectionComponentName : TEXT("StartConnection");
+		const TArray<FString> EndNames = (bUseBlueprintActor && EndConnectionComponentNames.Num() > 0) ? EndConnectionComponentNames : TArray<FString>{ TEXT("EndConnection") };
+		CachedLayout = FTrackPieceLayout::Build(PieceClass, StartName, EndNames);
+		CachedLayoutClass = PieceClass;
+	}
+	return CachedLayout.ToSharedRef();
+}
+
+#if WITH_EDITOR
+void UTrackPieceDefinition::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddUObject(this, &UTrackPieceDefinition::OnObjectsReplaced);
+	}
+}
+
+void UTrackPieceDefinition::BeginDestroy()
+{
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	Super::BeginDestroy();
+}
+
+void UTrackPieceDefinition::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	if (!CachedLayout.IsValid()) return;
+
+	// Recompiling a piece Blueprint reinstances its class defaults, which the layout was read from
+	for (const TPair<UObject*, UObject*>& Pair : ReplacementMap)
+	{
+		if (Pair.Value && Pair.Value->IsA<ATrackPiece>())
+		{
+			CachedLayout.Reset();
+			return;
+		}
+	}
+}
+
+void UTrackPieceDefinition::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Connection names or the piece class may have changed
+	CachedLayout.Reset();
+}
+#endif
@@ -129,5 +129,28 @@ public:
 	/** Weight for random selection (higher = more likely) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Selection", meta = (ClampMin = "1"))
 	int32 SelectionWeight = 1;
+
+	/** Class spawned for this definition (the blueprint actor, or DefaultPieceClass for procedural pieces) */
+	TSubclassOf<ATrackPiece> GetPieceClass(TSubclassOf<ATrackPiece> DefaultPieceClass) const { return (bUseBlueprintActor && BlueprintActorClass) ? BlueprintActorClass : DefaultPieceClass; }
+
+	/** Spawn and connection layout of the piece class, built from its class defaults on first use and shared by all its pieces */
+	TSharedRef<const FTrackPieceLayout> GetLayout(TSubclassOf<ATrackPiece> DefaultPieceClass) const;
+
+#if WITH_EDITOR
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	mutable TSharedPtr<const FTrackPieceLayout> CachedLayout;
+	mutable TSubclassOf<ATrackPiece> CachedLayoutClass;
+
+#if WITH_EDITOR
+	/** Drop the layout when a piece Blueprint is recompiled (its class defaults and templates are replaced) */
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+
+	FDelegateHandle ObjectsReplacedHandle;
+#endif
 };
 
@@ -19,6 +19,12 @@ void UWebServerInterface::Initialize()
 	}
 }
 
+namespace
+{
+	/** Prefetched seeds older than this are dropped rather than used (the backend keeps seeds for 24h) */
+	constexpr double PrefetchedSeedMaxAgeSeconds = 30.0 * 60.0;
+}
+
 void UWebServerInterface::RequestRunSeed(int32 MaxDistance, EPlayerClass PlayerClass)
 {
 	if (!HttpClient)
@@ -26,8 +32,121 @@ void UWebServerInterface::RequestRunSeed(int32 MaxDistance, EPlayerClass PlayerC
 		Initialize();
 	}
 
+	// Serve from the speculative seed when it matches
+	if (MaxDistance <= 0 && PrefetchState != EPrefetchState::None && PrefetchClass == PlayerClass)
+	{
+		if (PrefetchState == EPrefetchState::InFlight)
+		{
+			UE_LOG(LogTemp, Log, TEXT("WebServerInterface: Run seed prefetch in flight, delivering it on arrival"));
+			bDeliverPrefetchOnArrival = true;
+			return;
+		}
+
+		PrefetchState = EPrefetchState::None;
+		if (FPlatformTime::Seconds() - PrefetchedAt < PrefetchedSeedMaxAgeSeconds)
+		{
+			UE_LOG(LogTemp, Log, TEXT("WebServerInterface: Using prefetched run seed %s"), *PrefetchedSelection.SeedId);
+			DeliverRunSeed(PrefetchedSelection);
+			return;
+		}
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("WebServerInterface: Requesting run seed (max_distance: %d)"), MaxDistance);
 
+	HttpClient->Post(TEXT("/runs/start"), BuildRunSeedRequestBody(MaxDistance, PlayerClass), 
+		FOnHttpResponse::CreateLambda([this](int32 ResponseCode, const FString& ResponseBody)
+		{
+			OnSeedResponse(ResponseCode, ResponseBody);
+		}),
+		FOnHttpError::CreateLambda([this](int32 ResponseCode, const FString& ErrorMessage, const FString& ResponseBody)
+		{
+			OnHttpError(ResponseCode, ErrorMessage, ResponseBody);
+		}));
+}
+
+void UWebServerInterface::PrefetchRunSeed(EPlayerClass PlayerClass, FSimpleDelegate OnComplete)
+{
+	if (!HttpClient)
+	{
+		Initialize();
+	}
+
+	if (PrefetchState == EPrefetchState::InFlight)
+	{
+		OnComplete.ExecuteIfBound();
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("WebServerInterface: Prefetching run seed for %s"), *FPlayerClassData::PlayerClassToString(PlayerClass));
+
+	PrefetchState = EPrefetchState::InFlight;
+	PrefetchClass = PlayerClass;
+	bDeliverPrefetchOnArrival = false;
+	OnPrefetchComplete = OnComplete;
+
+	HttpClient->Post(TEXT("/runs/start"), BuildRunSeedRequestBody(0, PlayerClass),
+		FOnHttpResponse::CreateLambda([this](int32 ResponseCode, const FString& ResponseBody)
+		{
+			OnPrefetchSeedResponse(ResponseCode, ResponseBody);
+		}),
+		FOnHttpError::CreateLambda([this](int32 ResponseCode, const FString& ErrorMessage, const FString& ResponseBody)
+		{
+			OnPrefetchSeedResponse(ResponseCode, ResponseBody);
+		}));
+}
+
+void UWebServerInterface::OnPrefetchSeedResponse(int32 ResponseCode, const FString& ResponseBody)
+{
+	FTrackSelectionData SelectionData;
+	const bool bParsed = ResponseCode >= 200 && ResponseCode < 300 && ParseRunSeedResponse(ResponseBody, SelectionData);
+	const bool bDeliver = bDeliverPrefetchOnArrival;
+	bDeliverPrefetchOnArrival = false;
+
+	if (bParsed && !bDeliver)
+	{
+		PrefetchState = EPrefetchState::Ready;
+		PrefetchedSelection = SelectionData;
+		PrefetchedAt = FPlatformTime::Seconds();
+	}
+	else
+	{
+		PrefetchState = EPrefetchState::None;
+		if (!bParsed) UE_LOG(LogTemp, Warning, TEXT("WebServerInterface: Run seed prefetch failed (HTTP %d)"), ResponseCode);
+	}
+
+	FSimpleDelegate Completed = MoveTemp(OnPrefetchComplete);
+	Completed.ExecuteIfBound();
+
+	// Play was pressed while this was in flight
+	if (bDeliver)
+	{
+		if (bParsed) DeliverRunSeed(SelectionData);
+		else if (OnError.IsBound()) OnError.Execute(FString::Printf(TEXT("Failed to get seed (HTTP %d)"), ResponseCode));
+	}
+}
+
+void UWebServerInterface::WarmUp(FSimpleDelegate OnComplete)
+{
+	if (!HttpClient)
+	{
+		Initialize();
+	}
+
+	// /me sits behind the auth middleware: a signed-in player's token is validated, anyone else gets a cheap 401
+	const double StartTime = FPlatformTime::Seconds();
+	auto Finish = [StartTime, OnComplete](int32 ResponseCode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("WebServerInterface: Connection warm-up finished (HTTP %d) in %.1fms"), ResponseCode, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		OnComplete.ExecuteIfBound();
+	};
+
+	HttpClient->Get(TEXT("/me"),
+		FOnHttpResponse::CreateLambda([Finish](int32 ResponseCode, const FString& ResponseBody) { Finish(ResponseCode); }),
+		FOnHttpError::CreateLambda([Finish](int32 ResponseCode, const FString& ErrorMessage, const FString& ResponseBody) { Finish(ResponseCode); }));
+}
+
+FString UWebServerInterface::BuildRunSeedRequestBody(int32 MaxDistance, EPlayerClass PlayerClass) const
+{
 	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
 	if (MaxDistance > 0)
 	{
@@ -46,16 +165,7 @@ void UWebServerInterface::RequestRunSeed(int32 MaxDistance, EPlayerClass PlayerC
 	FString RequestBody;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-
-	HttpClient->Post(TEXT("/runs/start"), RequestBody, 
-		FOnHttpResponse::CreateLambda([this](int32 ResponseCode, const FString& ResponseBody)
-		{
-			OnSeedResponse(ResponseCode, ResponseBody);
-		}),
-		FOnHttpError::CreateLambda([this](int32 ResponseCode, const FString& ErrorMessage, const FString& ResponseBody)
-		{
-			OnHttpError(ResponseCode, ErrorMessage, ResponseBody);
-		}));
+	return RequestBody;
 }
 
 void UWebServerInterface::OnSeedResponse(int32 ResponseCode, const FString& ResponseBody)
@@ -65,59 +175,10 @@ void UWebServerInterface::OnSeedResponse(int32 ResponseCode, const FString& Resp
 
 	if (ResponseCode >= 200 && ResponseCode < 300)
 	{
-		TSharedPtr<FJsonObject> JsonObject;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseBody);
-
-		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+		FTrackSelectionData SelectionData;
+		if (ParseRunSeedResponse(ResponseBody, SelectionData))
 		{
-			FTrackSelectionData SelectionData;
-			SelectionData.SeedId = JsonObject->GetStringField(TEXT("seed_id"));
-            SelectionData.Seed = JsonObject->GetIntegerField(TEXT("seed"));
-            SelectionData.ContentVersion = JsonObject->GetStringField(TEXT("content_version"));
-			SelectionData.Tier = JsonObject->GetIntegerField(TEXT("tier"));
-
-			UE_LOG(LogTemp, Warning, TEXT("WebServerInterface: Received SeedId: %s, Seed: %d"), *SelectionData.SeedId, SelectionData.Seed);
-            
-			const TArray<TSharedPtr<FJsonValue>>* TracksArray;
-			if (JsonObject->TryGetArrayField(TEXT("tracks"), TracksArray))
-			{
-				for (const TSharedPtr<FJsonValue>& TrackValue : *TracksArray)
-				{
-					if (TrackValue->Type == EJson::Object)
-					{
-						TSharedPtr<FJsonObject> TrackObject = TrackValue->AsObject();
-						FTrackInfo TrackInfo;
-						TrackInfo.Id = TrackObject->GetIntegerField(TEXT("id"));
-						TrackInfo.Length = TrackObject->GetIntegerField(TEXT("length"));
-						TrackInfo.ShopCount = TrackObject->GetIntegerField(TEXT("shop_count"));
-						TrackInfo.BossId = TrackObject->GetStringField(TEXT("boss_id"));
-						SelectionData.Tracks.Add(TrackInfo);
-					}
-				}
-			}
-            
-            // Also parse seed data for backward compatibility
-            FRunSeedData SeedData;
-            SeedData.SeedId = SelectionData.SeedId;
-            SeedData.Seed = SelectionData.Seed;
-            SeedData.ContentVersion = SelectionData.ContentVersion;
-            SeedData.MaxCoins = 0;
-            SeedData.MaxObstacles = 0;
-            SeedData.MaxTrackPieces = 0;
-            SeedData.MaxDistance = 0;
-
-			UE_LOG(LogTemp, Warning, TEXT("WebServerInterface: Track selection parsed - SeedId: %s, Tier: %d, Tracks: %d"), 
-				*SelectionData.SeedId, SelectionData.Tier, SelectionData.Tracks.Num());
-
-			if (OnTrackSelectionReceived.IsBound())
-			{
-				OnTrackSelectionReceived.Execute(SelectionData);
-			}
-            
-            if (OnSeedReceived.IsBound())
-            {
-                OnSeedReceived.Execute(SeedData);
-            }
+			DeliverRunSeed(SelectionData);
 		}
 		else
 		{
@@ -132,6 +193,69 @@ void UWebServerInterface::OnSeedResponse(int32 ResponseCode, const FString& Resp
 	}
 }
 
+bool UWebServerInterface::ParseRunSeedResponse(const FString& ResponseBody, FTrackSelectionData& SelectionData) const
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseBody);
+
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	SelectionData.SeedId = JsonObject->GetStringField(TEXT("seed_id"));
+	SelectionData.Seed = JsonObject->GetIntegerField(TEXT("seed"));
+	SelectionData.ContentVersion = JsonObject->GetStringField(TEXT("content_version"));
+	SelectionData.Tier = JsonObject->GetIntegerField(TEXT("tier"));
+
+	UE_LOG(LogTemp, Warning, TEXT("WebServerInterface: Received SeedId: %s, Seed: %d"), *SelectionData.SeedId, SelectionData.Seed);
+
+	const TArray<TSharedPtr<FJsonValue>>* TracksArray;
+	if (JsonObject->TryGetArrayField(TEXT("tracks"), TracksArray))
+	{
+		for (const TSharedPtr<FJsonValue>& TrackValue : *TracksArray)
+		{
+			if (TrackValue->Type == EJson::Object)
+			{
+				TSharedPtr<FJsonObject> TrackObject = TrackValue->AsObject();
+				FTrackInfo TrackInfo;
+				TrackInfo.Id = TrackObject->GetIntegerField(TEXT("id"));
+				TrackInfo.Length = TrackObject->GetIntegerField(TEXT("length"));
+				TrackInfo.ShopCount = TrackObject->GetIntegerField(TEXT("shop_count"));
+				TrackInfo.BossId = TrackObject->GetStringField(TEXT("boss_id"));
+				SelectionData.Tracks.Add(TrackInfo);
+			}
+		}
+	}
+	return true;
+}
+
+void UWebServerInterface::DeliverRunSeed(const FTrackSelectionData& SelectionData)
+{
+	// Also parse seed data for backward compatibility
+	FRunSeedData SeedData;
+	SeedData.SeedId = SelectionData.SeedId;
+	SeedData.Seed = SelectionData.Seed;
+	SeedData.ContentVersion = SelectionData.ContentVersion;
+	SeedData.MaxCoins = 0;
+	SeedData.MaxObstacles = 0;
+	SeedData.MaxTrackPieces = 0;
+	SeedData.MaxDistance = 0;
+
+	UE_LOG(LogTemp, Warning, TEXT("WebServerInterface: Track selection parsed - SeedId: %s, Tier: %d, Tracks: %d"), 
+		*SelectionData.SeedId, SelectionData.Tier, SelectionData.Tracks.Num());
+
+	if (OnTrackSelectionReceived.IsBound())
+	{
+		OnTrackSelectionReceived.Execute(SelectionData);
+	}
+
+	if (OnSeedReceived.IsBound())
+	{
+		OnSeedReceived.Execute(SeedData);
+	}
+}
+
 void UWebServerInterface::SelectTrack(const FString& SeedId, int32 Tier, int32 TrackIndex)
 {
 	if (!HttpClient) Initialize();
@@ -175,7 +299,7 @@ void UWebServerInterface::OnTrackSequenceResponse(int32 ResponseCode, const FStr
                     {
                         TSharedPtr<FJsonObject> PieceObj = Value->AsObject();
                         FTrackPiecePrescription Prescription;
-                        Prescription.PieceId = PieceObj->GetStringField(TEXT("id"));
+                        Prescription.PieceId = FName(*PieceObj->GetStringField(TEXT("id")));
                         
                         const TSharedPtr<FJsonObject>* SpawnMap;
                         if (PieceObj->TryGetObjectField(TEXT("spawns"), SpawnMap) && SpawnMap->IsValid())
@@ -184,7 +308,7 @@ void UWebServerInterface::OnTrackSequenceResponse(int32 ResponseCode, const FStr
                             {
                                 if (Pair.Value->Type == EJson::String)
                                 {
-                                    Prescription.PrescribedSpawns.Add(Pair.Key, Pair.Value->AsString());
+                                    SequenceData.AddSpawn(Prescription, Pair.Key, Pair.Value->AsString());
                                 }
                             }
                         }
@@ -395,20 +519,20 @@ void UWebServerInterface::OnBossRewardsResponse(int32 ResponseCode, const FStrin
 	}
 }
 
-void UWebServerInterface::FetchLeaderboard(const FString& Timeframe, const FString& PlayerClass)
+void UWebServerInterface::FetchLeaderboard(const FString& Timeframe, const FString& PlayerClass, int32 Offset, int32 Limit)
 {
 	if (!HttpClient) Initialize();
 
-	FString Endpoint = FString::Printf(TEXT("/leaderboard?timeframe=%s"), *Timeframe);
+	FString Endpoint = FString::Printf(TEXT("/leaderboard?timeframe=%s&offset=%d&limit=%d"), *Timeframe, FMath::Max(Offset, 0), FMath::Clamp(Limit, 1, 100));
 	if (!PlayerClass.IsEmpty())
 	{
 		Endpoint += FString::Printf(TEXT("&class=%s"), *PlayerClass);
 	}
 
 	HttpClient->Get(Endpoint,
-		FOnHttpResponse::CreateLambda([this](int32 ResponseCode, const FString& ResponseBody)
+		FOnHttpResponse::CreateLambda([this, Timeframe, PlayerClass, Offset, Limit](int32 ResponseCode, const FString& ResponseBody)
 		{
-			OnLeaderboardResponse(ResponseCode, ResponseBody);
+			OnLeaderboardResponse(ResponseCode, ResponseBody, Timeframe, PlayerClass, Offset, Limit);
 		}),
 		FOnHttpError::CreateLambda([this](int32 ResponseCode, const FString& ErrorMessage, const FString& ResponseBody)
 		{
@@ -416,7 +540,7 @@ void UWebServerInterface::FetchLeaderboard(const FString& Timeframe, const FStri
 		}));
 }
 
-void UWebServerInterface::OnLeaderboardResponse(int32 ResponseCode, const FString& ResponseBody)
+void UWebServerInterface::OnLeaderboardResponse(int32 ResponseCode, const FString& ResponseBody, const FString& Timeframe, const FString& PlayerClass, int32 Offset, int32 Limit)
 {
 	if (ResponseCode >= 200 && ResponseCode < 300)
 	{
@@ -425,7 +549,12 @@ void UWebServerInterface::OnLeaderboardResponse(int32 ResponseCode, const FStrin
 
 		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
 		{
-			TArray<FLeaderboardEntryData> Entries;
+			// Tag the page with the query that produced it so late responses for another tab land in the right place
+			FLeaderboardPageData Page;
+			Page.Timeframe = Timeframe;
+			Page.PlayerClass = PlayerClass;
+			Page.Offset = Offset;
+
 			const TArray<TSharedPtr<FJsonValue>>* EntriesArray;
 			if (JsonObject->TryGetArrayField(TEXT("entries"), EntriesArray))
 			{
@@ -439,23 +568,39 @@ void UWebServerInterface::OnLeaderboardResponse(int32 ResponseCode, const FStrin
 					Entry.SeedId = Obj->GetStringField(TEXT("seed_id"));
 					Entry.Seed = Obj->GetIntegerField(TEXT("track_seed"));
 					Entry.bHasReplay = Obj->GetBoolField(TEXT("has_replay"));
+
+					// Runs submitted before the version was recorded were generated with the legacy stream
+					if (!Obj->TryGetNumberField(TEXT("rng_version"), Entry.RngVersion))
+					{
+						Entry.RngVersion = RunRngVersion::Legacy;
+					}
 					
 					FString ClassStr = Obj->GetStringField(TEXT("player_class"));
 					Entry.PlayerClass = FPlayerClassData::StringToPlayerClass(ClassStr);
+
+					if (!Obj->TryGetNumberField(TEXT("rank"), Entry.Rank))
+					{
+						Entry.Rank = Offset + Page.Entries.Num() + 1;
+					}
 					
-					Entries.Add(Entry);
+					Page.Entries.Add(Entry);
 				}
 			}
 
-			int32 PlayerRank = 0;
+			// Older servers don't report has_more; a full page means there may be another
+			if (!JsonObject->TryGetBoolField(TEXT("has_more"), Page.bHasMore))
+			{
+				Page.bHasMore = Page.Entries.Num() >= Limit;
+			}
+
 			if (JsonObject->HasField(TEXT("player_rank")))
 			{
-				PlayerRank = JsonObject->GetIntegerField(TEXT("player_rank"));
+				Page.PlayerRank = JsonObject->GetIntegerField(TEXT("player_rank"));
 			}
 
 			if (OnLeaderboardReceived.IsBound())
 			{
-				OnLeaderboardReceived.Execute(Entries, PlayerRank);
+				OnLeaderboardReceived.Execute(Page);
 			}
 		}
 	}
@@ -522,7 +667,7 @@ void UWebServerInterface::OnTrackSelectionResponse(int32 ResponseCode, const FSt
 void UWebServerInterface::SubmitRun(const FString& SeedId, int32 Score, int32 Distance, int32 DurationSeconds,
 	int32 CoinsCollected, int32 ObstaclesHit, int32 PowerupsUsed, int32 TrackPiecesSpawned,
 	const FString& StartedAt, const TArray<int32>& SelectedTracks, bool bIsComplete, bool bIsEndless,
-	const TArray<FString>& PieceSequence, const FString& PlayerClass, const TArray<FReplayEvent>& ReplayData)
+	const TArray<FString>& PieceSequence, const FString& PlayerClass, int32 RngVersion, const TArray<FReplayEvent>& ReplayData)
 {
 	if (!HttpClient) Initialize();
 
@@ -539,6 +684,7 @@ void UWebServerInterface::SubmitRun(const FString& SeedId, int32 Score, int32 Di
 	JsonObject->SetStringField(TEXT("started_at"), StartedAt);
 	JsonObject->SetBoolField(TEXT("is_complete"), bIsComplete);
 	JsonObject->SetBoolField(TEXT("is_endless"), bIsEndless);
+	JsonObject->SetNumberField(TEXT("rng_version"), RngVersion);
 
 	TArray<TSharedPtr<FJsonValue>> SelectedTracksJson;
 	for (int32 Index : SelectedTracks) SelectedTracksJson.Add(MakeShareable(new FJsonValueNumber(Index)));
@@ -125,6 +125,21 @@ struct FBossRewardData
 	TMap<FString, FString> Properties;
 };
 
+/** A spawn the server prescribed for one slot of a track piece */
+USTRUCT(BlueprintType)
+struct FPrescribedSpawn
+{
+    GENERATED_BODY()
+
+    /** Spawn component name */
+    UPROPERTY(BlueprintReadWrite)
+    FName SlotName;
+
+    /** Index into the sequence's DefinitionIds */
+    UPROPERTY(BlueprintReadWrite)
+    int32 DefinitionIndex = INDEX_NONE;
+};
+
 /** Track piece with prescribed spawns */
 USTRUCT(BlueprintType)
 struct FTrackPiecePrescription
@@ -132,11 +147,11 @@ struct FTrackPiecePrescription
     GENERATED_BODY()
 
     UPROPERTY(BlueprintReadWrite)
-    FString PieceId;
+    FName PieceId;
 
-    /** Map of component name to specific definition ID to spawn */
+    /** Prescribed spawns, one per filled slot */
     UPROPERTY(BlueprintReadWrite)
-    TMap<FString, FString> PrescribedSpawns;
+    TArray<FPrescribedSpawn> Spawns;
 };
 
 /** Track sequence data (from /runs/select-track) */
@@ -148,6 +163,10 @@ struct FTrackSequenceData
 	UPROPERTY(BlueprintReadWrite)
 	TArray<FTrackPiecePrescription> Pieces;
 
+	/** Definition IDs referenced by the pieces' spawns, each listed once */
+	UPROPERTY(BlueprintReadWrite)
+	TArray<FName> DefinitionIds;
+
 	UPROPERTY(BlueprintReadWrite)
 	TArray<int32> ShopPositions;
 
@@ -167,6 +186,14 @@ struct FTrackSequenceData
 	/** Pre-determined reward options for the boss at the end of the tier */
 	UPROPERTY(BlueprintReadWrite)
 	TArray<FBossRewardData> BossRewards;
+
+	/** Add a spawn to a piece, interning its definition ID */
+	void AddSpawn(FTrackPiecePrescription& Piece, const FString& SlotName, const FString& DefinitionId)
+	{
+		FPrescribedSpawn& Spawn = Piece.Spawns.AddDefaulted_GetRef();
+		Spawn.SlotName = FName(*SlotName);
+		Spawn.DefinitionIndex = DefinitionIds.AddUnique(FName(*DefinitionId));
+	}
 };
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnSeedReceived, const FRunSeedData&, SeedData);
@@ -176,7 +203,7 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FOnTrackSequenceReceived, const FTrackSequence
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnShopItemsReceived, const FShopData&, ShopData);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnBossRewardsReceived, const TArray<FBossRewardData>&, Rewards);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnReplayReceived, const TArray<FReplayEvent>&, ReplayData);
-DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnLeaderboardReceived, const TArray<FLeaderboardEntryData>&, Entries, int32, PlayerRank);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnLeaderboardReceived, const FLeaderboardPageData&, Page);
 
 /**
  * Handles communication with the backend web server
@@ -191,24 +218,33 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Web Server")
 	void Initialize();
 
-	/** Request a new run seed */
+	/** Request a new run seed (served from a prefetched seed for the same class when one is available) */
 	UFUNCTION(BlueprintCallable, Category = "Web Server")
 	void RequestRunSeed(int32 MaxDistance, EPlayerClass PlayerClass);
 
+	/**
+	 * Speculatively request a run seed so pressing Play doesn't wait on the round trip.
+	 * The seed is held until RequestRunSeed asks for the same class; OnComplete fires when the request finishes.
+	 */
+	void PrefetchRunSeed(EPlayerClass PlayerClass, FSimpleDelegate OnComplete = FSimpleDelegate());
+
+	/** Open the connection to the backend with a cheap request (any response counts), OnComplete fires either way */
+	void WarmUp(FSimpleDelegate OnComplete);
+
 	/** Submit a completed run */
 	UFUNCTION(BlueprintCallable, Category = "Web Server")
 	void SubmitRun(const FString& SeedId, int32 Score, int32 Distance, int32 DurationSeconds,
 		int32 CoinsCollected, int32 ObstaclesHit, int32 PowerupsUsed, int32 TrackPiecesSpawned,
 		const FString& StartedAt, const TArray<int32>& SelectedTracks, bool bIsComplete, bool bIsEndless,
-		const TArray<FString>& PieceSequence, const FString& PlayerClass, const TArray<FReplayEvent>& ReplayData);
+		const TArray<FString>& PieceSequence, const FString& PlayerClass, int32 RngVersion, const TArray<FReplayEvent>& ReplayData);
 
 	/** Fetch replay data for a run */
 	UFUNCTION(BlueprintCallable, Category = "Web Server")
 	void FetchReplayData(int32 RunId);
 
-	/** Fetch leaderboard data */
+	/** Fetch one page of leaderboard entries, starting at rank Offset + 1 */
 	UFUNCTION(BlueprintCallable, Category = "Web Server")
-	void FetchLeaderboard(const FString& Timeframe = TEXT("all-time"), const FString& PlayerClass = TEXT(""));
+	void FetchLeaderboard(const FString& Timeframe = TEXT("all-time"), const FString& PlayerClass = TEXT(""), int32 Offset = 0, int32 Limit = 25);
 
 	/** Select a track for the current tier */
 	UFUNCTION(BlueprintCallable, Category = "Web Server")
@@ -253,6 +289,18 @@ public:
 	void SetOnLeaderboardReceived(FOnLeaderboardReceived Delegate) { OnLeaderboardReceived = Delegate; }
 
 protected:
+	/** Build the /runs/start request body */
+	FString BuildRunSeedRequestBody(int32 MaxDistance, EPlayerClass PlayerClass) const;
+
+	/** Parse a /runs/start response body */
+	bool ParseRunSeedResponse(const FString& ResponseBody, FTrackSelectionData& OutSelection) const;
+
+	/** Fire the seed delegates for a parsed /runs/start response */
+	void DeliverRunSeed(const FTrackSelectionData& SelectionData);
+
+	/** Handle the prefetch response */
+	void OnPrefetchSeedResponse(int32 ResponseCode, const FString& ResponseBody);
+
 	/** Handle seed response */
 	void OnSeedResponse(int32 ResponseCode, const FString& ResponseBody);
 
@@ -275,7 +323,7 @@ protected:
 	void OnReplayResponse(int32 ResponseCode, const FString& ResponseBody);
 
 	/** Handle leaderboard response */
-	void OnLeaderboardResponse(int32 ResponseCode, const FString& ResponseBody);
+	void OnLeaderboardResponse(int32 ResponseCode, const FString& ResponseBody, const FString& Timeframe, const FString& PlayerClass, int32 Offset, int32 Limit);
 
 	/** Handle HTTP error */
 	void OnHttpError(int32 ResponseCode, const FString& ErrorMessage, const FString& ResponseBody);
@@ -311,4 +359,15 @@ protected:
 
 	UPROPERTY()
 	FOnLeaderboardReceived OnLeaderboardReceived;
+
+	/** Speculative seed state */
+	enum class EPrefetchState : uint8 { None, InFlight, Ready };
+	EPrefetchState PrefetchState = EPrefetchState::None;
+	EPlayerClass PrefetchClass = EPlayerClass::Vanilla;
+	FTrackSelectionData PrefetchedSelection;
+	double PrefetchedAt = 0.0;
+	FSimpleDelegate OnPrefetchComplete;
+
+	/** RequestRunSeed arrived while the prefetch was in flight; deliver it as soon as it lands */
+	bool bDeliverPrefetchOnArrival = false;
 };
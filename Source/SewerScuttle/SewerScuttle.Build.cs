@@ -24,7 +24,11 @@ public class SewerScuttle : ModuleRules
 			"DeveloperSettings"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] {  });
+		// The mock backend is compiled out of shipping builds, so only link its server there
+		if (Target.Configuration != UnrealTargetConfiguration.Shipping)
+		{
+			PrivateDependencyModuleNames.AddRange(new string[] { "HTTPServer" });
+		}
 
 		// Add include paths for subdirectories so cross-directory includes work
 		PublicIncludePaths.Add(ModuleDirectory);
@@ -16,6 +16,9 @@
 #include "EndlessRunner/CurrencyManager.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Widgets/SWeakWidget.h"
+#include "Widgets/SNullWidget.h"
+#include "Widgets/SOverlay.h"
+#include "Widgets/Layout/SWidgetSwitcher.h"
 #include "Engine/Engine.h"
 #include "GameFramework/PlayerController.h"
 
@@ -26,21 +29,98 @@ AEndlessRunnerHUD::AEndlessRunnerHUD()
 void AEndlessRunnerHUD::BeginPlay()
 {
 	Super::BeginPlay();
+	ConstructScreens();
 	ShowMainMenu();
 }
 
-void AEndlessRunnerHUD::ShowMainMenu()
+void AEndlessRunnerHUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	HideAllWidgets();
-	if (GEngine && GEngine->GameViewport)
+	if (ViewportRoot.IsValid() && GEngine && GEngine->GameViewport)
 	{
-		SAssignNew(MainMenuWidget, SMainMenuWidget)
-			.OnPlayClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnPlayClicked))
-			.OnShopClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnShopClicked))
-			.OnLeaderboardClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnLeaderboardClicked))
-			.OnSettingsClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnSettingsClicked));
+		GEngine->GameViewport->RemoveViewportWidgetContent(ViewportRoot.ToSharedRef());
+	}
+	ViewportRoot.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AEndlessRunnerHUD::ConstructScreens()
+{
+	if (ScreenSwitcher.IsValid() || !GEngine || !GEngine->GameViewport) return;
+
+	// Screens are built once up front and afterwards only switched to and refreshed with new data. Class selection
+	// is the exception: it loads every class definition, so it is built the first time it is shown
+	SAssignNew(MainMenuWidget, SMainMenuWidget)
+		.OnPlayClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnPlayClicked))
+		.OnShopClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnShopClicked))
+		.OnLeaderboardClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnLeaderboardClicked))
+		.OnSettingsClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnSettingsClicked));
+
+	SAssignNew(InGameHUDWidget, SEndlessRunnerHUD, Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()));
+
+	SAssignNew(TrackSelectionWidget, STrackSelectionWidget)
+		.OnTrackSelected(FOnTrackSelected::CreateUObject(this, &AEndlessRunnerHUD::OnTrackSelected));
+
+	SAssignNew(ShopWidget, SShopWidget)
+		.OnBackClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnShopExited))
+		.OnPurchaseItem(FOnPurchaseItem::CreateUObject(this, &AEndlessRunnerHUD::OnPurchaseItem));
+
+	SAssignNew(BossRewardWidget, SBossRewardWidget)
+		.OnRewardSelected(FOnRewardSelected::CreateUObject(this, &AEndlessRunnerHUD::OnRewardSelected));
+
+	SAssignNew(EndlessModePromptWidget, SEndlessModePromptWidget)
+		.OnEndlessModeSelected(FOnEndlessModeSelected::CreateUObject(this, &AEndlessRunnerHUD::OnEndlessModeSelected))
+		.OnEndlessModeDeclined(FOnEndlessModeDeclined::CreateUObject(this, &AEndlessRunnerHUD::OnEndlessModeDeclined));
+
+	SAssignNew(GameOverWidget, SGameOverWidget, 0, 0.0f, 0.0f)
+		.OnNewRunClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnNewRunClicked))
+		.OnChangeClassClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::ShowClassSelection))
+		.OnExitClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::ShowMainMenu));
+
+	SAssignNew(PauseWidget, SPauseWidget, 0)
+		.OnResumeClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::TogglePause))
+		.OnNewRunClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnNewRunClicked))
+		.OnMainMenuClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::ShowMainMenu));
+
+	SAssignNew(LeaderboardWidget, SLeaderboardWidget)
+		.OnBackClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::ShowMainMenu))
+		.OnWatchReplayClicked(FOnWatchReplayClicked::CreateUObject(this, &AEndlessRunnerHUD::OnWatchReplayClicked))
+		.OnRaceReplayClicked(FOnRaceReplayClicked::CreateUObject(this, &AEndlessRunnerHUD::OnRaceReplayClicked))
+		.OnPageRequested(FOnLeaderboardPageRequested::CreateUObject(this, &AEndlessRunnerHUD::OnLeaderboardPageRequested));
+
+	EmptyScreen = SNullWidget::NullWidget;
+
+	SAssignNew(ScreenSwitcher, SWidgetSwitcher)
+		+ SWidgetSwitcher::Slot()[ EmptyScreen.ToSharedRef() ]
+		+ SWidgetSwitcher::Slot()[ MainMenuWidget.ToSharedRef() ]
+		+ SWidgetSwitcher::Slot()[ InGameHUDWidget.ToSharedRef() ]
+		+ SWidgetSwitcher::Slot()[ TrackSelectionWidget.ToSharedRef() ]
+		+ SWidgetSwitcher::Slot()[ ShopWidget.ToSharedRef() ]
+		+ SWidgetSwitcher::Slot()[ BossRewardWidget.ToSharedRef() ]
+		+ SWidgetSwitcher::Slot()[ EndlessModePromptWidget.ToSharedRef() ]
+		+ SWidgetSwitcher::Slot()[ GameOverWidget.ToSharedRef() ]
+		+ SWidgetSwitcher::Slot()[ LeaderboardWidget.ToSharedRef() ];
+
+	// The pause menu is drawn over the in-game HUD rather than replacing it
+	PauseWidget->SetVisibility(EVisibility::Collapsed);
+	SAssignNew(ScreenOverlay, SOverlay)
+		+ SOverlay::Slot()[ ScreenSwitcher.ToSharedRef() ]
+		+ SOverlay::Slot()[ PauseWidget.ToSharedRef() ];
+
+	ViewportRoot = SNew(SWeakWidget).PossiblyNullContent(ScreenOverlay.ToSharedRef());
+	GEngine->GameViewport->AddViewportWidgetContent(ViewportRoot.ToSharedRef());
+}
+
+void AEndlessRunnerHUD::ActivateScreen(const TSharedPtr<SWidget>& Screen, bool bUIInput)
+{
+	if (!ScreenSwitcher.IsValid()) ConstructScreens();
+	if (!ScreenSwitcher.IsValid()) return;
+
+	if (PauseWidget.IsValid()) PauseWidget->SetVisibility(EVisibility::Collapsed);
+	ScreenSwitcher->SetActiveWidget(Screen.IsValid() ? Screen.ToSharedRef() : EmptyScreen.ToSharedRef());
 
-		GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(MainMenuWidget.ToSharedRef()));
+	if (bUIInput)
+	{
 		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
 		{
 			PC->bShowMouseCursor = true;
@@ -49,221 +129,106 @@ void AEndlessRunnerHUD::ShowMainMenu()
 	}
 }
 
+void AEndlessRunnerHUD::ShowMainMenu()
+{
+	ActivateScreen(MainMenuWidget, true);
+}
+
 void AEndlessRunnerHUD::ShowInGameHUD()
 {
-	HideAllWidgets();
-	if (GEngine && GEngine->GameViewport)
-	{
-		SAssignNew(InGameHUDWidget, SEndlessRunnerHUD, Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()));
-		GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(InGameHUDWidget.ToSharedRef()));
-	}
+	ActivateScreen(InGameHUDWidget, false);
 }
 
 void AEndlessRunnerHUD::ShowClassSelection()
 {
-	HideAllWidgets();
-	if (GEngine && GEngine->GameViewport)
+	if (!ScreenSwitcher.IsValid()) ConstructScreens();
+	if (!ScreenSwitcher.IsValid()) return;
+
+	if (!ClassSelectionWidget.IsValid())
 	{
 		SAssignNew(ClassSelectionWidget, SClassSelectionWidget)
 			.OnClassSelected(FOnClassSelected::CreateUObject(this, &AEndlessRunnerHUD::OnClassSelected));
-		
-		ClassSelectionWidget->RefreshClassButtons();
-		
-		GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(ClassSelectionWidget.ToSharedRef()));
-		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-		{
-			PC->bShowMouseCursor = true;
-			PC->SetInputMode(FInputModeUIOnly());
-		}
+		ScreenSwitcher->AddSlot()[ ClassSelectionWidget.ToSharedRef() ];
 	}
+
+	// Class definitions may have been added or changed since the screen was last shown
+	ClassSelectionWidget->RefreshClassButtons();
+	ActivateScreen(ClassSelectionWidget, true);
 }
 
 void AEndlessRunnerHUD::ShowTrackSelection()
 {
-	HideAllWidgets();
-	if (GEngine && GEngine->GameViewport)
+	AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode());
+	if (TrackSelectionWidget.IsValid() && GM)
 	{
-		SAssignNew(TrackSelectionWidget, STrackSelectionWidget)
-			.OnTrackSelected(FOnTrackSelected::CreateUObject(this, &AEndlessRunnerHUD::OnTrackSelected));
-		
-		if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()))
-		{
-			TrackSelectionWidget->UpdateTracks(GM->GetCurrentTrackSelection());
-		}
-		
-		GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(TrackSelectionWidget.ToSharedRef()));
-		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-		{
-			PC->bShowMouseCursor = true;
-			PC->SetInputMode(FInputModeUIOnly());
-		}
+		TrackSelectionWidget->UpdateTracks(GM->GetCurrentTrackSelection());
 	}
+	ActivateScreen(TrackSelectionWidget, true);
 }
 
 void AEndlessRunnerHUD::ShowShop()
 {
-	HideAllWidgets();
-	if (GEngine && GEngine->GameViewport)
+	AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode());
+	if (ShopWidget.IsValid() && GM)
 	{
-		SAssignNew(ShopWidget, SShopWidget)
-			.OnBackClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnShopExited))
-			.OnPurchaseItem(FOnPurchaseItem::CreateUObject(this, &AEndlessRunnerHUD::OnPurchaseItem));
-
-		if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()))
+		if (GM->GetCurrencyManager())
 		{
-			if (GM->GetCurrencyManager())
-			{
-				ShopWidget->UpdateCurrency(GM->GetCurrencyManager()->GetCurrency());
-			}
-			
-			// If we already have items cached in GameMode, update the widget immediately
-			if (GM->GetShopItems().Items.Num() > 0)
-			{
-				ShopWidget->UpdateItems(GM->GetShopItems());
-			}
+			ShopWidget->UpdateCurrency(GM->GetCurrencyManager()->GetCurrency());
 		}
 
-		GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(ShopWidget.ToSharedRef()));
-		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
+		// If we already have items cached in GameMode, update the widget immediately
+		if (GM->GetShopItems().Items.Num() > 0)
 		{
-			PC->bShowMouseCursor = true;
-			PC->SetInputMode(FInputModeUIOnly());
+			ShopWidget->UpdateItems(GM->GetShopItems());
 		}
 	}
+	ActivateScreen(ShopWidget, true);
 }
 
 void AEndlessRunnerHUD::ShowBossRewards()
 {
-	HideAllWidgets();
-	if (GEngine && GEngine->GameViewport)
+	AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode());
+	if (BossRewardWidget.IsValid() && GM)
 	{
-		SAssignNew(BossRewardWidget, SBossRewardWidget)
-			.OnRewardSelected(FOnRewardSelected::CreateUObject(this, &AEndlessRunnerHUD::OnRewardSelected));
-		
-		if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()))
-		{
-			BossRewardWidget->UpdateRewards(GM->GetBossRewards());
-		}
-		
-		GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(BossRewardWidget.ToSharedRef()));
-		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-		{
-			PC->bShowMouseCursor = true;
-			PC->SetInputMode(FInputModeUIOnly());
-		}
+		BossRewardWidget->UpdateRewards(GM->GetBossRewards());
 	}
+	ActivateScreen(BossRewardWidget, true);
 }
 
 void AEndlessRunnerHUD::ShowEndlessModePrompt()
 {
-	HideAllWidgets();
-	if (GEngine && GEngine->GameViewport)
-	{
-		SAssignNew(EndlessModePromptWidget, SEndlessModePromptWidget)
-			.OnEndlessModeSelected(FOnEndlessModeSelected::CreateUObject(this, &AEndlessRunnerHUD::OnEndlessModeSelected))
-			.OnEndlessModeDeclined(FOnEndlessModeDeclined::CreateUObject(this, &AEndlessRunnerHUD::OnEndlessModeDeclined));
-		
-		GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(EndlessModePromptWidget.ToSharedRef()));
-		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-		{
-			PC->bShowMouseCursor = true;
-			PC->SetInputMode(FInputModeUIOnly());
-		}
-	}
+	ActivateScreen(EndlessModePromptWidget, true);
 }
 
 void AEndlessRunnerHUD::ShowGameOverScreen()
 {
-	HideAllWidgets();
-	if (GEngine && GEngine->GameViewport)
+	AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode());
+	if (GameOverWidget.IsValid() && GM)
 	{
-		int32 Score = 0;
-		float Distance = 0.0f;
-		float Time = 0.0f;
-		
-		if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()))
-		{
-			Score = GM->GetScore();
-			Distance = GM->GetDistanceTraveled();
-			Time = GM->GetGameTime();
-		}
-		
-		SAssignNew(GameOverWidget, SGameOverWidget, Score, Distance, Time)
-			.OnNewRunClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnNewRunClicked))
-			.OnChangeClassClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::ShowClassSelection))
-			.OnExitClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::ShowMainMenu));
-
-		GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(GameOverWidget.ToSharedRef()));
-		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-		{
-			PC->bShowMouseCursor = true;
-			PC->SetInputMode(FInputModeUIOnly());
-		}
+		GameOverWidget->SetResults(GM->GetScore(), GM->GetDistanceTraveled(), GM->GetGameTime());
 	}
+	ActivateScreen(GameOverWidget, true);
 }
 
 void AEndlessRunnerHUD::HideAllWidgets()
 {
-	if (GEngine && GEngine->GameViewport)
+	if (PauseWidget.IsValid())
 	{
-		if (MainMenuWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(MainMenuWidget.ToSharedRef());
-			MainMenuWidget.Reset();
-		}
-		if (ClassSelectionWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(ClassSelectionWidget.ToSharedRef());
-			ClassSelectionWidget.Reset();
-		}
-		if (InGameHUDWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(InGameHUDWidget.ToSharedRef());
-			InGameHUDWidget.Reset();
-		}
-		if (TrackSelectionWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(TrackSelectionWidget.ToSharedRef());
-			TrackSelectionWidget.Reset();
-		}
-		if (ShopWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(ShopWidget.ToSharedRef());
-			ShopWidget.Reset();
-		}
-		if (BossRewardWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(BossRewardWidget.ToSharedRef());
-			BossRewardWidget.Reset();
-		}
-		if (EndlessModePromptWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(EndlessModePromptWidget.ToSharedRef());
-			EndlessModePromptWidget.Reset();
-		}
-		if (GameOverWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(GameOverWidget.ToSharedRef());
-			GameOverWidget.Reset();
-		}
-		if (PauseWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(PauseWidget.ToSharedRef());
-			PauseWidget.Reset();
-		}
-		if (LeaderboardWidget.IsValid())
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(LeaderboardWidget.ToSharedRef());
-			LeaderboardWidget.Reset();
-		}
+		PauseWidget->SetVisibility(EVisibility::Collapsed);
+	}
+	if (ScreenSwitcher.IsValid())
+	{
+		ScreenSwitcher->SetActiveWidget(EmptyScreen.ToSharedRef());
 	}
 }
 
 void AEndlessRunnerHUD::TogglePause()
 {
-	if (PauseWidget.IsValid())
+	if (!ScreenSwitcher.IsValid()) ConstructScreens();
+	if (!PauseWidget.IsValid()) return;
+
+	if (PauseWidget->GetVisibility() == EVisibility::Visible)
 	{
-		HideAllWidgets();
 		ShowInGameHUD();
 		if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()))
 		{
@@ -272,26 +237,16 @@ void AEndlessRunnerHUD::TogglePause()
 	}
 	else
 	{
-		if (GEngine && GEngine->GameViewport)
+		if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()))
 		{
-			int32 Seed = 0;
-			if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()))
-			{
-				Seed = GM->GetTrackSeed();
-				GM->PauseGame();
-			}
-
-			SAssignNew(PauseWidget, SPauseWidget, Seed)
-				.OnResumeClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::TogglePause))
-				.OnNewRunClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::OnNewRunClicked))
-				.OnMainMenuClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::ShowMainMenu));
-
-			GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(PauseWidget.ToSharedRef()));
-			if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-			{
-				PC->bShowMouseCursor = true;
-				PC->SetInputMode(FInputModeUIOnly());
-			}
+			PauseWidget->SetSeed(GM->GetTrackSeed());
+			GM->PauseGame();
+		}
+		PauseWidget->SetVisibility(EVisibility::Visible);
+		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
+		{
+			PC->bShowMouseCursor = true;
+			PC->SetInputMode(FInputModeUIOnly());
 		}
 	}
 }
@@ -342,25 +297,7 @@ void AEndlessRunnerHUD::OnLeaderboardClicked()
 
 void AEndlessRunnerHUD::ShowLeaderboard()
 {
-	HideAllWidgets();
-	
-	if (GEngine && GEngine->GameViewport)
-	{
-		SAssignNew(LeaderboardWidget, SLeaderboardWidget)
-			.OnBackClicked(FSimpleDelegate::CreateUObject(this, &AEndlessRunnerHUD::ShowMainMenu))
-			.OnWatchReplayClicked(FOnWatchReplayClicked::CreateUObject(this, &AEndlessRunnerHUD::OnWatchReplayClicked))
-			.OnClassTabChanged(FOnClassTabChanged::CreateUObject(this, &AEndlessRunnerHUD::OnLeaderboardClassChanged));
-			
-		LeaderboardWidget->SetLoading(true);
-		
-		GEngine->GameViewport->AddViewportWidgetContent(SNew(SWeakWidget).PossiblyNullContent(LeaderboardWidget.ToSharedRef()));
-		
-		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-		{
-			PC->bShowMouseCursor = true;
-			PC->SetInputMode(FInputModeUIOnly());
-		}
-	}
+	ActivateScreen(LeaderboardWidget, true);
 
 	if (!WebServerInterface)
 	{
@@ -380,24 +317,26 @@ void AEndlessRunnerHUD::ShowLeaderboard()
 	OnErrorDelegate.BindUFunction(this, FName("OnLeaderboardError"));
 	WebServerInterface->SetOnError(OnErrorDelegate);
 	
-	WebServerInterface->FetchLeaderboard();
+	// Scores may have changed since the last visit, so start from the first page again
+	if (LeaderboardWidget.IsValid())
+	{
+		LeaderboardWidget->ResetPages();
+	}
 }
 
-void AEndlessRunnerHUD::OnLeaderboardClassChanged(FString ClassName)
+void AEndlessRunnerHUD::OnLeaderboardPageRequested(FString ClassName, int32 Offset, int32 Limit)
 {
 	if (WebServerInterface)
 	{
-		WebServerInterface->FetchLeaderboard(TEXT("all-time"), ClassName);
+		WebServerInterface->FetchLeaderboard(TEXT("all-time"), ClassName, Offset, Limit);
 	}
 }
 
-void AEndlessRunnerHUD::OnLeaderboardReceived(const TArray<FLeaderboardEntryData>& Entries, int32 PlayerRank)
+void AEndlessRunnerHUD::OnLeaderboardReceived(const FLeaderboardPageData& Page)
 {
-	CurrentLeaderboardEntries = Entries;
-
 	if (LeaderboardWidget.IsValid())
 	{
-		LeaderboardWidget->UpdateLeaderboard(Entries, PlayerRank);
+		LeaderboardWidget->AddPage(Page);
 	}
 }
 
@@ -406,21 +345,29 @@ void AEndlessRunnerHUD::OnLeaderboardError(const FString& ErrorMessage)
 	UE_LOG(LogTemp, Error, TEXT("Leaderboard Error: %s"), *ErrorMessage);
 	if (LeaderboardWidget.IsValid())
 	{
-		// Force empty update to clear loading state and show "No records" or an error msg
-		LeaderboardWidget->UpdateLeaderboard(TArray<FLeaderboardEntryData>(), 0);
+		// Clear the loading state so the tab shows "No records" (or what it already has)
+		LeaderboardWidget->CancelPendingPages();
 	}
 }
 
 void AEndlessRunnerHUD::OnWatchReplayClicked(int32 RunId)
 {
 	UE_LOG(LogTemp, Warning, TEXT("HUD: Watch Replay clicked for RunId: %d"), RunId);
-	for (const auto& Entry : CurrentLeaderboardEntries)
+	RequestReplay(RunId, false);
+}
+
+void AEndlessRunnerHUD::OnRaceReplayClicked(int32 RunId)
+{
+	UE_LOG(LogTemp, Warning, TEXT("HUD: Race Replay clicked for RunId: %d"), RunId);
+	RequestReplay(RunId, true);
+}
+
+void AEndlessRunnerHUD::RequestReplay(int32 RunId, bool bGhostRace)
+{
+	bPendingGhostRace = bGhostRace;
+	if (const FLeaderboardEntryData* Entry = LeaderboardWidget.IsValid() ? LeaderboardWidget->FindEntry(RunId) : nullptr)
 	{
-		if (Entry.RunId == RunId)
-		{
-			PendingReplayMetadata = Entry;
-			break;
-		}
+		PendingReplayMetadata = *Entry;
 	}
 
 	if (WebServerInterface)
@@ -434,7 +381,14 @@ void AEndlessRunnerHUD::OnReplayDataReceived(const TArray<FReplayEvent>& ReplayD
 	HideAllWidgets();
 	if (AEndlessRunnerGameMode* GM = Cast<AEndlessRunnerGameMode>(GetWorld()->GetAuthGameMode()))
 	{
-		GM->StartReplay(PendingReplayMetadata.Seed, PendingReplayMetadata.SeedId, PendingReplayMetadata.PlayerClass, ReplayData);
+		if (bPendingGhostRace)
+		{
+			GM->StartGhostRace(PendingReplayMetadata.Seed, PendingReplayMetadata.PlayerClass, PendingReplayMetadata.RngVersion, ReplayData);
+		}
+		else
+		{
+			GM->StartReplay(PendingReplayMetadata.Seed, PendingReplayMetadata.SeedId, PendingReplayMetadata.PlayerClass, PendingReplayMetadata.RngVersion, ReplayData);
+		}
 	}
 }
 
@@ -13,7 +13,8 @@ struct FBossRewardData;
 
 /**
  * Main HUD class for the endless runner game
- * Manages Slate widgets for various game states
+ * Manages Slate widgets for various game states. Each screen is constructed once in BeginPlay and lives in a
+ * single widget switcher; showing a screen refreshes it with current data and switches to it.
  */
 UCLASS()
 class SEWERSCUTTLE_API AEndlessRunnerHUD : public AHUD
@@ -24,6 +25,7 @@ public:
 	AEndlessRunnerHUD();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Show the main menu */
 	UFUNCTION(BlueprintCallable, Category = "UI")
@@ -57,7 +59,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UI")
 	void ShowGameOverScreen();
 
-	/** Hide all widgets */
+	/** Hide all widgets (switches to an empty screen) */
 	UFUNCTION(BlueprintCallable, Category = "UI")
 	void HideAllWidgets();
 
@@ -78,13 +80,31 @@ public:
 
 	/** Handle leaderboard data received */
 	UFUNCTION()
-	void OnLeaderboardReceived(const TArray<FLeaderboardEntryData>& Entries, int32 PlayerRank);
+	void OnLeaderboardReceived(const FLeaderboardPageData& Page);
 
 	/** Handle leaderboard error */
 	UFUNCTION()
 	void OnLeaderboardError(const FString& ErrorMessage);
 
 protected:
+	/** Build the screens and add them to the viewport (first call only; class selection is built when first shown) */
+	void ConstructScreens();
+
+	/** Switch to a screen, optionally giving the UI mouse focus */
+	void ActivateScreen(const TSharedPtr<SWidget>& Screen, bool bUIInput);
+
+	/** Switcher holding every screen */
+	TSharedPtr<class SWidgetSwitcher> ScreenSwitcher;
+
+	/** Switcher with the pause menu layered over it */
+	TSharedPtr<class SOverlay> ScreenOverlay;
+
+	/** Viewport content wrapping the overlay */
+	TSharedPtr<SWidget> ViewportRoot;
+
+	/** Shown when no screen is */
+	TSharedPtr<SWidget> EmptyScreen;
+
 	/** Main menu widget */
 	TSharedPtr<class SMainMenuWidget> MainMenuWidget;
 
@@ -109,7 +129,7 @@ protected:
 	/** Game over widget */
 	TSharedPtr<class SGameOverWidget> GameOverWidget;
 
-	/** Pause menu widget */
+	/** Pause menu widget, shown over the current screen */
 	TSharedPtr<class SPauseWidget> PauseWidget;
 
 	/** Leaderboard widget */
@@ -130,12 +150,18 @@ protected:
 	void OnLeaderboardClicked();
 	void OnSettingsClicked();
 
-	/** Handle leaderboard class filter change */
-	void OnLeaderboardClassChanged(FString ClassName);
+	/** Handle leaderboard page request (tab change or scroll) */
+	void OnLeaderboardPageRequested(FString ClassName, int32 Offset, int32 Limit);
 
 	/** Handle replay click */
 	void OnWatchReplayClicked(int32 RunId);
 
+	/** Handle race click (play the run's seed against its ghost) */
+	void OnRaceReplayClicked(int32 RunId);
+
+	/** Remember a leaderboard entry and fetch its replay, to watch or race once it arrives */
+	void RequestReplay(int32 RunId, bool bGhostRace);
+
 	/** Handle shop purchase */
 	void OnPurchaseItem(FString ItemId);
 
@@ -154,6 +180,6 @@ protected:
 	/** Cached metadata for replay */
 	FLeaderboardEntryData PendingReplayMetadata;
 
-	/** Current leaderboard entries */
-	TArray<FLeaderboardEntryData> CurrentLeaderboardEntries;
+	/** Whether the pending replay is to be raced rather than watched */
+	bool bPendingGhostRace = false;
 };
@@ -7,6 +7,7 @@
 #include "Widgets/SOverlay.h"
 #include "Styling/SlateColor.h"
 #include "Widgets/Layout/SBorder.h"
+#include "Widgets/SInvalidationPanel.h"
 
 void SEndlessRunnerHUD::Construct(const FArguments& InArgs, AEndlessRunnerGameMode* InGameMode)
 {
@@ -14,136 +15,139 @@ void SEndlessRunnerHUD::Construct(const FArguments& InArgs, AEndlessRunnerGameMo
 
 	ChildSlot
 	[
-		SNew(SOverlay)
-		// Top Left - Score and Distance
-		+ SOverlay::Slot()
-		.HAlign(HAlign_Left)
-		.VAlign(VAlign_Top)
-		.Padding(20.0f)
+		SNew(SInvalidationPanel)
 		[
-			SNew(SVerticalBox)
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			.Padding(0, 0, 0, 10)
+			SNew(SOverlay)
+			// Top Left - Score and Distance
+			+ SOverlay::Slot()
+			.HAlign(HAlign_Left)
+			.VAlign(VAlign_Top)
+			.Padding(20.0f)
 			[
-				SAssignNew(ScoreText, STextBlock)
-				.Text(FText::FromString(TEXT("SCORE: 0")))
-				.Font(FCoreStyle::GetDefaultFontStyle("Bold", 28))
-				.ColorAndOpacity(FSlateColor(FLinearColor(1.0f, 0.84f, 0.0f))) // Gold
-			]
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			.Padding(0, 0, 0, 10)
-			[
-				SAssignNew(DistanceText, STextBlock)
-				.Text(FText::FromString(TEXT("DISTANCE: 0m")))
-				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 20))
-				.ColorAndOpacity(FSlateColor(FLinearColor::White))
-			]
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			.Padding(0, 0, 0, 10)
-			[
-				SAssignNew(CoinsText, STextBlock)
-				.Text(FText::FromString(TEXT("COINS: 0")))
-				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 20))
-				.ColorAndOpacity(FSlateColor(FLinearColor(1.0f, 0.84f, 0.0f))) // Gold
-			]
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			.Padding(0, 0, 0, 10)
-			[
-				SAssignNew(LivesText, STextBlock)
-				.Text(FText::FromString(TEXT("LIVES: 3")))
-				.Font(FCoreStyle::GetDefaultFontStyle("Bold", 24))
-				.ColorAndOpacity(FSlateColor(FLinearColor(1.0f, 0.2f, 0.2f))) // Red
-			]
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			.Padding(0, 0, 0, 10)
-			[
-				SAssignNew(JumpCountText, STextBlock)
-				.Text(FText::FromString(TEXT("JUMPS: 1")))
-				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 20))
-				.ColorAndOpacity(FSlateColor(FLinearColor(0.5f, 0.8f, 1.0f))) // Light blue
-			]
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			[
-				SAssignNew(PowerUpStatusText, STextBlock)
-				.Text(FText::FromString(TEXT("")))
-				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 18))
-				.ColorAndOpacity(FSlateColor(FLinearColor(0.0f, 1.0f, 0.5f))) // Cyan/Green
-			]
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			.Padding(0, 10, 0, 0)
-			[
-				SAssignNew(SeedText, STextBlock)
-				.Text(FText::FromString(TEXT("SEED: 0")))
-				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
-				.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f))) // Gray
-			]
-		]
-		// Top Right - Speed and Timer (cool design)
-		+ SOverlay::Slot()
-		.HAlign(HAlign_Right)
-		.VAlign(VAlign_Top)
-		.Padding(20.0f)
-		[
-			SNew(SVerticalBox)
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			.Padding(0, 0, 0, 15)
-			[
-				SNew(SBorder)
-				.BorderImage(FCoreStyle::Get().GetBrush("NoBorder"))
-				.Padding(FMargin(15, 10, 15, 10))
+				SNew(SVerticalBox)
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 0, 0, 10)
 				[
-					SNew(SVerticalBox)
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					.Padding(0, 0, 0, 5)
-					[
-						SNew(STextBlock)
-						.Text(FText::FromString(TEXT("SPEED")))
-						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
-						.ColorAndOpacity(FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f))) // Gray
-					]
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					[
-						SAssignNew(SpeedText, STextBlock)
-						.Text(FText::FromString(TEXT("0")))
-						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 32))
-						.ColorAndOpacity(FSlateColor(FLinearColor(0.0f, 1.0f, 0.5f))) // Cyan/Green
-					]
+					SAssignNew(ScoreText, STextBlock)
+					.Text(FText::FromString(TEXT("SCORE: 0")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 28))
+					.ColorAndOpacity(FSlateColor(FLinearColor(1.0f, 0.84f, 0.0f))) // Gold
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 0, 0, 10)
+				[
+					SAssignNew(DistanceText, STextBlock)
+					.Text(FText::FromString(TEXT("DISTANCE: 0m")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 20))
+					.ColorAndOpacity(FSlateColor(FLinearColor::White))
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 0, 0, 10)
+				[
+					SAssignNew(CoinsText, STextBlock)
+					.Text(FText::FromString(TEXT("COINS: 0")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 20))
+					.ColorAndOpacity(FSlateColor(FLinearColor(1.0f, 0.84f, 0.0f))) // Gold
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 0, 0, 10)
+				[
+					SAssignNew(LivesText, STextBlock)
+					.Text(FText::FromString(TEXT("LIVES: 3")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 24))
+					.ColorAndOpacity(FSlateColor(FLinearColor(1.0f, 0.2f, 0.2f))) // Red
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 0, 0, 10)
+				[
+					SAssignNew(JumpCountText, STextBlock)
+					.Text(FText::FromString(TEXT("JUMPS: 1")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 20))
+					.ColorAndOpacity(FSlateColor(FLinearColor(0.5f, 0.8f, 1.0f))) // Light blue
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SAssignNew(PowerUpStatusText, STextBlock)
+					.Text(FText::FromString(TEXT("")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 18))
+					.ColorAndOpacity(FSlateColor(FLinearColor(0.0f, 1.0f, 0.5f))) // Cyan/Green
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 10, 0, 0)
+				[
+					SAssignNew(SeedText, STextBlock)
+					.Text(FText::FromString(TEXT("SEED: 0")))
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
+					.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f))) // Gray
 				]
 			]
-			+ SVerticalBox::Slot()
-			.AutoHeight()
+			// Top Right - Speed and Timer (cool design)
+			+ SOverlay::Slot()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Top)
+			.Padding(20.0f)
 			[
-				SNew(SBorder)
-				.BorderImage(FCoreStyle::Get().GetBrush("NoBorder"))
-				.Padding(FMargin(15, 10, 15, 10))
+				SNew(SVerticalBox)
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0, 0, 0, 15)
 				[
-					SNew(SVerticalBox)
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					.Padding(0, 0, 0, 5)
+					SNew(SBorder)
+					.BorderImage(FCoreStyle::Get().GetBrush("NoBorder"))
+					.Padding(FMargin(15, 10, 15, 10))
 					[
-						SNew(STextBlock)
-						.Text(FText::FromString(TEXT("TIME")))
-						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
-						.ColorAndOpacity(FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f))) // Gray
+						SNew(SVerticalBox)
+						+ SVerticalBox::Slot()
+						.AutoHeight()
+						.Padding(0, 0, 0, 5)
+						[
+							SNew(STextBlock)
+							.Text(FText::FromString(TEXT("SPEED")))
+							.Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
+							.ColorAndOpacity(FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f))) // Gray
+						]
+						+ SVerticalBox::Slot()
+						.AutoHeight()
+						[
+							SAssignNew(SpeedText, STextBlock)
+							.Text(FText::FromString(TEXT("0")))
+							.Font(FCoreStyle::GetDefaultFontStyle("Bold", 32))
+							.ColorAndOpacity(FSlateColor(FLinearColor(0.0f, 1.0f, 0.5f))) // Cyan/Green
+						]
 					]
-					+ SVerticalBox::Slot()
-					.AutoHeight()
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SNew(SBorder)
+					.BorderImage(FCoreStyle::Get().GetBrush("NoBorder"))
+					.Padding(FMargin(15, 10, 15, 10))
 					[
-						SAssignNew(TimerText, STextBlock)
-						.Text(FText::FromString(TEXT("00:00")))
-						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 32))
-						.ColorAndOpacity(FSlateColor(FLinearColor(1.0f, 1.0f, 1.0f))) // White
+						SNew(SVerticalBox)
+						+ SVerticalBox::Slot()
+						.AutoHeight()
+						.Padding(0, 0, 0, 5)
+						[
+							SNew(STextBlock)
+							.Text(FText::FromString(TEXT("TIME")))
+							.Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
+							.ColorAndOpacity(FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f))) // Gray
+						]
+						+ SVerticalBox::Slot()
+						.AutoHeight()
+						[
+							SAssignNew(TimerText, STextBlock)
+							.Text(FText::FromString(TEXT("00:00")))
+							.Font(FCoreStyle::GetDefaultFontStyle("Bold", 32))
+							.ColorAndOpacity(FSlateColor(FLinearColor(1.0f, 1.0f, 1.0f))) // White
+						]
 					]
 				]
 			]
@@ -151,6 +155,8 @@ void SEndlessRunnerHUD::Construct(const FArguments& InArgs, AEndlessRunnerGameMo
 	];
 }
 
+SEndlessRunnerHUD::~SEndlessRunnerHUD() = default;
+
 void SEndlessRunnerHUD::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
 	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
@@ -166,44 +172,52 @@ void SEndlessRunnerHUD::Tick(const FGeometry& AllottedGeometry, const double InC
 			GameMode->GetLives(),
 			GameMode->GetCurrentJumpCount(),
 			GameMode->GetMaxJumpCount(),
-			GameMode->GetActivePowerUpStatus(),
+			GameMode->GetActivePowerUpState(),
 			GameMode->GetTrackSeed()
 		);
 	}
 }
 
-void SEndlessRunnerHUD::UpdateHUD(int32 Score, float Distance, int32 Coins, float Speed, float Time, int32 Lives, int32 CurrentJumpCount, int32 MaxJumpCount, const FString& PowerUpStatus, int32 Seed)
+void SEndlessRunnerHUD::UpdateHUD(int32 Score, float Distance, int32 Coins, float Speed, float Time, int32 Lives, int32 CurrentJumpCount, int32 MaxJumpCount, const FActivePowerUpState& PowerUps, int32 Seed)
 {
-	if (ScoreText.IsValid())
+	// Compare at display precision: SetText with a freshly built FText always invalidates, even for the same string
+	if (ScoreText.IsValid() && Score != Displayed.Score)
 	{
+		Displayed.Score = Score;
 		ScoreText->SetText(FText::FromString(FString::Printf(TEXT("SCORE: %d"), Score)));
 	}
 
-	if (DistanceText.IsValid())
+	// Distance is already in meters (converted from game units in GetDistanceTraveled)
+	const int32 DistanceMeters = FMath::RoundToInt(Distance);
+	if (DistanceText.IsValid() && DistanceMeters != Displayed.DistanceMeters)
 	{
-		// Distance is already in meters (converted from game units in GetDistanceTraveled)
-		DistanceText->SetText(FText::FromString(FString::Printf(TEXT("DISTANCE: %.0fm"), Distance)));
+		Displayed.DistanceMeters = DistanceMeters;
+		DistanceText->SetText(FText::FromString(FString::Printf(TEXT("DISTANCE: %dm"), DistanceMeters)));
 	}
 
-	if (CoinsText.IsValid())
+	if (CoinsText.IsValid() && Coins != Displayed.Coins)
 	{
+		Displayed.Coins = Coins;
 		CoinsText->SetText(FText::FromString(FString::Printf(TEXT("COINS: %d"), Coins)));
 	}
 
-	if (SpeedText.IsValid())
+	const int32 RoundedSpeed = FMath::RoundToInt(Speed);
+	if (SpeedText.IsValid() && RoundedSpeed != Displayed.Speed)
 	{
-		SpeedText->SetText(FText::FromString(FString::Printf(TEXT("%.0f"), Speed)));
+		Displayed.Speed = RoundedSpeed;
+		SpeedText->SetText(FText::AsCultureInvariant(FString::FromInt(RoundedSpeed)));
 	}
 
-	if (TimerText.IsValid())
+	const int32 TimeSeconds = FMath::FloorToInt(Time);
+	if (TimerText.IsValid() && TimeSeconds != Displayed.TimeSeconds)
 	{
-		int32 Minutes = FMath::FloorToInt(Time / 60.0f);
-		int32 Seconds = FMath::FloorToInt(FMath::Fmod(Time, 60.0f));
-		TimerText->SetText(FText::FromString(FString::Printf(TEXT("%02d:%02d"), Minutes, Seconds)));
+		Displayed.TimeSeconds = TimeSeconds;
+		TimerText->SetText(FText::FromString(FString::Printf(TEXT("%02d:%02d"), TimeSeconds / 60, TimeSeconds % 60)));
 	}
 
-	if (LivesText.IsValid())
+	if (LivesText.IsValid() && Lives != Displayed.Lives)
 	{
+		Displayed.Lives = Lives;
 		FString LivesString = FString::Printf(TEXT("LIVES: %d"), Lives);
 		if (Lives <= 0)
 		{
@@ -217,13 +231,17 @@ void SEndlessRunnerHUD::UpdateHUD(int32 Score, float Distance, int32 Coins, floa
 		LivesText->SetText(FText::FromString(LivesString));
 	}
 
-	if (JumpCountText.IsValid())
+	if (JumpCountText.IsValid() && (CurrentJumpCount != Displayed.CurrentJumpCount || MaxJumpCount != Displayed.MaxJumpCount))
 	{
+		Displayed.CurrentJumpCount = CurrentJumpCount;
+		Displayed.MaxJumpCount = MaxJumpCount;
 		JumpCountText->SetText(FText::FromString(FString::Printf(TEXT("JUMPS: %d/%d"), CurrentJumpCount, MaxJumpCount)));
 	}
 
-	if (PowerUpStatusText.IsValid())
+	if (PowerUpStatusText.IsValid() && (!DisplayedPowerUps.IsSet() || DisplayedPowerUps.GetValue() != PowerUps))
 	{
+		DisplayedPowerUps = PowerUps;
+		const FString PowerUpStatus = PowerUps.ToString();
 		if (!PowerUpStatus.IsEmpty())
 		{
 			PowerUpStatusText->SetText(FText::FromString(FString::Printf(TEXT("POWERUP: %s"), *PowerUpStatus)));
@@ -235,9 +253,9 @@ void SEndlessRunnerHUD::UpdateHUD(int32 Score, float Distance, int32 Coins, floa
 		}
 	}
 
-	if (SeedText.IsValid())
+	if (SeedText.IsValid() && Seed != Displayed.Seed)
 	{
+		Displayed.Seed = Seed;
 		SeedText->SetText(FText::FromString(FString::Printf(TEXT("SEED: %d"), Seed)));
 	}
 }
-
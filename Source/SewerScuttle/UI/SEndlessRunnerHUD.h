@@ -4,12 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
-
-class AEndlessRunnerGameMode;
+#include "../EndlessRunner/EndlessRunnerGameMode.h"
 
 /**
  * Slate widget for in-game HUD
  * Displays score, distance, coins, and powerup indicators
+ * Polls the game mode each tick but only touches a text block when its displayed value changes, and
+ * sits in an invalidation panel, so frames where nothing changes cost no layout or paint.
  */
 class SEWERSCUTTLE_API SEndlessRunnerHUD : public SCompoundWidget
 {
@@ -19,13 +20,33 @@ public:
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs, AEndlessRunnerGameMode* InGameMode);
+	virtual ~SEndlessRunnerHUD();
 
 	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
 
-	/** Update HUD display */
-	void UpdateHUD(int32 Score, float Distance, int32 Coins, float Speed, float Time, int32 Lives, int32 CurrentJumpCount, int32 MaxJumpCount, const FString& PowerUpStatus, int32 Seed = 0);
+	/** Update HUD display (values equal to what is already shown are skipped) */
+	void UpdateHUD(int32 Score, float Distance, int32 Coins, float Speed, float Time, int32 Lives, int32 CurrentJumpCount, int32 MaxJumpCount, const FActivePowerUpState& PowerUps, int32 Seed = 0);
 
 private:
+	/** Values currently on screen, at display precision */
+	struct FDisplayedValues
+	{
+		int32 Score = MIN_int32;
+		int32 DistanceMeters = MIN_int32;
+		int32 Coins = MIN_int32;
+		int32 Speed = MIN_int32;
+		int32 TimeSeconds = MIN_int32;
+		int32 Lives = MIN_int32;
+		int32 CurrentJumpCount = MIN_int32;
+		int32 MaxJumpCount = MIN_int32;
+		int32 Seed = MIN_int32;
+	};
+
+	FDisplayedValues Displayed;
+
+	/** Power-ups currently on screen (unset until the first update) */
+	TOptional<FActivePowerUpState> DisplayedPowerUps;
+
 	/** Game mode reference */
 	TWeakObjectPtr<AEndlessRunnerGameMode> GameMode;
 
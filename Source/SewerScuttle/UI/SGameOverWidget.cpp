@@ -125,6 +125,16 @@ void SGameOverWidget::Construct(const FArguments& InArgs, int32 FinalScore, floa
 	];
 }
 
+void SGameOverWidget::SetResults(int32 FinalScore, float FinalDistance, float FinalTime)
+{
+	int32 Minutes = FMath::FloorToInt(FinalTime / 60.0f);
+	int32 Seconds = FMath::FloorToInt(FMath::Fmod(FinalTime, 60.0f));
+
+	if (FinalScoreText.IsValid()) FinalScoreText->SetText(FText::FromString(FString::Printf(TEXT("FINAL SCORE: %d"), FinalScore)));
+	if (FinalDistanceText.IsValid()) FinalDistanceText->SetText(FText::FromString(FString::Printf(TEXT("DISTANCE: %.0fm"), FinalDistance)));
+	if (FinalTimeText.IsValid()) FinalTimeText->SetText(FText::FromString(FString::Printf(TEXT("TIME: %02d:%02d"), Minutes, Seconds)));
+}
+
 FReply SGameOverWidget::OnNewRunButtonClicked()
 {
 	if (OnNewRunClicked.IsBound())
@@ -25,6 +25,9 @@ public:
 
 	void Construct(const FArguments& InArgs, int32 FinalScore, float FinalDistance, float FinalTime);
 
+	/** Show the results of a new run (the widget is reused between runs) */
+	void SetResults(int32 FinalScore, float FinalDistance, float FinalTime);
+
 	/** Delegates */
 	FSimpleDelegate OnNewRunClicked;
 	FSimpleDelegate OnChangeClassClicked;
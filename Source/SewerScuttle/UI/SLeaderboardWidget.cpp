@@ -5,7 +5,7 @@
 #include "Widgets/Input/SButton.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/SOverlay.h"
-#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Views/STableRow.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Images/SImage.h"
@@ -16,14 +16,10 @@ void SLeaderboardWidget::Construct(const FArguments& InArgs)
 {
 	OnBackClicked = InArgs._OnBackClicked;
 	OnWatchReplayClicked = InArgs._OnWatchReplayClicked;
-	OnClassTabChanged = InArgs._OnClassTabChanged;
+	OnRaceReplayClicked = InArgs._OnRaceReplayClicked;
+	OnPageRequested = InArgs._OnPageRequested;
 	SelectedClass = TEXT(""); // Default to Overall
 
-	RebuildUI();
-}
-
-void SLeaderboardWidget::RebuildUI()
-{
 	ChildSlot
 	[
 		SNew(SOverlay)
@@ -42,7 +38,7 @@ void SLeaderboardWidget::RebuildUI()
 			.WidthOverride(1000)
 			.HeightOverride(800)
 			[
-				SAssignNew(MainStack, SVerticalBox)
+				SNew(SVerticalBox)
 				// Title
 				+ SVerticalBox::Slot()
 				.AutoHeight()
@@ -101,11 +97,27 @@ void SLeaderboardWidget::RebuildUI()
 					SNew(SOverlay)
 					+ SOverlay::Slot()
 					[
-						SNew(SScrollBox)
-						+ SScrollBox::Slot()
-						[
-							SAssignNew(LeaderboardContainer, SVerticalBox)
-						]
+						SAssignNew(LeaderboardList, SListView<FEntryPtr>)
+						.ListItemsSource(&VisibleEntries)
+						.OnGenerateRow(this, &SLeaderboardWidget::OnGenerateRow)
+						.SelectionMode(ESelectionMode::None)
+					]
+
+					// Empty Message
+					+ SOverlay::Slot()
+					.HAlign(HAlign_Center)
+					.VAlign(VAlign_Top)
+					.Padding(0, 50, 0, 0)
+					[
+						SNew(STextBlock)
+						.Text(FText::FromString(TEXT("NO RECORDS FOUND IN THIS CATEGORY")))
+						.Font(FCoreStyle::GetDefaultFontStyle("Italic", 18))
+						.ColorAndOpacity(FSlateColor(FLinearColor(1, 1, 1, 0.3f)))
+						.Visibility_Lambda([this]()
+						{
+							const FTabPages* Tab = TabPages.Find(SelectedClass);
+							return (Tab && Tab->Entries.Num() == 0 && !Tab->bRequestInFlight) ? EVisibility::HitTestInvisible : EVisibility::Collapsed;
+						})
 					]
 					
 					// Loading Overlay
@@ -114,7 +126,7 @@ void SLeaderboardWidget::RebuildUI()
 					.VAlign(VAlign_Center)
 					[
 						SAssignNew(LoadingWidget, SBox)
-						.Visibility(EVisibility::Collapsed)
+						.Visibility_Lambda([this]() { return IsSelectedTabLoading() ? EVisibility::HitTestInvisible : EVisibility::Collapsed; })
 						[
 							SNew(STextBlock)
 							.Text(FText::FromString(TEXT("FETCHING DATA...")))
@@ -134,6 +146,7 @@ void SLeaderboardWidget::RebuildUI()
 					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 20))
 					.ColorAndOpacity(FSlateColor(FLinearColor::Yellow))
 					.Justification(ETextJustify::Center)
+					.Visibility(EVisibility::Hidden)
 				]
 
 				// Back Button
@@ -160,13 +173,11 @@ void SLeaderboardWidget::RebuildUI()
 
 TSharedRef<SWidget> SLeaderboardWidget::CreateClassTab(const FString& ClassName, const FText& DisplayName)
 {
-	bool bIsSelected = (SelectedClass == ClassName);
-
+	// Selection is read through attributes so switching tabs doesn't rebuild the widget
 	return SNew(SButton)
 		.OnClicked(this, &SLeaderboardWidget::OnTabClicked, ClassName)
 		.ButtonStyle(FCoreStyle::Get(), "NoBorder")
 		.ContentPadding(FMargin(15, 8))
-		.IsEnabled_Lambda([this]() { return LoadingWidget.IsValid() && LoadingWidget->GetVisibility() == EVisibility::Collapsed; })
 		[
 			SNew(SVerticalBox)
 			+ SVerticalBox::Slot()
@@ -174,8 +185,8 @@ TSharedRef<SWidget> SLeaderboardWidget::CreateClassTab(const FString& ClassName,
 			[
 				SNew(STextBlock)
 				.Text(DisplayName)
-				.Font(FCoreStyle::GetDefaultFontStyle(bIsSelected ? "Bold" : "Regular", 14))
-				.ColorAndOpacity(bIsSelected ? FLinearColor(1, 0.8f, 0) : FLinearColor::White)
+				.Font_Lambda([this, ClassName]() { return FCoreStyle::GetDefaultFontStyle(SelectedClass == ClassName ? "Bold" : "Regular", 14); })
+				.ColorAndOpacity_Lambda([this, ClassName]() { return FSlateColor(SelectedClass == ClassName ? FLinearColor(1, 0.8f, 0) : FLinearColor::White); })
 			]
 			+ SVerticalBox::Slot()
 			.AutoHeight()
@@ -183,7 +194,7 @@ TSharedRef<SWidget> SLeaderboardWidget::CreateClassTab(const FString& ClassName,
 			[
 				SNew(SBox)
 				.HeightOverride(2)
-				.Visibility(bIsSelected ? EVisibility::Visible : EVisibility::Hidden)
+				.Visibility_Lambda([this, ClassName]() { return SelectedClass == ClassName ? EVisibility::Visible : EVisibility::Hidden; })
 				[
 					SNew(SImage)
 					.Image(FCoreStyle::Get().GetBrush("WhiteBrush"))
@@ -198,63 +209,127 @@ FReply SLeaderboardWidget::OnTabClicked(FString ClassName)
 	if (SelectedClass != ClassName)
 	{
 		SelectedClass = ClassName;
-		SetLoading(true);
-		
-		// Re-construct UI to update selection visual before firing the delegate
-		RebuildUI();
-		
-		if (OnClassTabChanged.IsBound())
+
+		// Show whatever is cached for the tab straight away, only fetching if nothing is
+		FTabPages& Tab = TabPages.FindOrAdd(ClassName);
+		if (Tab.Entries.Num() == 0)
+		{
+			RequestNextPage(ClassName);
+		}
+
+		RefreshVisibleEntries();
+		if (LeaderboardList.IsValid())
 		{
-			OnClassTabChanged.Execute(ClassName);
+			LeaderboardList->ScrollToTop();
 		}
 	}
 	return FReply::Handled();
 }
 
-void SLeaderboardWidget::SetLoading(bool bLoading)
+void SLeaderboardWidget::ResetPages()
+{
+	TabPages.Reset();
+	RefreshVisibleEntries();
+	RequestNextPage(SelectedClass);
+}
+
+void SLeaderboardWidget::RequestNextPage(const FString& ClassName)
+{
+	FTabPages& Tab = TabPages.FindOrAdd(ClassName);
+	if (!Tab.bHasMore || Tab.bRequestInFlight) return;
+
+	Tab.bRequestInFlight = true;
+	OnPageRequested.ExecuteIfBound(ClassName, Tab.Entries.Num(), PageSize);
+}
+
+void SLeaderboardWidget::AddPage(const FLeaderboardPageData& Page)
 {
-	if (LoadingWidget.IsValid())
+	FTabPages* Tab = TabPages.Find(Page.PlayerClass);
+
+	// Pages from before a reset (or duplicates) don't continue the cache
+	if (!Tab || Page.Offset != Tab->Entries.Num()) return;
+
+	Tab->bRequestInFlight = false;
+	Tab->bHasMore = Page.bHasMore && Page.Entries.Num() > 0;
+	Tab->PlayerRank = Page.PlayerRank;
+	for (const FLeaderboardEntryData& Entry : Page.Entries)
 	{
-		LoadingWidget->SetVisibility(bLoading ? EVisibility::Visible : EVisibility::Collapsed);
+		Tab->Entries.Add(MakeShared<FLeaderboardEntryData>(Entry));
 	}
-	if (LeaderboardContainer.IsValid())
+
+	if (Page.PlayerClass == SelectedClass)
+	{
+		RefreshVisibleEntries();
+	}
+}
+
+void SLeaderboardWidget::CancelPendingPages()
+{
+	for (TPair<FString, FTabPages>& Pair : TabPages)
 	{
-		LeaderboardContainer->SetVisibility(bLoading ? EVisibility::HitTestInvisible : EVisibility::Visible);
-		if (bLoading) LeaderboardContainer->ClearChildren();
+		Pair.Value.bRequestInFlight = false;
 	}
 }
 
-void SLeaderboardWidget::UpdateLeaderboard(const TArray<FLeaderboardEntryData>& Entries, int32 PlayerRank)
+bool SLeaderboardWidget::IsSelectedTabLoading() const
 {
-	SetLoading(false);
+	const FTabPages* Tab = TabPages.Find(SelectedClass);
+	return Tab && Tab->Entries.Num() == 0 && Tab->bRequestInFlight;
+}
 
-	if (!LeaderboardContainer.IsValid()) return;
+void SLeaderboardWidget::RefreshVisibleEntries()
+{
+	const FTabPages* Tab = TabPages.Find(SelectedClass);
+	VisibleEntries = Tab ? Tab->Entries : TArray<FEntryPtr>();
 
-	LeaderboardContainer->ClearChildren();
+	if (LeaderboardList.IsValid())
+	{
+		LeaderboardList->RequestListRefresh();
+	}
 
-	if (Entries.Num() == 0)
+	if (PlayerRankText.IsValid())
 	{
-		LeaderboardContainer->AddSlot()
-		.HAlign(HAlign_Center)
-		.Padding(0, 50, 0, 0)
-		[
-			SNew(STextBlock)
-			.Text(FText::FromString(TEXT("NO RECORDS FOUND IN THIS CATEGORY")))
-			.Font(FCoreStyle::GetDefaultFontStyle("Italic", 18))
-			.ColorAndOpacity(FSlateColor(FLinearColor(1, 1, 1, 0.3f)))
-		];
-		return;
+		if (Tab && Tab->PlayerRank > 0)
+		{
+			PlayerRankText->SetText(FText::FromString(FString::Printf(TEXT("YOUR CURRENT RANK: %d"), Tab->PlayerRank)));
+			PlayerRankText->SetVisibility(EVisibility::Visible);
+		}
+		else
+		{
+			PlayerRankText->SetVisibility(EVisibility::Hidden);
+		}
+	}
+}
+
+const FLeaderboardEntryData* SLeaderboardWidget::FindEntry(int32 RunId) const
+{
+	for (const TPair<FString, FTabPages>& Pair : TabPages)
+	{
+		for (const FEntryPtr& Entry : Pair.Value.Entries)
+		{
+			if (Entry->RunId == RunId) return Entry.Get();
+		}
 	}
+	return nullptr;
+}
 
-	for (int32 i = 0; i < Entries.Num(); ++i)
+TSharedRef<ITableRow> SLeaderboardWidget::OnGenerateRow(FEntryPtr Entry, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	// Rows near the end of what's loaded are coming into view, so fetch the next page ahead of the scroll
+	// (pages are contiguous from rank 1, so an entry's rank is its position in the list)
+	const int32 Rank = Entry->Rank > 0 ? Entry->Rank : VisibleEntries.Find(Entry) + 1;
+	if (Rank > VisibleEntries.Num() - PageSize / 2)
 	{
-		const FLeaderboardEntryData& Entry = Entries[i];
-		FLinearColor RowColor = (i % 2 == 0) ? FLinearColor(1, 1, 1, 0.05f) : FLinearColor(0, 0, 0, 0.2f);
-		if (i == 0) RowColor = FLinearColor(1, 0.8f, 0, 0.15f); // Gold highlight for #1
+		RequestNextPage(SelectedClass);
+	}
+
+	FLinearColor RowColor = (Rank % 2 == 1) ? FLinearColor(1, 1, 1, 0.05f) : FLinearColor(0, 0, 0, 0.2f);
+	if (Rank == 1) RowColor = FLinearColor(1, 0.8f, 0, 0.15f); // Gold highlight for #1
+
+	const int32 RunId = Entry->RunId;
 
-		LeaderboardContainer->AddSlot()
-		.AutoHeight()
-		.Padding(0, 0, 0, 2)
+	return SNew(STableRow<FEntryPtr>, OwnerTable)
+		.Padding(FMargin(0, 0, 0, 2))
 		[
 			SNew(SBorder)
 			.BorderImage(FCoreStyle::Get().GetBrush("WhiteBrush"))
@@ -272,9 +347,9 @@ void SLeaderboardWidget::UpdateLeaderboard(const TArray<FLeaderboardEntryData>&
 					.WidthOverride(40)
 					[
 						SNew(STextBlock)
-						.Text(FText::FromString(FString::Printf(TEXT("%d"), i + 1)))
+						.Text(FText::AsNumber(Rank))
 						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 18))
-						.ColorAndOpacity(i < 3 ? FLinearColor(1, 0.8f, 0) : FLinearColor::White)
+						.ColorAndOpacity(Rank <= 3 ? FLinearColor(1, 0.8f, 0) : FLinearColor::White)
 						.Justification(ETextJustify::Center)
 					]
 				]
@@ -287,13 +362,13 @@ void SLeaderboardWidget::UpdateLeaderboard(const TArray<FLeaderboardEntryData>&
 					+ SVerticalBox::Slot().AutoHeight()
 					[
 						SNew(STextBlock)
-						.Text(FText::FromString(Entry.PlayerName))
+						.Text(FText::FromString(Entry->PlayerName))
 						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 18))
 					]
 					+ SVerticalBox::Slot().AutoHeight()
 					[
 						SNew(STextBlock)
-						.Text(FText::FromString(FPlayerClassData::PlayerClassToString(Entry.PlayerClass)))
+						.Text(FText::FromString(FPlayerClassData::PlayerClassToString(Entry->PlayerClass)))
 						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 12))
 						.ColorAndOpacity(FLinearColor(0.6f, 0.6f, 0.6f))
 					]
@@ -305,7 +380,7 @@ void SLeaderboardWidget::UpdateLeaderboard(const TArray<FLeaderboardEntryData>&
 				.Padding(20, 0, 40, 0)
 				[
 					SNew(STextBlock)
-					.Text(FText::AsNumber(Entry.Score))
+					.Text(FText::AsNumber(Entry->Score))
 					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 22))
 					.ColorAndOpacity(FLinearColor(1, 0.8f, 0))
 				]
@@ -316,9 +391,24 @@ void SLeaderboardWidget::UpdateLeaderboard(const TArray<FLeaderboardEntryData>&
 				[
 					SNew(SButton)
 					.Text(FText::FromString(TEXT("WATCH")))
-					.Visibility(Entry.bHasReplay ? EVisibility::Visible : EVisibility::Collapsed)
-					.OnClicked_Lambda([this, Entry]() {
-						OnWatchReplayClicked.ExecuteIfBound(Entry.RunId);
+					.Visibility(Entry->bHasReplay ? EVisibility::Visible : EVisibility::Collapsed)
+					.OnClicked_Lambda([this, RunId]() {
+						OnWatchReplayClicked.ExecuteIfBound(RunId);
+						return FReply::Handled();
+					})
+					.ButtonStyle(FCoreStyle::Get(), "NoBorder")
+					.ContentPadding(FMargin(15, 5))
+				]
+				// Race Button
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				[
+					SNew(SButton)
+					.Text(FText::FromString(TEXT("RACE")))
+					.Visibility(Entry->bHasReplay ? EVisibility::Visible : EVisibility::Collapsed)
+					.OnClicked_Lambda([this, RunId]() {
+						OnRaceReplayClicked.ExecuteIfBound(RunId);
 						return FReply::Handled();
 					})
 					.ButtonStyle(FCoreStyle::Get(), "NoBorder")
@@ -326,20 +416,6 @@ void SLeaderboardWidget::UpdateLeaderboard(const TArray<FLeaderboardEntryData>&
 				]
 			]
 		];
-	}
-
-	if (PlayerRankText.IsValid())
-	{
-		if (PlayerRank > 0)
-		{
-			PlayerRankText->SetText(FText::FromString(FString::Printf(TEXT("YOUR CURRENT RANK: %d"), PlayerRank)));
-			PlayerRankText->SetVisibility(EVisibility::Visible);
-		}
-		else
-		{
-			PlayerRankText->SetVisibility(EVisibility::Hidden);
-		}
-	}
 }
 
 FReply SLeaderboardWidget::OnBackButtonClicked()
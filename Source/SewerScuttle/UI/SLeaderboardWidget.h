@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
 #include "EndlessRunner/ReplayModels.h"
 
 /** Delegate for back button */
@@ -12,12 +13,17 @@ DECLARE_DELEGATE(FOnBackClicked);
 /** Delegate for watch replay button */
 DECLARE_DELEGATE_OneParam(FOnWatchReplayClicked, int32 /* RunId */);
 
-/** Delegate for class tab change */
-DECLARE_DELEGATE_OneParam(FOnClassTabChanged, FString /* ClassName */);
+/** Delegate for race replay button */
+DECLARE_DELEGATE_OneParam(FOnRaceReplayClicked, int32 /* RunId */);
+
+/** Delegate for requesting a page of entries */
+DECLARE_DELEGATE_ThreeParams(FOnLeaderboardPageRequested, FString /* ClassName */, int32 /* Offset */, int32 /* Limit */);
 
 /**
  * Slate widget for leaderboard display
- * Shows top scores and player's rank
+ * Shows top scores and player's rank. Entries are shown in a virtualized list (rows are only generated
+ * for visible entries) and fetched a page at a time as the list is scrolled towards its end. Pages are
+ * cached per class tab, so switching tabs doesn't refetch what was already loaded.
  */
 class SEWERSCUTTLE_API SLeaderboardWidget : public SCompoundWidget
 {
@@ -26,30 +32,58 @@ public:
 	{}
 		SLATE_EVENT(FOnBackClicked, OnBackClicked)
 		SLATE_EVENT(FOnWatchReplayClicked, OnWatchReplayClicked)
-		SLATE_EVENT(FOnClassTabChanged, OnClassTabChanged)
+		SLATE_EVENT(FOnRaceReplayClicked, OnRaceReplayClicked)
+		SLATE_EVENT(FOnLeaderboardPageRequested, OnPageRequested)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs);
 
-	/** Update leaderboard data */
-	void UpdateLeaderboard(const TArray<FLeaderboardEntryData>& Entries, int32 PlayerRank);
+	/** Drop all cached pages and request the first page of the selected tab */
+	void ResetPages();
+
+	/** Add a received page to its tab's cache (ignored unless it continues the cached entries) */
+	void AddPage(const FLeaderboardPageData& Page);
+
+	/** Give up on in-flight page requests (after an error) */
+	void CancelPendingPages();
+
+	/** Find a cached entry by run */
+	const FLeaderboardEntryData* FindEntry(int32 RunId) const;
 
-	/** Set loading state */
-	void SetLoading(bool bLoading);
+	/** Currently selected class tab (empty for overall) */
+	const FString& GetSelectedClass() const { return SelectedClass; }
+
+	/** Entries requested per page */
+	static constexpr int32 PageSize = 25;
 
 	FOnBackClicked OnBackClicked;
 	FOnWatchReplayClicked OnWatchReplayClicked;
-	FOnClassTabChanged OnClassTabChanged;
+	FOnRaceReplayClicked OnRaceReplayClicked;
+	FOnLeaderboardPageRequested OnPageRequested;
 
 private:
+	using FEntryPtr = TSharedPtr<FLeaderboardEntryData>;
+
+	/** Pages loaded so far for one class tab */
+	struct FTabPages
+	{
+		TArray<FEntryPtr> Entries;
+		int32 PlayerRank = 0;
+		bool bHasMore = true;
+		bool bRequestInFlight = false;
+	};
+
 	/** Current selected class tab */
 	FString SelectedClass;
 
-	/** Leaderboard entries container */
-	TSharedPtr<class SVerticalBox> LeaderboardContainer;
+	/** Cached pages by class tab */
+	TMap<FString, FTabPages> TabPages;
 
-	/** Main vertical stack */
-	TSharedPtr<class SVerticalBox> MainStack;
+	/** Entries of the selected tab (the list view's source) */
+	TArray<FEntryPtr> VisibleEntries;
+
+	/** Leaderboard entries list */
+	TSharedPtr<SListView<FEntryPtr>> LeaderboardList;
 
 	/** Player rank text */
 	TSharedPtr<class STextBlock> PlayerRankText;
@@ -60,13 +94,21 @@ private:
 	/** Create a class tab button */
 	TSharedRef<class SWidget> CreateClassTab(const FString& ClassName, const FText& DisplayName);
 
+	/** Generate a row for an entry (only called for visible entries) */
+	TSharedRef<class ITableRow> OnGenerateRow(FEntryPtr Entry, const TSharedRef<class STableViewBase>& OwnerTable);
+
+	/** Request the next page of a tab if there is one and none is in flight */
+	void RequestNextPage(const FString& ClassName);
+
+	/** Point the list at the selected tab's cached entries */
+	void RefreshVisibleEntries();
+
+	/** Whether the selected tab is waiting for its first page */
+	bool IsSelectedTabLoading() const;
+
 	/** Handle tab click */
 	FReply OnTabClicked(FString ClassName);
 
 	/** Handle back button click */
 	FReply OnBackButtonClicked();
-
-	/** Rebuild the entire widget UI */
-	void RebuildUI();
 };
-
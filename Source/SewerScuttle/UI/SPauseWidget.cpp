@@ -118,6 +118,14 @@ void SPauseWidget::Construct(const FArguments& InArgs, int32 Seed)
 	];
 }
 
+void SPauseWidget::SetSeed(int32 Seed)
+{
+	if (SeedText.IsValid())
+	{
+		SeedText->SetText(FText::FromString(FString::Printf(TEXT("SEED: %d"), Seed)));
+	}
+}
+
 FReply SPauseWidget::OnResumeButtonClicked()
 {
 	if (OnResumeClicked.IsBound())
@@ -27,6 +27,9 @@ public:
 
 	void Construct(const FArguments& InArgs, int32 Seed);
 
+	/** Update the displayed seed (the widget is reused between pauses) */
+	void SetSeed(int32 Seed);
+
 	/** Delegates */
 	FSimpleDelegate OnResumeClicked;
 	FSimpleDelegate OnNewRunClicked;
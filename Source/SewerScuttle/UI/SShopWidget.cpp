@@ -73,6 +73,11 @@ void SShopWidget::UpdateItems(const FShopData& ShopData)
 {
 	if (!ItemsContainer.IsValid()) return;
 
+	TArray<FString> ItemKeys;
+	for (const FShopItemData& Item : ShopData.Items) ItemKeys.Add(FString::Printf(TEXT("%s:%d"), *Item.Id, Item.Cost));
+	if (DisplayedItemKeys.IsSet() && DisplayedItemKeys.GetValue() == ItemKeys) return;
+	DisplayedItemKeys = MoveTemp(ItemKeys);
+
 	ItemsContainer->ClearChildren();
 
 	for (const FShopItemData& Item : ShopData.Items)
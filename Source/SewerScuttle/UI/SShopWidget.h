@@ -25,7 +25,7 @@ public:
 	/** Update currency display */
 	void UpdateCurrency(int32 Currency);
 
-	/** Update shop items */
+	/** Update shop items (rows are only rebuilt when the item list changed) */
 	void UpdateItems(const struct FShopData& ShopData);
 
 	/** Delegates */
@@ -39,6 +39,9 @@ private:
 	/** Items container */
 	TSharedPtr<class SVerticalBox> ItemsContainer;
 
+	/** "id:cost" of the rows currently shown, unset until the first update */
+	TOptional<TArray<FString>> DisplayedItemKeys;
+
 	/** Handle back button click */
 	FReply OnBackButtonClicked();
 
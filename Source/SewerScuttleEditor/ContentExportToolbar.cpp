@@ -4,6 +4,7 @@
 #include "LevelEditor.h"
 #include "ToolMenus.h"
 #include "EndlessRunner/ContentExportLibrary.h"
+#include "EndlessRunner/ConfigManager.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 
 IMPLEMENT_MODULE(FContentExportToolbarModule, SewerScuttleEditor)
@@ -42,6 +43,6 @@ void FContentExportToolbarModule::OnExportButtonClicked()
 	FString ProjectDir = FPaths::ProjectDir();
 	FString DefaultPath = ProjectDir / TEXT("Backend/storage/app/content/latest.json");
 	
-	UContentExportLibrary::ExportGameContent(TEXT("1.0.0"), DefaultPath);
+	UContentExportLibrary::ExportGameContent(UConfigManager::Get()->GetContentVersion(), DefaultPath);
 }
 